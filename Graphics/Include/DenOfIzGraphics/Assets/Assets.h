@@ -31,6 +31,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Import/ShaderImporter.h"
 #include "Import/TextureImporter.h"
 #include "Import/VGImporter.h"
+#include "Import/ImportCache.h"
+#include "Import/BatchImporter.h"
 
 #include "Serde/Animation/AnimationAsset.h"
 #include "Serde/Animation/AnimationAssetReader.h"
@@ -60,6 +62,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Serde/Texture/TextureAssetWriter.h"
 
 #include "Shaders/DxilToMsl.h"
+#include "Shaders/EngineShaders.h"
+#include "Shaders/ShaderCache.h"
 #include "Shaders/ShaderCompiler.h"
 #include "Shaders/ShaderReflectDesc.h"
 
@@ -69,4 +73,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Font/TextRenderer.h"
 
 #include "Bundle/Bundle.h"
-#include "Bundle/BundleManager.h"
\ No newline at end of file
+#include "Bundle/BundleManager.h"
+#include "Bundle/AssetRequestQueue.h"
+#include "Bundle/AssetAccessTrace.h"
+
+#include "GpuResource/GpuResourceLoader.h"
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+#include "DenOfIzGraphics/Assets/Serde/Asset.h"
+#include "DenOfIzGraphics/Utilities/Common_Macro.h"
+
+namespace DenOfIz
+{
+    struct DZ_API AssetAccess
+    {
+        AssetUri Uri;
+        uint64_t TimeNs = 0; // Since the trace was started or cleared
+    };
+
+    struct DZ_API AssetAccessArray
+    {
+        AssetAccess *Elements;
+        uint32_t     NumElements;
+    };
+
+    /// Records the order and time assets are opened in, attach it to a BundleManager with SetAccessTrace. FirstTouchOrder can be passed
+    /// as the load order of BundleDirectoryDesc or BundleCompactDesc so assets needed together during a cold start are laid out
+    /// contiguously. Record is thread safe, the other methods must not overlap with it.
+    class AssetAccessTrace : public NonCopyable
+    {
+        static constexpr uint64_t Magic   = 0x445A5452414345; // "DZTRACE"
+        static constexpr uint32_t Version = 1;
+
+        std::mutex                            m_mutex;
+        std::chrono::steady_clock::time_point m_start;
+        std::vector<AssetAccess>              m_accesses;
+        std::vector<AssetUri>                 m_firstTouchOrder;
+        std::unordered_set<uint64_t>          m_touched; // AssetUri::Hash( ) of m_firstTouchOrder
+
+    public:
+        DZ_API AssetAccessTrace( );
+
+        DZ_API void Record( const AssetUri &uri );
+        DZ_API void Clear( );
+
+        // Every recorded open in order, including repeated opens of the same asset
+        [[nodiscard]] DZ_API AssetAccessArray GetAccesses( );
+        // Each recorded asset once, in the order it was first opened
+        [[nodiscard]] DZ_API AssetUriArray FirstTouchOrder( );
+
+        DZ_API bool Save( const InteropString &path );
+        // Replaces the recorded accesses with the ones in the file
+        DZ_API bool Load( const InteropString &path );
+
+    private:
+        void Append( const AssetUri &uri, uint64_t timeNs );
+    };
+} // namespace DenOfIz
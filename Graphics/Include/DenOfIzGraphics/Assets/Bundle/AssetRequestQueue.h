@@ -0,0 +1,138 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include "DenOfIzGraphics/Assets/Bundle/BundleManager.h"
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
+
+namespace DenOfIz
+{
+    struct DZ_API AssetRequestHandle
+    {
+        uint64_t Value = 0; // 0 is never a valid handle
+    };
+
+    enum class AssetRequestStatus
+    {
+        Unknown, // Never requested, cancelled or already returned from CompleteRequests
+        Pending,
+        Loading,
+        Ready,
+        Failed
+    };
+
+    struct DZ_API AssetRequestQueueDesc
+    {
+        BundleManager *Manager    = nullptr;
+        uint32_t       NumWorkers = 2; // Most requests loading at the same time, loads run as jobs on JobSystem::Get( )
+        // Limits how many loaded assets CompleteRequests hands out per call, 0 means no limit. At least one request is always completed
+        // so a single asset larger than the byte budget can't stall the queue.
+        uint32_t MaxCompletionsPerFrame    = 0;
+        uint64_t MaxCompletedBytesPerFrame = 0;
+    };
+
+    struct DZ_API AssetRequestDesc
+    {
+        AssetUri Uri;
+        int32_t  Priority = 0; // Higher priorities are loaded first, equal priorities in request order
+    };
+
+    struct DZ_API AssetRequestResult
+    {
+        AssetRequestHandle Handle;
+        AssetUri           Uri;
+        AssetRequestStatus Status; // Ready or Failed
+        BinaryReader      *Reader; // Owned by the caller, fully read into memory. Null if the request failed
+    };
+
+    struct DZ_API AssetRequestResultArray
+    {
+        AssetRequestResult *Elements;
+        uint32_t            NumElements;
+    };
+
+    /// Loads assets from a BundleManager as jobs on the engine's JobSystem. Loads read and decompress the whole asset ahead of time so
+    /// using the returned reader never touches the disk. Results are collected once per frame with CompleteRequests, which is budgeted so
+    /// a burst of finished loads does not cause a hitch. All methods are thread safe.
+    class AssetRequestQueue : public NonCopyable
+    {
+        struct PendingKey
+        {
+            int32_t  Priority;
+            uint64_t Sequence;
+            uint64_t Handle;
+
+            bool operator<( const PendingKey &other ) const
+            {
+                return Priority != other.Priority ? Priority > other.Priority : Sequence < other.Sequence;
+            }
+        };
+
+        struct RequestState
+        {
+            AssetUri           Uri;
+            AssetRequestStatus Status          = AssetRequestStatus::Pending;
+            PendingKey         Key             = { };
+            bool               CancelRequested = false;
+            BinaryReader      *Reader          = nullptr;
+            uint64_t           NumBytes        = 0;
+        };
+
+        AssetRequestQueueDesc                      m_desc;
+        JobCounter                                 m_loadJobs;
+        uint32_t                                   m_numLoadJobs = 0; // Guarded by m_mutex, each job loads pending requests until none are left
+        mutable std::mutex                         m_mutex;
+        mutable std::condition_variable            m_requestFinished;
+        std::unordered_map<uint64_t, RequestState> m_requests;
+        std::set<PendingKey>                       m_pending;
+        std::deque<uint64_t>                       m_finished; // Loaded or failed, in the order they finished
+        std::vector<AssetRequestResult>            m_frameResults;
+        uint64_t                                   m_nextHandle   = 1;
+        uint64_t                                   m_nextSequence = 0;
+        bool                                       m_shutdown     = false;
+
+        void                        ScheduleLoadJobs( );
+        void                        LoadPendingRequests( );
+        [[nodiscard]] BinaryReader *LoadAsset( const AssetUri &uri, uint64_t &numBytes ) const;
+
+    public:
+        DZ_API explicit AssetRequestQueue( const AssetRequestQueueDesc &desc );
+        DZ_API ~AssetRequestQueue( );
+
+        DZ_API AssetRequestHandle Request( const AssetRequestDesc &desc );
+        // Returns false if the request has already been completed or cancelled. A request that is currently loading can't be interrupted,
+        // the load runs to completion and its result is dropped once it finishes
+        DZ_API bool Cancel( const AssetRequestHandle &handle );
+        // Only affects requests that have not started loading yet
+        DZ_API bool SetPriority( const AssetRequestHandle &handle, int32_t priority );
+
+        DZ_API [[nodiscard]] AssetRequestStatus GetStatus( const AssetRequestHandle &handle ) const;
+        // Blocks until the request is Ready or Failed, returns false for unknown handles. Don't call it from a job, loads need a free worker
+        DZ_API bool                   WaitForRequest( const AssetRequestHandle &handle ) const;
+        DZ_API [[nodiscard]] uint32_t NumOutstandingRequests( ) const;
+
+        // Call once per frame, the returned array is valid until the next call
+        DZ_API AssetRequestResultArray CompleteRequests( );
+    };
+} // namespace DenOfIz
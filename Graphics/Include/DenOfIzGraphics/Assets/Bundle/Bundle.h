@@ -19,6 +19,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include <fstream>
+#include <mutex>
 #include <unordered_map>
 #include "DenOfIzGraphics/Assets/Serde/Asset.h"
 #include "DenOfIzGraphics/Assets/Stream/BinaryReader.h"
@@ -63,8 +64,11 @@ namespace DenOfIz
 
     struct DZ_API BundleHeader : AssetHeader
     {
-        static constexpr uint64_t BundleHeaderMagic = 0x445A42554E444C; // "DZBUNDL"
-        static constexpr uint32_t Latest            = 1;
+        static constexpr uint64_t BundleHeaderMagic           = 0x445A42554E444C; // "DZBUNDL"
+        static constexpr uint32_t BlockCompressionVersion     = 2;                // Compressed assets are split into independently compressed blocks
+        static constexpr uint32_t HashedTOCVersion            = 3;                // Table of contents is sorted by path hash and searched in place
+        static constexpr uint32_t Latest                      = 3;
+        static constexpr uint32_t DefaultCompressionBlockSize = 128 * 1024;
 
         uint32_t NumAssets    = 0;
         uint64_t TOCOffset    = 0;
@@ -75,11 +79,14 @@ namespace DenOfIz
         }
     };
 
+    // Fields of a serialized table of contents record, in order
     struct DZ_API BundleTOCEntry
     {
-        uint32_t AssetTypeId;
+        uint64_t PathHash; // AssetUri::Hash( )
         uint64_t Offset;
         uint64_t NumBytes;
+        uint32_t AssetTypeId;
+        uint32_t PathOffset; // Into the path strings that follow the records
         uint32_t PathLength;
     };
 
@@ -88,6 +95,11 @@ namespace DenOfIz
         InteropString Path;
         bool          CreateIfNotExists = false;
         bool          Compress          = false;
+        // Compressed assets are stored in blocks of this many bytes so readers can seek without decompressing the whole asset.
+        // Smaller blocks make seeking cheaper, larger blocks compress better.
+        uint32_t CompressionBlockSize = BundleHeader::DefaultCompressionBlockSize;
+        // Maps the bundle file once, readers of uncompressed assets are then views into the mapping and do not copy.
+        bool MemoryMapped = false;
     };
 
     struct DZ_API BundleDirectoryDesc
@@ -95,8 +107,27 @@ namespace DenOfIz
         InteropString  DirectoryPath;
         InteropString  OutputBundlePath;
         bool           Recursive = true;
-        bool           Compress  = false;
+        bool           Compress             = false;
+        uint32_t       CompressionBlockSize = BundleHeader::DefaultCompressionBlockSize;
         AssetTypeArray AssetTypeFilter; // Empty/Null means include all types
+        // Assets listed here are written first in this order so they are read sequentially, usually AssetAccessTrace::FirstTouchOrder.
+        // Uris are relative to DirectoryPath, the remaining assets follow in path order.
+        AssetUriArray LoadOrder{ };
+    };
+
+    enum class BundleCompactOrder
+    {
+        Offset, // Keeps the current layout, only drops dead space
+        Type,   // Groups assets of the same type, ordered by path within a type
+        Path
+    };
+
+    struct DZ_API BundleCompactDesc
+    {
+        BundleCompactOrder Order = BundleCompactOrder::Type;
+        // Assets listed here are written first in this order, for example AssetAccessTrace::FirstTouchOrder recorded while loading a
+        // level. The remaining assets follow ordered by Order.
+        AssetUriArray LoadOrder{ };
     };
 
     struct DZ_API BundleAssetFilter
@@ -106,19 +137,71 @@ namespace DenOfIz
         InteropString  PathFilter;      // Empty means include all paths
     };
 
+    class BundleSpaceMap;
+    class BundleTableOfContents;
+    struct BlockCompressionIndex;
+    class MemoryMappedFile;
+    class RandomAccessFile;
+
+    /// Assets are looked up by AssetUri::Hash( ), lookups don't allocate and for memory mapped bundles the table of contents is
+    /// searched directly in the mapping so opening a bundle costs the same regardless of how many assets it contains.
+    /// Threading: OpenReader and Exists can be called concurrently from any number of threads, the asset table is never locked for
+    /// lookups and asset bytes are read at explicit offsets so readers don't share a file position.
+    /// AddAsset and Save are serialized against each other but must not overlap with readers.
+    /// AddAsset stores identical payloads once, assets with the same content added through the same Bundle share an offset.
+    /// Space left behind by replaced assets and old tables of contents is reused by AddAsset and Save once a Save no longer references
+    /// it, readers of a replaced asset must be released before that Save. Compact rewrites the bundle without any dead space.
+    /// Readers returned from OpenReader for compressed or memory mapped bundles must not outlive the bundle.
     class Bundle
     {
-        BundleDesc                                  m_desc;
-        std::unordered_map<std::string, AssetEntry> m_assetEntries;
-        std::fstream                               *m_bundleFile;
-        bool                                        m_isDirty;
-        bool                                        m_isCompressed;
-        mutable std::vector<AssetUri>               m_allAssets;
-        mutable std::vector<AssetUri>               m_assetsByType;
-
-        void             LoadTableOfContents( );
-        void             WriteEmptyHeader( ) const;
-        static AssetType DetermineAssetTypeFromExtension( const InteropString &extension );
+        struct StoredPayload
+        {
+            uint64_t Offset;
+            uint64_t NumBytes;
+            uint64_t StoredNumBytes; // Differs from NumBytes for compressed bundles
+        };
+
+        BundleDesc                      m_desc;
+        InteropString                   m_resolvedPath;
+        BundleTableOfContents          *m_toc;
+        BundleSpaceMap                 *m_spaceMap;
+        bool                            m_spaceMapBuilt = false; // Built on the first write, readers never need it
+        uint64_t                        m_tocOffset     = 0;
+        uint64_t                        m_tocNumBytes   = 0;
+        std::fstream                   *m_bundleFile; // Only used for writing
+        RandomAccessFile               *m_readFile   = nullptr;
+        MemoryMappedFile               *m_mappedFile = nullptr;
+        std::vector<MemoryMappedFile *> m_retiredMappings; // Kept alive since readers might still be viewing them
+        bool                            m_isDirty;
+        bool                            m_isCompressed;
+        uint32_t                        m_version = BundleHeader::Latest;
+        std::mutex                      m_writeMutex;
+        mutable std::vector<AssetUri>   m_allAssets;
+        mutable std::vector<AssetUri>   m_assetsByType;
+
+        // Content hash to payloads written by this instance, candidates are compared byte by byte before being reused
+        std::unordered_multimap<uint64_t, StoredPayload> m_storedPayloads;
+
+        void                 LoadTableOfContents( );
+        void                 LoadLegacyTableOfContents( BinaryReader &reader, uint32_t numAssets ) const;
+        void                 WriteLegacyTableOfContents( const BinaryWriter &writer ) const;
+        void                 WriteEmptyHeader( ) const;
+        void                 OpenReadHandles( );
+        void                 MapBundleFile( );
+        void                 EnsureSpaceMap( );
+        void                 ReleasePayload( uint64_t offset, uint64_t numBytes );
+        [[nodiscard]] bool   ReadAt( uint64_t offset, Byte *destination, uint64_t numBytes ) const;
+        [[nodiscard]] bool   ReadRange( uint64_t offset, uint64_t numBytes, std::vector<Byte> &storage, ByteArrayView &range ) const;
+        [[nodiscard]] bool   ReadStoredNumBytes( uint64_t offset, uint64_t numBytes, uint64_t &storedNumBytes ) const;
+        [[nodiscard]] bool   ReadBlockIndex( uint64_t offset, uint64_t numBytes, BlockCompressionIndex &index ) const;
+        [[nodiscard]] bool   CopyPayload( uint64_t offset, uint64_t numBytes, const BinaryWriter &writer, uint64_t &numBytesWritten ) const;
+        void                 ReplaceBundleFile( const std::string &replacementPath, const std::string &bundlePath, std::error_code &error ) const;
+        BinaryReader        *OpenAssetReader( uint64_t offset, uint64_t numBytes ) const;
+        BinaryReader        *OpenBlockCompressedReader( uint64_t offset, uint64_t numBytes ) const;
+        BinaryReader        *OpenLegacyCompressedReader( uint64_t offset, uint64_t numBytes ) const;
+        [[nodiscard]] bool   WritePayload( const ByteArrayView &data, const std::string &uriStr, uint64_t &offset, uint64_t &storedNumBytes );
+        const StoredPayload *FindStoredPayload( uint64_t contentHash, const ByteArrayView &data ) const;
+        static void          WriteHeader( const BinaryWriter &writer, const BundleHeader &header );
 
     public:
         DZ_API explicit Bundle( const BundleDesc &desc );
@@ -129,6 +212,7 @@ namespace DenOfIz
         DZ_API BinaryWriter                      *OpenWriter( const AssetUri &assetUri );
         DZ_API void                               AddAsset( const AssetUri &assetUri, AssetType type, const ByteArrayView &data );
         DZ_API bool                               Save( );
+        DZ_API bool                               Compact( const BundleCompactDesc &desc = { } );
         DZ_API [[nodiscard]] bool                 Exists( const AssetUri &assetUri ) const;
         DZ_API [[nodiscard]] AssetUriArray        GetAllAssets( ) const;
         DZ_API [[nodiscard]] AssetUriArray        GetAssetsByType( AssetType type ) const;
@@ -136,6 +220,8 @@ namespace DenOfIz
         DZ_API [[nodiscard]] const InteropString &GetPath( ) const;
 
         DZ_API static Bundle *CreateFromDirectory( const BundleDirectoryDesc &directoryDesc );
+        // Extension without the leading dot, Unknown for anything that isn't an asset file
+        DZ_API static AssetType DetermineAssetTypeFromExtension( const InteropString &extension );
     };
 
     struct DZ_API BundleArray
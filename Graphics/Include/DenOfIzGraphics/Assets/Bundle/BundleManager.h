@@ -18,7 +18,11 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
 #include <vector>
+#include "DenOfIzGraphics/Assets/Bundle/AssetAccessTrace.h"
 #include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
 
 namespace DenOfIz
@@ -28,13 +32,19 @@ namespace DenOfIz
         InteropString DefaultSearchPath;
     };
 
+    /// Threading: OpenReader and Exists can be called concurrently, see Bundle for the guarantees of a single bundle.
+    /// Mounting, unmounting and adding assets must not overlap with readers.
     class BundleManager
     {
-        std::vector<Bundle *>                     m_mountedBundles;
-        InteropString                             m_defaultSearchPath;
-        std::unordered_map<std::string, Bundle *> m_assetLocationCache;
-        mutable std::vector<AssetUri>             m_allAssets;
-        mutable std::vector<AssetUri>             m_assetsByType;
+        std::vector<Bundle *>                  m_mountedBundles;
+        InteropString                          m_defaultSearchPath;
+        std::unordered_map<uint64_t, Bundle *> m_assetLocationCache; // Keyed by AssetUri::Hash( )
+        mutable std::shared_mutex              m_cacheMutex;
+        mutable std::vector<AssetUri>          m_allAssets;
+        mutable std::vector<AssetUri>          m_assetsByType;
+        std::atomic<AssetAccessTrace *>        m_accessTrace = nullptr; // Swapped while readers may be recording
+
+        Bundle *FindBundle( const AssetUri &path );
 
     public:
         DZ_API explicit BundleManager( const BundleManagerDesc &desc );
@@ -50,6 +60,9 @@ namespace DenOfIz
         DZ_API bool          Exists( const AssetUri &path );
 
         DZ_API void InvalidateCache( );
+        // Every asset opened through OpenReader is recorded into trace until this is called with nullptr, the trace is not owned.
+        // Safe to call while readers are active, but a replaced trace must outlive any OpenReader call that started before the swap
+        DZ_API void SetAccessTrace( AssetAccessTrace *trace );
 
         DZ_API InteropString ResolveToFilesystemPath( const AssetUri &path );
         DZ_API AssetUriArray GetAllAssets( ) const;
@@ -25,6 +25,21 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace DenOfIz
 {
+    struct DZ_API FileReadRequest
+    {
+        InteropString Path;
+        uint64_t      Offset   = 0;
+        uint64_t      NumBytes = 0;
+        ByteArray     Destination{ };   // Must hold at least NumBytes
+        uint64_t      NumBytesRead = 0; // Written by FileIO::ReadFiles, less than NumBytes if the file ended early or the read failed
+    };
+
+    struct DZ_API FileReadRequestArray
+    {
+        FileReadRequest *Elements;
+        size_t           NumElements;
+    };
+
     /**
      * @brief Cross-platform file I/O operations for asset management.
      * Handles platform-specific path resolution and provides consistent interface
@@ -44,6 +59,15 @@ namespace DenOfIz
          */
         static bool ReadFile( const InteropString &path, const ByteArray &buffer );
 
+        /**
+         * @brief Submit a batch of positional reads together so their I/O overlaps
+         * @param requests Reads to perform, each file is opened once no matter how many requests refer to it
+         * @return true if every request read NumBytes bytes
+         * @note Uses io_uring on Linux when the kernel allows it, otherwise a pool of threads doing positional reads.
+         * Blocks until every request has completed.
+         */
+        static bool ReadFiles( const FileReadRequestArray &requests );
+
         /**
          * @brief Write byte array to file
          * @param path Path to output file
@@ -18,39 +18,46 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
-#include <future>
-#include <queue>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "DenOfIzGraphics/Backends/Interface/ILogicalDevice.h"
+#include "DenOfIzGraphics/Data/StagingRing.h"
 #include "DenOfIzGraphics/Utilities/Interop.h"
 
 namespace DenOfIz
 {
+    // Handles grow with every queued update, 0 is never issued and is always complete
     struct DZ_API UpdateHandle
     {
-        uint64_t Value;
+        uint64_t Value = 0;
     };
 
     struct DZ_API UpdateSourceDataDesc
     {
         ByteArrayView Data;
-        uint64_t      Offset;
-        uint64_t      NumBytes;
+        uint64_t      Offset   = 0;
+        uint64_t      NumBytes = 0; // 0 copies everything after Offset
     };
 
+    // Layout of TextureUpdateDesc::Data, the staging copy is laid out the way the backends copy from
     struct DZ_API TextureSubresourceDesc
     {
-        uint32_t DstRowStride;
-        uint32_t RowCount;
-        uint32_t SrcRowStride;
-        uint32_t DstSliceStride;
-        uint32_t SrcSliceStride;
+        uint32_t SrcRowStride   = 0;
+        uint32_t RowCount       = 0; // Rows of blocks for block compressed formats
+        uint32_t SrcSliceStride = 0; // 0 means rows are tightly packed, Data holds as many depth slices as fit
     };
 
     struct DZ_API GpuResourceLoaderDesc
     {
-        ILogicalDevice *Device;
-        uint64_t        StagingBufferNumBytes;
-        uint32_t        NumStagingBuffers;
+        ILogicalDevice *Device = nullptr;
+        // Every update is sub allocated from one staging ring, updates larger than a quarter of it get a dedicated staging buffer
+        uint64_t StagingRingNumBytes = 32ull * 1024 * 1024;
+        // Each batch records into its own copy command list, while one is recording the others can be in flight
+        uint32_t NumBatches = 2;
     };
 
     struct DZ_API BufferLoadDesc
@@ -59,6 +66,8 @@ namespace DenOfIz
         UpdateSourceDataDesc SourceData;
     };
 
+    // Loads Filename, or Data when it is empty, as a dds/png/jpg... file. Size, format and mips come from the file, the rest of Desc
+    // such as DebugName and extra descriptors and usages is kept.
     struct DZ_API TextureLoadDesc
     {
         TextureDesc   Desc;
@@ -66,94 +75,157 @@ namespace DenOfIz
         ByteArrayView Data;
     };
 
+    // The texture must be in the CopyDst state, transitions are left to the queue that waits for the flush
     struct DZ_API TextureUpdateDesc
     {
-        ITextureResource      *Texture;
-        uint32_t               MipLevel;
-        uint32_t               ArrayLayer;
+        ITextureResource      *Texture    = nullptr;
+        uint32_t               MipLevel   = 0;
+        uint32_t               ArrayLayer = 0;
         TextureSubresourceDesc SubresourceDesc;
         ByteArrayView          Data;
-        uint32_t               CurrentState;
     };
 
     struct DZ_API BufferUpdateDesc
     {
-        IBufferResource     *Buffer;
-        uint64_t             DstOffset;
+        IBufferResource     *Buffer    = nullptr;
+        uint64_t             DstOffset = 0;
         UpdateSourceDataDesc SourceData;
-        uint32_t             CurrentUsage;
     };
 
     struct DZ_API FlushUpdatesDesc
     {
-        ISemaphoreArray WaitSemaphores;
+        ISemaphoreArray WaitSemaphores{ }; // Waited before the copies that were not submitted yet
+        // Signaled instead of the loader's own semaphore, FlushUpdatesResult::Semaphore is null then
+        ISemaphoreArray SignalSemaphores{ };
     };
 
+    // Both are null when there was nothing to submit or wait on. Semaphore must be waited on once, Fence stays valid until NumBatches more
+    // submissions.
     struct DZ_API FlushUpdatesResult
     {
-        IFence     *Fence;
-        ISemaphore *Semaphore;
+        IFence     *Fence     = nullptr;
+        ISemaphore *Semaphore = nullptr;
     };
 
-    class StagingBuffer : public NonCopyable
+    // Handed to StagedCopyDesc's callbacks, Data is the mapped staging memory at Offset into Buffer
+    struct DZ_API StagedCopy
     {
-        std::unique_ptr<IBufferResource> m_buffer;
-        uint64_t                         m_currentOffset;
-        uint64_t                         m_totalNumBytes;
-        UpdateHandle                     m_lastHandle;
+        ICommandList    *CommandList = nullptr; // Copy command list the staging memory is submitted with, null in Fill
+        IBufferResource *Buffer      = nullptr; // Null when no staging memory was requested
+        uint64_t         Offset      = 0;
+        Byte            *Data        = nullptr;
+    };
 
-    public:
-        StagingBuffer( ILogicalDevice *device, uint64_t numBytes );
-        ~StagingBuffer( ) = default;
-        bool             CanFit( uint64_t size ) const;
-        void            *Map( ) const;
-        void             Unmap( ) const;
-        void             Reset( );
-        IBufferResource *GetBuffer( ) const;
-        uint64_t         GetOffset( ) const;
-        UpdateHandle     GetLastHandle( ) const;
-        void             Advance( uint64_t size, UpdateHandle handle );
+    using RecordStagedCopy = std::function<void( const StagedCopy &staged )>;
+
+    // For layouts the update descs don't cover. Neither callback may call back into the loader.
+    struct DZ_API StagedCopyDesc
+    {
+        uint64_t NumBytes  = 0; // 0 for copies between GPU resources, Fill is not called then
+        uint64_t Alignment = 1;
+        // Writes the staging memory, runs without the loader locked so it can read from disk
+        RecordStagedCopy Fill;
+        // Records the copies out of the staging memory, runs while recording is locked
+        RecordStagedCopy Record;
     };
 
-    class GpuResourceLoader
+    /// Uploads buffers and textures on a dedicated copy queue without blocking the caller. Updates are staged in a StagingRing, recorded
+    /// into the current batch and submitted by FlushResourceUpdates, or earlier when the ring is full. Batches rotate, only recording into
+    /// one that is still in flight waits for the GPU.
+    /// Handles can be polled with IsUpdateComplete or waited on with WaitForUpdate, the queue that uses the resources should wait on
+    /// the semaphore returned by FlushResourceUpdates and transition them out of CopyDst.
+    /// Threading: every function can be called from any thread. Recording is serialized, staging memory is written outside of the lock.
+    /// Batches are retired by polling their fences whenever the loader is used, only running out of batches or staging memory and the
+    /// Wait functions block on a fence.
+    /// BatchResourceCopy wraps a loader, Shared( device ) by default, for callers that want to block until the copies and their barriers
+    /// are done.
+    class GpuResourceLoader : public NonCopyable
     {
-        ILogicalDevice                             *m_device;
-        std::vector<std::unique_ptr<StagingBuffer>> m_stagingBuffers;
-        std::unique_ptr<ICommandListPool>           m_commandPool;
-        std::vector<ICommandList *>                 m_commandLists;
-        std::unique_ptr<IFence>                     m_executeFence;
-        std::unique_ptr<ISemaphore>                 m_copyCompleteSemaphore;
-        UpdateHandle                                m_nextHandle;
-
-        struct UpdateOperation
+        struct StagingAllocation
         {
-            UpdateHandle Handle;
-            IFence      *Fence;
+            IBufferResource *Buffer = nullptr;
+            uint64_t         Offset = 0;
+            Byte            *Data   = nullptr;
         };
-        std::queue<UpdateOperation> m_pendingOperations;
-        std::mutex                  m_operationMutex;
 
-    public:
-        DZ_API explicit GpuResourceLoader( const GpuResourceLoaderDesc &desc );
-        DZ_API ~GpuResourceLoader( ) = default;
-
-        DZ_API IBufferResource  *LoadResource( const BufferLoadDesc *BufferDesc, UpdateHandle *Handle = nullptr );
-        DZ_API ITextureResource *LoadResource( const TextureLoadDesc *TextureDesc, UpdateHandle *Handle = nullptr );
+        struct UploadBatch
+        {
+            ICommandList               *CommandList = nullptr;
+            std::unique_ptr<IFence>     Fence;
+            std::unique_ptr<ISemaphore> Semaphore;
+            std::vector<uint64_t>       RingPositions; // Released once Fence signals
+            // Updates that don't fit the ring, mapped while recording
+            std::vector<std::unique_ptr<IBufferResource>> DedicatedBuffers;
+            uint64_t                                      CompletesHandle = 0; // Every handle up to this one is done once Fence signals
+            uint64_t                                      SubmitIndex     = 0; // Batches retire in the order they were submitted
+            uint32_t                                      PendingFills    = 0; // Staging memory written outside of the lock, blocks submission
+            bool                                          IsRecording     = false;
+            bool                                          IsInFlight      = false;
+        };
 
-        DZ_API void               QueueResourceUpdate( const BufferUpdateDesc *UpdateDesc, UpdateHandle *Handle = nullptr );
-        DZ_API void               QueueResourceUpdate( const TextureUpdateDesc *UpdateDesc, UpdateHandle *Handle = nullptr );
-        DZ_API FlushUpdatesResult FlushResourceUpdates( const FlushUpdatesDesc *Desc );
+        GpuResourceLoaderDesc                     m_desc;
+        ILogicalDevice                           *m_device;
+        std::unique_ptr<ICommandQueue>            m_copyQueue;
+        std::unique_ptr<ICommandListPool>         m_commandPool;
+        std::unique_ptr<StagingRing>              m_stagingRing;
+        std::vector<std::unique_ptr<UploadBatch>> m_batches;
+        uint32_t                                  m_currentBatch = 0;
+        uint64_t                                  m_nextHandle   = 1;
+        uint64_t                                  m_nextSubmit   = 0;
+        std::atomic<uint64_t>                     m_lastSubmittedHandle{ 0 };
+        std::atomic<uint64_t>                     m_lastCompletedHandle{ 0 };
+        ISemaphore                               *m_lastSubmittedSemaphore   = nullptr;
+        bool                                      m_hasUnsignaledSubmissions = false; // Submitted because a staging buffer was full
+        mutable std::mutex                        m_operationMutex;
+        std::condition_variable                   m_fillsDone;
+
+        using OperationLock = std::unique_lock<std::mutex>;
+
+        UploadBatch      &BeginRecording( );
+        UploadBatch      *OldestInFlightBatch( ) const;
+        void              RetireCompletedBatches( );
+        void              WaitForBatch( const UploadBatch &batch );
+        void              RetireBatch( UploadBatch &batch );
+        void              DrainCurrentBatch( OperationLock &lock );
+        void              SubmitBatch( UploadBatch &batch, uint64_t completesHandle, const ISemaphoreArray &waitSemaphores, const ISemaphoreArray &signalSemaphores );
+        void              SubmitRecorded( OperationLock &lock );
+        StagingAllocation AllocateStaging( OperationLock &lock, uint64_t numBytes, uint64_t alignment );
+        UpdateHandle      QueueCopy( uint64_t numBytes, uint64_t alignment, const RecordStagedCopy &fill, const RecordStagedCopy &record );
+        UpdateHandle      QueueTextureUpdate( const TextureUpdateDesc &updateDesc );
+        void              PublishCompletedHandle( uint64_t handle );
 
-        DZ_API bool IsUpdateComplete( const UpdateHandle *Handle );
-        DZ_API void WaitForUpdate( const UpdateHandle *Handle );
-        DZ_API int  PendingUpdates( ) const;
-        DZ_API void WaitForAllUpdates( );
+    public:
+        DZ_API explicit GpuResourceLoader( const GpuResourceLoaderDesc &desc );
+        DZ_API ~GpuResourceLoader( );
+
+        // One loader per device with the default desc, created on first use. BatchResourceCopy uses it unless it is given a loader.
+        DZ_API static GpuResourceLoader *Shared( ILogicalDevice *device );
+        // Waits for the shared loader's updates and destroys it, the logical devices call this before they are destroyed
+        DZ_API static void ReleaseShared( ILogicalDevice *device );
+
+        // Resources are created in the CopyDst state and are ready to use once handle is complete
+        DZ_API IBufferResource  *LoadResource( const BufferLoadDesc &loadDesc, UpdateHandle *handle = nullptr );
+        DZ_API ITextureResource *LoadResource( const TextureLoadDesc &loadDesc, UpdateHandle *handle = nullptr );
+
+        DZ_API void               QueueResourceUpdate( const BufferUpdateDesc &updateDesc, UpdateHandle *handle = nullptr );
+        DZ_API void               QueueResourceUpdate( const TextureUpdateDesc &updateDesc, UpdateHandle *handle = nullptr );
+        DZ_API void               QueueStagedCopy( const StagedCopyDesc &copyDesc, UpdateHandle *handle = nullptr );
+        DZ_API FlushUpdatesResult FlushResourceUpdates( const FlushUpdatesDesc &flushDesc = { } );
+
+        // Never blocks, retires the batches whose fences signaled unless another thread is recording
+        DZ_API [[nodiscard]] bool IsUpdateComplete( const UpdateHandle &handle );
+        // Submits the update first if it is still recording
+        DZ_API void                   WaitForUpdate( const UpdateHandle &handle );
+        DZ_API [[nodiscard]] uint64_t PendingUpdates( ) const;
+        DZ_API void                   WaitForAllUpdates( );
+        // Only waits for submitted copies, recorded ones stay recorded
         DZ_API void WaitForCopyQueue( );
 
-        DZ_API UpdateHandle GetLastCompletedHandle( ) const;
-        DZ_API UpdateHandle GetLastSubmittedHandle( ) const;
-        DZ_API bool         IsHandleSubmitted( const UpdateHandle *Handle ) const;
-        DZ_API void         WaitForHandleSubmission( const UpdateHandle *Handle );
-        DZ_API ISemaphore  *GetLastSubmittedSemaphore( uint32_t NodeIndex ) const;
+        DZ_API [[nodiscard]] UpdateHandle GetLastCompletedHandle( ) const;
+        DZ_API [[nodiscard]] UpdateHandle GetLastSubmittedHandle( ) const;
+        DZ_API [[nodiscard]] bool         IsHandleSubmitted( const UpdateHandle &handle ) const;
+        DZ_API void                       WaitForHandleSubmission( const UpdateHandle &handle );
+        // Semaphore of the last FlushResourceUpdates, nullptr if it had nothing to submit
+        DZ_API [[nodiscard]] ISemaphore *GetLastSubmittedSemaphore( ) const;
     };
 } // namespace DenOfIz
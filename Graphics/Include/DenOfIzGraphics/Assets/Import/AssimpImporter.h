@@ -24,6 +24,7 @@ along with this program. If not, see <https://www.gnu.org/licenses/>.
 
 namespace DenOfIz
 {
+    class ImportCache;
 
     struct DZ_API AssimpImportDesc
     {
@@ -59,6 +60,11 @@ namespace DenOfIz
         bool     CalculateTangentSpace    = true;
 
         InteropStringArray AdditionalOptions;
+        // External textures that were already imported, SourceFilePath as returned by GetExternalTextures. Materials reference these
+        // instead of importing the texture again
+        ImportedAssetArray ImportedTextures{ };
+
+        ImportCache *Cache = nullptr; // Not required, skips the import if this source was imported before and nothing changed
     };
 
     class AssimpImporter
@@ -72,6 +78,9 @@ namespace DenOfIz
         DZ_API [[nodiscard]] bool               CanProcessFileExtension( const InteropString &extension ) const;
         DZ_API [[nodiscard]] ImporterResult     Import( const AssimpImportDesc &desc ) const;
         DZ_API [[nodiscard]] bool               ValidateFile( const InteropString &filePath ) const;
+        // Absolute paths of the texture files the materials of a model reference, loads the file without post processing. The result
+        // is valid until the next call
+        DZ_API [[nodiscard]] InteropStringArray GetExternalTextures( const InteropString &sourceFilePath ) const;
 
     private:
         class Impl;
@@ -0,0 +1,74 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <memory>
+#include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
+#include "DenOfIzGraphics/Assets/Import/AssimpImporter.h"
+#include "DenOfIzGraphics/Assets/Import/FontImporter.h"
+#include "DenOfIzGraphics/Assets/Import/ImportCache.h"
+#include "DenOfIzGraphics/Assets/Import/ImporterCommon.h"
+#include "DenOfIzGraphics/Assets/Import/TextureImporter.h"
+#include "DenOfIzGraphics/Assets/Import/VGImporter.h"
+
+namespace DenOfIz
+{
+    struct DZ_API BatchImportDesc
+    {
+        // Every file in SourceDirectory that one of the importers supports is imported, files it doesn't are skipped
+        InteropString SourceDirectory;
+        bool          Recursive = true;
+        // Used instead of SourceDirectory when set, a text file with one source file per line. Empty lines and lines starting with
+        // '#' are ignored, relative paths are relative to the manifest
+        InteropString ManifestPath;
+        InteropString TargetDirectory;
+        InteropString AssetNamePrefix;
+        // Not required, created assets are added as soon as their import finishes and the bundle is saved at the end
+        Bundle *TargetBundle = nullptr;
+        // Not required, models and textures that were imported before and didn't change are reused instead of imported again
+        ImportCache *Cache = nullptr;
+
+        // Options for each kind of source file, SourceFilePath, TargetDirectory and AssetNamePrefix are set per file
+        AssimpImportDesc  ModelDesc;
+        TextureImportDesc TextureDesc;
+        FontImportDesc    FontDesc;
+        VGImportDesc      VGDesc;
+    };
+
+    /// Imports many source files at once on the JobSystem. Models are scanned for the external textures their materials reference
+    /// first, each texture is imported once as its own job and the models that use it are imported after it with the texture asset
+    /// instead of importing their own copy. Everything else runs in parallel.
+    /// Shaders are not imported, ShaderImporter compiles a described program rather than a source file.
+    /// Assets are written to TargetDirectory by source file name, sources that would create the same asset file, e.g. a/rock.png and
+    /// b/rock.png, fail the import with InvalidParameters before anything is imported.
+    class BatchImporter
+    {
+    public:
+        DZ_API BatchImporter( );
+        DZ_API ~BatchImporter( );
+
+        // Imports continue after a failure, the result holds the first error and every asset that was created
+        DZ_API ImporterResult Import( const BatchImportDesc &desc ) const;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> m_pImpl;
+    };
+} // namespace DenOfIz
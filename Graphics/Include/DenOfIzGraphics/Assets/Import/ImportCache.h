@@ -0,0 +1,91 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "DenOfIzGraphics/Assets/Serde/Asset.h"
+#include "DenOfIzGraphics/Utilities/Common_Macro.h"
+
+namespace DenOfIz
+{
+    // What an import read and wrote, importers pass it to ImportCache::Store after a successful import
+    struct ImportCacheRecord
+    {
+        std::string              SourceFilePath;
+        uint64_t                 ImporterHash = 0; // Importer name and version
+        uint64_t                 OptionsHash  = 0; // Every import desc field that changes the output
+        std::vector<std::string> InputFiles;       // Every file the import read, including SourceFilePath
+        std::vector<std::string> OutputFiles;      // Every file the import wrote
+        std::vector<AssetUri>    CreatedAssets;
+    };
+
+    /// Remembers the inputs and outputs of previous imports so importing an unchanged source again reuses the assets written last
+    /// time. Set it on AssimpImportDesc::Cache, TextureImportDesc::Cache or BatchImportDesc::Cache and Save/Load it between runs.
+    /// An import is skipped when the importer version and options match, every file it read has the same content and every file it
+    /// wrote is still there unmodified. Files whose size and modification time match the cache are not hashed again, so checking an
+    /// unchanged source after a fresh checkout costs one read of its inputs and outputs and later checks cost a stat per file.
+    /// Find and Store are thread safe, Save, Load and Clear must not overlap with them.
+    class ImportCache : public NonCopyable
+    {
+        static constexpr uint64_t Magic   = 0x445A494D43414348; // "DZIMCACH"
+        static constexpr uint32_t Version = 1;
+
+        struct FileStamp
+        {
+            std::string Path;
+            uint64_t    NumBytes    = 0;
+            int64_t     WriteTime   = 0;
+            uint64_t    ContentHash = 0;
+        };
+
+        struct Entry
+        {
+            uint64_t               ImporterHash = 0;
+            uint64_t               OptionsHash  = 0;
+            std::vector<FileStamp> Inputs;
+            std::vector<FileStamp> Outputs;
+            std::vector<AssetUri>  CreatedAssets;
+        };
+
+        std::mutex                             m_mutex;
+        std::unordered_map<std::string, Entry> m_entries; // Keyed by the canonical source path
+
+        static std::string Key( const std::string &sourceFilePath );
+        static bool        Stamp( const std::string &path, FileStamp &outStamp );
+        static bool        IsUnchanged( FileStamp &stamp );
+
+    public:
+        DZ_API ImportCache( ) = default;
+
+        // Returns true if sourceFilePath was imported before with the same importer and options and nothing changed since, the assets
+        // created back then are returned in outCreatedAssets
+        bool Find( const std::string &sourceFilePath, uint64_t importerHash, uint64_t optionsHash, std::vector<AssetUri> &outCreatedAssets );
+        void Store( const ImportCacheRecord &record );
+
+        [[nodiscard]] DZ_API uint32_t NumEntries( );
+        DZ_API void                   Clear( );
+        DZ_API bool                   Save( const InteropString &path );
+        // Replaces the cached imports with the ones in the file
+        DZ_API bool Load( const InteropString &path );
+    };
+} // namespace DenOfIz
@@ -42,4 +42,17 @@ namespace DenOfIz
         AssetUriArray          CreatedAssets;
     };
 
+    // An asset imported ahead of time, importers that reference SourceFilePath use Uri instead of importing it again
+    struct DZ_API ImportedAsset
+    {
+        InteropString SourceFilePath;
+        AssetUri      Uri;
+    };
+
+    struct DZ_API ImportedAssetArray
+    {
+        ImportedAsset *Elements;
+        uint32_t       NumElements;
+    };
+
 } // namespace DenOfIz
\ No newline at end of file
@@ -28,15 +28,58 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace DenOfIz
 {
+    class ImportCache;
+
+    enum class TextureMipFilter
+    {
+        Box,   // Averages the texels each mip texel covers, cheapest but blurs and aliases more
+        Kaiser // Kaiser windowed sinc, keeps lower mips sharper, the default of most texture tools
+    };
+
+    // What the texture holds, picks the block compression format when Compression is Auto
+    enum class TextureRole
+    {
+        Color,  // Albedo, emissive etc., BC7
+        Normal, // Tangent space normals, BC5 keeps X and Y in R and G and shaders reconstruct Z
+        Mask    // Single channel data such as roughness or occlusion, BC4 keeps R
+    };
+
+    enum class TextureCompression
+    {
+        None,
+        Auto, // From TextureImportDesc::Role
+        BC1,  // RGB, 4 bits per texel
+        BC3,  // RGBA, 8 bits per texel
+        BC4,  // R, 4 bits per texel
+        BC5,  // RG, 8 bits per texel
+        BC7   // RGBA, 8 bits per texel, the best quality of the 8 bit formats
+    };
+
     struct DZ_API TextureImportDesc
     {
         InteropString SourceFilePath;
         InteropString TargetDirectory;
         InteropString AssetNamePrefix;
 
-        bool GenerateMips        = true;
+        // Builds the full mip chain of images decoded from png, jpg, tga, hdr etc. DDS files keep the mips they were saved with.
+        bool             GenerateMips = true;
+        TextureMipFilter MipFilter    = TextureMipFilter::Kaiser;
+        // Color data, mips are filtered in linear space and converted back to sRGB. Disable for normal, roughness and other data maps.
+        bool IsSrgb = true;
+        // Alpha tested textures get thinner in lower mips, this rescales the alpha of every mip so the same fraction of texels passes
+        // AlphaCoverageReference as in the source image
+        bool  PreserveAlphaCoverage  = false;
+        float AlphaCoverageReference = 0.5f;
+
+        // Applies to images decoded by stb with both sides a multiple of 4, others are written uncompressed. Like the uncompressed
+        // R8G8B8A8Unorm the compressed formats are Unorm, color stays sRGB encoded and shaders see the same values either way.
+        TextureRole        Role        = TextureRole::Color;
+        TextureCompression Compression = TextureCompression::None;
+
         bool NormalizeNormalMaps = true;
         bool FlipY               = false;
+
+        ImportCache *Cache = nullptr; // Not required, skips the import if this source was imported before and nothing changed
     };
 
     class TextureImporter
@@ -21,6 +21,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphics/Backends/Interface/CommonData.h"
 #include "DenOfIzGraphics/Utilities/Common_Arrays.h"
 #include "DenOfIzGraphics/Utilities/InteropMath.h"
+#include "DenOfIzGraphics/Utilities/InternedString.h"
 
 namespace DenOfIz
 {
@@ -36,6 +37,10 @@ namespace DenOfIz
         static AssetUri             Create( const InteropString &path );
         [[nodiscard]] InteropString ToInteropString( ) const; // Not using ToString() intentionally to avoid conflict with bindings
         [[nodiscard]] bool          Equals( const AssetUri &other ) const;
+        // Hash of ToInteropString( ) computed without building the string, stable across runs so it can be stored on disk
+        [[nodiscard]] uint64_t Hash( ) const;
+        // Interned ToInteropString( ), for uris that are compared or used as map keys repeatedly
+        [[nodiscard]] InternedString Intern( ) const;
     };
 
     struct DZ_API AssetUriArray
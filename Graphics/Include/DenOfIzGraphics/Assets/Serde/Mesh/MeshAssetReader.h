@@ -33,6 +33,56 @@ namespace DenOfIz
         uint32_t        DstMemoryOffset{ };
     };
 
+    enum class VertexAttributeSemantic
+    {
+        Position,
+        Normal,
+        UV,
+        Color,
+        Tangent,
+        Bitangent,
+        BlendIndices,
+        BlendWeights
+    };
+
+    /// Places one serialized vertex attribute into a decode target. Float attributes accept 32/16 bit float and 8/16 bit
+    /// normalized formats, BlendIndices accept 32/16/8 bit uint formats. Missing components are filled with 0 (alpha with 1).
+    struct DZ_API VertexAttributeLayoutDesc
+    {
+        VertexAttributeSemantic Semantic      = VertexAttributeSemantic::Position;
+        uint32_t                SemanticIndex = 0; // UV channel or color set
+        Format                  Format        = Format::R32G32B32A32Float;
+        uint32_t                TargetIndex   = 0; // Index into DecodeVerticesDesc::Targets
+        uint32_t                Offset        = 0; // Byte offset of the attribute within one vertex of the target
+    };
+
+    struct DZ_API VertexAttributeLayoutDescArray
+    {
+        VertexAttributeLayoutDesc *Elements;
+        size_t                     NumElements;
+    };
+
+    struct DZ_API VertexDecodeTarget
+    {
+        ByteArray Memory{ };
+        uint32_t  Stride = 0;
+    };
+
+    struct DZ_API VertexDecodeTargetArray
+    {
+        VertexDecodeTarget *Elements;
+        size_t              NumElements;
+    };
+
+    /// Interleaved layouts use a single target with every attribute at its own Offset, split (SoA) layouts use one target per
+    /// attribute. Attributes not listed are skipped.
+    struct DZ_API DecodeVerticesDesc
+    {
+        AssetDataStream                Stream{ };
+        VertexAttributeLayoutDescArray Attributes{ };
+        VertexDecodeTargetArray        Targets{ };
+    };
+
     struct DZ_API MeshAssetReaderDesc
     {
         BinaryReader *Reader;
@@ -46,11 +96,20 @@ namespace DenOfIz
         bool                m_metadataRead         = false;
         uint64_t            m_dataBlockStartOffset = 0;
 
+        struct VertexAttributeSource
+        {
+            uint32_t Offset        = 0;
+            uint32_t NumComponents = 0;
+            bool     IsUInt        = false;
+            Float_4  Defaults{ 0.0f, 0.0f, 0.0f, 0.0f };
+        };
+
         SubMeshData                    ReadCompleteSubMeshData( ) const;
         MorphTarget                    ReadCompleteMorphTargetData( ) const;
         BoundingVolume                 ReadBoundingVolume( ) const;
         [[nodiscard]] MeshVertex       ReadSingleVertex( ) const;
         [[nodiscard]] MorphTargetDelta ReadSingleMorphTargetDelta( ) const;
+        bool                           FindVertexAttribute( VertexAttributeSemantic semantic, uint32_t semanticIndex, VertexAttributeSource &source ) const;
 
     public:
         DZ_API explicit MeshAssetReader( const MeshAssetReaderDesc &desc );
@@ -66,6 +125,10 @@ namespace DenOfIz
         [[nodiscard]] DZ_API size_t NumConvexHulls( const AssetDataStream &stream ) const;
 
         [[nodiscard]] DZ_API void ReadVertices( const AssetDataStream &stream, const MeshVertexArray &result ) const;
+        /// Decodes a whole vertex stream into caller provided memory in the requested layout, returns the number of vertices decoded
+        /// or 0 if the layout is invalid. Targets must hold at least NumVertices( stream ) vertices. Decoding stops early if the
+        /// stream can't be read or a blend index doesn't fit its format.
+        DZ_API uint64_t DecodeVertices( const DecodeVerticesDesc &desc ) const;
         [[nodiscard]] DZ_API void ReadIndices16( const AssetDataStream &stream, const UInt16Array &result ) const;
         [[nodiscard]] DZ_API void ReadIndices32( const AssetDataStream &stream, const UInt32Array &result ) const;
         [[nodiscard]] DZ_API void ReadMorphTargetDeltas( const AssetDataStream &stream, const MorphTargetDeltaArray &result ) const;
@@ -34,8 +34,15 @@ namespace DenOfIz
     struct DZ_API LoadIntoGpuTextureDesc
     {
         ICommandList     *CommandList;
-        IBufferResource  *StagingBuffer; // Should be large enough to hold all mip layers
+        IBufferResource  *StagingBuffer;           // Should be large enough to hold all mip layers, see AlignedTotalNumBytes
+        uint64_t          StagingBufferOffset = 0; // Aligned to DeviceConstants::BufferTextureAlignment
         ITextureResource *Texture;
+        // Set when StagingBuffer is already mapped, this is its start. Otherwise the buffer is mapped and unmapped by LoadIntoGpuTexture.
+        Byte *MappedStagingBuffer = nullptr;
+        // Rows and mips are placed in the staging buffer at these alignments, pass the same constants given to AlignedTotalNumBytes
+        DeviceConstants Constants{ };
+        // Mips before this one are skipped and FirstMip is copied to mip 0 of Texture, which only has the remaining mips
+        uint32_t FirstMip = 0;
     };
 
     class TextureAssetReader
@@ -45,6 +52,7 @@ namespace DenOfIz
         bool          m_textureRead = false;
 
         TextureMip FindMip( const uint32_t mipLevel, const uint32_t arrayLayer ) const;
+        void       LoadMips( const LoadIntoGpuTextureDesc &desc, bool readMips, bool recordCopies ) const;
 
     public:
         DZ_API explicit TextureAssetReader( const TextureAssetReaderDesc &desc );
@@ -52,7 +60,10 @@ namespace DenOfIz
 
         DZ_API TextureAsset *Read( );
         DZ_API void          LoadIntoGpuTexture( const LoadIntoGpuTextureDesc &desc ) const;
+        // LoadIntoGpuTexture in two steps, so the reads can run without holding what records the copies. CommandList is not used by the read.
+        DZ_API void          ReadIntoStagingBuffer( const LoadIntoGpuTextureDesc &desc ) const;
+        DZ_API void          RecordGpuTextureCopies( const LoadIntoGpuTextureDesc &desc ) const;
         DZ_API ByteArray     ReadRaw( const uint32_t mipLevel = 0, const uint32_t arrayLayer = 0 ) const;
-        DZ_API uint64_t      AlignedTotalNumBytes( const DeviceConstants &constants ) const;
+        DZ_API uint64_t      AlignedTotalNumBytes( const DeviceConstants &constants, uint32_t firstMip = 0 ) const;
     };
 } // namespace DenOfIz
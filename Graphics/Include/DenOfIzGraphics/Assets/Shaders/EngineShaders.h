@@ -0,0 +1,81 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "DenOfIzGraphics/Utilities/Interop.h"
+
+namespace DenOfIz
+{
+    class Bundle;
+    class ShaderProgram;
+
+    // Shaders the engine creates on its own for its renderers
+    enum class EngineShader
+    {
+        Text,           // TextRenderer
+        UI,             // ClayRenderer, MaxNumTextures is ClayRendererDesc::MaxTextures
+        FullscreenQuad, // FullscreenQuadPipeline
+        Quad            // QuadRenderer, MaxNumTextures is QuadRendererDesc::MaxNumTextures
+    };
+
+    // The size of the bindless texture array ends up in the reflection, each size is a separate asset
+    struct DZ_API EngineShaderVariant
+    {
+        EngineShader Shader;
+        uint32_t     MaxNumTextures = 0; // 0 uses the renderer default, ignored by shaders without bindless textures
+    };
+
+    struct DZ_API EngineShaderVariantArray
+    {
+        EngineShaderVariant *Elements;
+        uint32_t             NumElements;
+    };
+
+    struct DZ_API EngineShaderBuildDesc
+    {
+        InteropString            TargetDirectory;        // .dzshader assets are written here, named by EngineShaders::AssetName
+        Bundle                  *TargetBundle = nullptr; // Optional, the assets are also added to this bundle which is then saved
+        EngineShaderVariantArray Variants{ };            // Empty builds every shader with the default renderer settings
+    };
+
+    // Where renderers look for precompiled engine shaders, the bundle first and then the directory
+    struct DZ_API EngineShaderSourceDesc
+    {
+        Bundle       *ShaderBundle = nullptr;
+        InteropString Directory;
+    };
+
+    /// Engine renderers create their shader programs through here. When a precompiled asset of the shader is found in the
+    /// source set by EngineDesc::Shaders or SetSource, the program is created from it and DXC is never invoked, otherwise the
+    /// shader is compiled from its embedded HLSL like before. Build is the offline step producing those assets, see the
+    /// EngineShaderBuilder tool.
+    class EngineShaders
+    {
+    public:
+        DZ_API static bool Build( const EngineShaderBuildDesc &desc );
+        // Programs created afterwards only use assets of the new source, none loaded from a previous one are reused
+        DZ_API static void SetSource( const EngineShaderSourceDesc &desc );
+        // Owned by the caller. Loaded assets are kept until exit since programs created from them reference their reflection.
+        DZ_API static ShaderProgram *CreateProgram( const EngineShaderVariant &variant );
+        // File name of the asset, also its path within a bundle. Ends with a hash of the embedded HLSL, so an asset built before
+        // the shader changed is not found and the shader is compiled at runtime instead.
+        DZ_API static InteropString AssetName( const EngineShaderVariant &variant );
+    };
+} // namespace DenOfIz
@@ -0,0 +1,69 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <string>
+#include "DenOfIzGraphics/Assets/Shaders/ShaderCompiler.h"
+#include "DenOfIzGraphics/Utilities/Common_Macro.h"
+
+namespace DenOfIz
+{
+    struct DZ_API ShaderCacheKey
+    {
+        uint64_t High = 0;
+        uint64_t Low  = 0;
+    };
+
+    struct DZ_API ShaderCacheDesc
+    {
+        InteropString Directory; // Created if it doesn't exist, can be shared between processes
+    };
+
+    /// Content addressed store of compiled shaders, each entry is a file in ShaderCacheDesc::Directory named after its key.
+    /// Set it on ShaderProgramDesc::Cache or CompileDesc::Cache, ShaderCompiler keys entries by the preprocessed source with all
+    /// includes resolved, the arguments(entry point, target profile, defines, target IL) and the compiler version, so changing any
+    /// of them, including an included file, compiles again and nothing has to be invalidated by hand.
+    /// Threading: all methods can be called concurrently from any thread and any process using the same directory, entries are written
+    /// to a temporary file and renamed into place so a reader either sees a complete entry or none.
+    class ShaderCache : public NonCopyable
+    {
+        static constexpr uint64_t Magic   = 0x445A534843414348; // "DZSHCACH"
+        static constexpr uint32_t Version = 1;
+
+        InteropString m_directory;
+
+        [[nodiscard]] std::string EntryPath( const ShaderCacheKey &key ) const;
+
+    public:
+        DZ_API explicit ShaderCache( const ShaderCacheDesc &desc );
+
+        // 128 bits of the key material, collisions are not expected for the amount of shaders a project compiles
+        DZ_API static ShaderCacheKey Key( const ByteArrayView &keyData );
+
+        // The blobs of outResult are allocated with malloc and owned by the caller, the same as results of ShaderCompiler::CompileHLSL.
+        // Missing, truncated or corrupted entries are a miss.
+        DZ_API [[nodiscard]] bool Load( const ShaderCacheKey &key, CompileResult &outResult ) const;
+        DZ_API bool               Store( const ShaderCacheKey &key, const CompileResult &result ) const;
+        DZ_API [[nodiscard]] bool Contains( const ShaderCacheKey &key ) const;
+        // Removes every entry, must not overlap with Store
+        DZ_API void                               Clear( ) const;
+        DZ_API [[nodiscard]] const InteropString &GetDirectory( ) const;
+    };
+} // namespace DenOfIz
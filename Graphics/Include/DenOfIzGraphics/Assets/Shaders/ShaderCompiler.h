@@ -6,6 +6,8 @@
 
 namespace DenOfIz
 {
+    class ShaderCache;
+
     struct DZ_API CompileDesc
     {
         InteropString Path;
@@ -15,6 +17,7 @@ namespace DenOfIz
         ShaderStage   Stage;
         TargetIL      TargetIL;
         StringArray   Defines;
+        ShaderCache  *Cache = nullptr; // Optional, compiled code and reflection are reused while the preprocessed source is unchanged
     };
 
     struct DZ_API CompileResult
@@ -18,24 +18,32 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
-#include <sstream>
 #include "DenOfIzGraphics/Utilities/Common.h"
 
 #include "DenOfIzGraphics/Utilities/Common_Arrays.h"
 
 namespace DenOfIz
 {
-    class BinaryContainer
+    // Growable in memory buffer for BinaryWriter/BinaryReader. Readers view the buffer directly and pick up its current location on every
+    // read, so writing while a reader is open is fine as long as the two don't run on different threads.
+    class BinaryContainer : public NonCopyable
     {
-        std::stringstream m_stream;
-        mutable std::string m_cachedData; // Cache the string data to avoid dangling pointer
+        Byte    *m_data     = nullptr;
+        uint64_t m_numBytes = 0;
+        uint64_t m_capacity = 0;
 
         friend class BinaryWriter;
         friend class BinaryReader;
 
+        void WriteAt( uint64_t position, const Byte *data, uint64_t count );
+
     public:
         DZ_API explicit BinaryContainer( );
+        DZ_API explicit BinaryContainer( uint64_t reserveNumBytes );
         DZ_API ~BinaryContainer( );
+        DZ_API void                        Reserve( uint64_t numBytes );
+        DZ_API void                        Clear( );
+        DZ_API [[nodiscard]] uint64_t      NumBytes( ) const;
         DZ_API [[nodiscard]] ByteArrayView GetData( ) const;
     };
 } // namespace DenOfIz
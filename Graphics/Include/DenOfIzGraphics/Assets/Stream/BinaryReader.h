@@ -18,7 +18,12 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <bit>
+#include <cstring>
 #include <istream>
+#include <memory>
+#include <span>
+#include <type_traits>
 #include "BinaryContainer.h"
 #include "DenOfIzGraphics/Utilities/Common_Arrays.h"
 #include "DenOfIzGraphics/Utilities/Interop.h"
@@ -29,22 +34,32 @@ namespace DenOfIz
     struct DZ_API BinaryReaderDesc
     {
         uint64_t NumBytes = 0; // 0, reading more than this amount of bytes won't be allowed
+        // Only applies to ByteArrayView sources, when false the reader is a view over the data which must outlive the reader
+        bool CopyData = true;
     };
 
     class BinaryReader
     {
-        uint64_t      m_allowedNumBytes;
-        uint64_t      m_readNumBytes  = 0;
-        bool          m_isStreamOwned = false;
-        bool          m_isStreamValid;
-        bool          m_isStringStream = false;
-        std::istream *m_stream;
+        uint64_t               m_allowedNumBytes;
+        uint64_t               m_readNumBytes  = 0;
+        bool                   m_isStreamOwned = false;
+        bool                   m_isStreamValid;
+        std::istream          *m_stream = nullptr;
+        // Memory backed readers(ByteArrayView and BinaryContainer sources) read directly from m_data instead of going through m_stream
+        mutable const Byte    *m_data         = nullptr;
+        Byte                  *m_ownedData    = nullptr;
+        mutable uint64_t       m_dataNumBytes = 0;
+        mutable uint64_t       m_dataPosition = 0;
+        const BinaryContainer *m_container    = nullptr; // Re-fetched before every read, writes after opening may grow and move the buffer
 
     public:
         explicit BinaryReader( std::istream *stream, const BinaryReaderDesc &desc = { } );
+        explicit BinaryReader( std::unique_ptr<std::istream> stream, const BinaryReaderDesc &desc = { } );
         DZ_API explicit BinaryReader( BinaryContainer &container, const BinaryReaderDesc &desc = { } );
         DZ_API explicit BinaryReader( const InteropString &filePath, const BinaryReaderDesc &desc = { } );
         DZ_API explicit BinaryReader( const ByteArrayView &data, const BinaryReaderDesc &desc = { } );
+        // Takes ownership of data without copying, it must be allocated with std::malloc like ReadAllBytes results. CopyData is ignored
+        explicit BinaryReader( const ByteArray &data, const BinaryReaderDesc &desc = { } );
         DZ_API ~BinaryReader( );
 
         [[nodiscard]] DZ_API int           ReadByte( );
@@ -80,12 +95,65 @@ namespace DenOfIz
         DZ_API void                        Seek( uint64_t position ) const;
         DZ_API void                        Skip( uint64_t count ) const;
 
+        // Bulk reads for arrays of T. T must be trivially copyable and written as its 8, 16 and 32 bit members, 64 bit values are
+        // written high word first by BinaryWriter and can't be read this way. Memory backed readers turn this into a single memcpy.
+        template <typename T>
+        bool ReadArray( T *destination, const size_t count )
+        {
+            static_assert( std::is_trivially_copyable_v<T> );
+            static_assert( std::endian::native == std::endian::little, "Bulk reads assume the serialized little endian layout matches memory" );
+            return ReadExact( reinterpret_cast<Byte *>( destination ), count * sizeof( T ) );
+        }
+
+        template <typename T>
+        bool ReadInto( std::span<T> destination )
+        {
+            return ReadArray( destination.data( ), destination.size( ) );
+        }
+
         // Utility function to log data as a C++ array for embedding in code
         DZ_API void LogAsCppArray( const InteropString &variableName = "Data" ) const;
         DZ_API void WriteCppArrayToFile( const InteropString &targetFile = "Data.txt" ) const;
 
     private:
         [[nodiscard]] bool IsStreamValid( ) const;
-        bool               TrackReadBytes( uint32_t requested );
+        [[nodiscard]] bool IsMemoryBacked( ) const;
+        bool               TrackReadBytes( uint64_t requested );
+        uint64_t           ReadRaw( Byte *destination, uint64_t count );
+        bool               ReadExactSlow( Byte *destination, uint64_t count );
+
+        template <typename T>
+        T ReadValue( )
+        {
+            T value{ };
+            if ( !ReadArray( &value, 1 ) )
+            {
+                return T{ };
+            }
+            return value;
+        }
+
+        void RefreshContainerView( ) const
+        {
+            if ( m_container != nullptr )
+            {
+                m_data         = m_container->m_data;
+                m_dataNumBytes = m_container->m_numBytes;
+            }
+        }
+
+        // Every read goes through here, in bounds reads from memory are inlined and everything else including error reporting is out of line
+        bool ReadExact( Byte *destination, const uint64_t count )
+        {
+            RefreshContainerView( );
+            if ( m_data != nullptr && count <= m_dataNumBytes - m_dataPosition && ( m_allowedNumBytes == 0 || m_readNumBytes + count <= m_allowedNumBytes ) )
+            {
+                std::memcpy( destination, m_data + m_dataPosition, count );
+                m_dataPosition += count;
+                m_readNumBytes += count;
+                return true;
+            }
+            return ReadExactSlow( destination, count );
+        }
     };
 } // namespace DenOfIz
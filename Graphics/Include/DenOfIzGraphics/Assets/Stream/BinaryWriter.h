@@ -34,11 +34,15 @@ namespace DenOfIz
         BinaryWriterDesc m_desc;
         bool             m_isStreamOwned = false;
         bool             m_isStreamValid;
-        std::ostream    *m_stream;
+        std::ostream    *m_stream            = nullptr;
+        BinaryContainer *m_container         = nullptr;
+        mutable uint64_t m_containerPosition = 0;
 
     public:
         // Non public api since std::ostream cannot be mapped
         explicit BinaryWriter( std::ostream *stream, const BinaryWriterDesc &desc = { } );
+        // Writes from the start of the container, Seek to container.NumBytes( ) to append. The container is only stored here so it may
+        // still be under construction, see AlignedDataWriter
         DZ_API explicit BinaryWriter( BinaryContainer &container, const BinaryWriterDesc &desc = { } );
         DZ_API explicit BinaryWriter( const InteropString &filePath, const BinaryWriterDesc &desc = { } );
         DZ_API ~BinaryWriter( );
@@ -74,5 +78,8 @@ namespace DenOfIz
         DZ_API [[nodiscard]] uint64_t Position( ) const;
         DZ_API void                   Seek( uint64_t position ) const;
         DZ_API void                   Flush( ) const;
+
+    private:
+        void WriteRaw( const Byte *data, uint64_t count ) const;
     };
 } // namespace DenOfIz
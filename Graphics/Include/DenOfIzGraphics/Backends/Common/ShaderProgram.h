@@ -43,10 +43,19 @@ namespace DenOfIz
         uint32_t                 NumElements;
     };
 
+    class ShaderCache;
+
     struct DZ_API ShaderProgramDesc
     {
         ShaderStageDescArray ShaderStages;
         ShaderRayTracingDesc RayTracing;
+        ShaderCache         *Cache = nullptr; // Optional, see CompileDesc::Cache
+    };
+
+    struct DZ_API ShaderProgramDescArray
+    {
+        ShaderProgramDesc *Elements;
+        uint32_t           NumElements;
     };
 
     struct DZ_API CompiledShader
@@ -63,7 +72,16 @@ namespace DenOfIz
         uint32_t        NumElements;
     };
     struct ShaderAsset;
+    class ShaderProgram;
 
+    struct DZ_API ShaderProgramArray
+    {
+        ShaderProgram **Elements;
+        uint32_t        NumElements;
+    };
+
+    /// Stages are compiled concurrently on the JobSystem, each thread uses its own DXC compiler. Results, including reflection, are
+    /// the same as compiling the stages one after another.
     class ShaderProgram
     {
     public:
@@ -76,6 +94,10 @@ namespace DenOfIz
         [[nodiscard]] DZ_API ShaderReflectDesc                   Reflect( ) const;
         [[nodiscard]] DZ_API ShaderProgramDesc                   Desc( ) const;
 
+        // Creates a program for each desc concurrently, outPrograms must have room for descs.NumElements programs which are then owned
+        // by the caller. If compiling any of them fails, none are returned.
+        DZ_API static void CreatePrograms( const ShaderProgramDescArray &descs, const ShaderProgramArray &outPrograms );
+
     private:
         class Impl;
         std::unique_ptr<Impl> m_pImpl;
@@ -29,7 +29,9 @@ namespace DenOfIz
     public:
         virtual void Wait( )  = 0;
         virtual void Reset( ) = 0;
-        virtual ~IFence( )    = default;
+        // Non blocking Wait, true once the work submitted to signal the fence is done
+        virtual bool IsSignaled( ) = 0;
+        virtual ~IFence( )         = default;
     };
 
 } // namespace DenOfIz
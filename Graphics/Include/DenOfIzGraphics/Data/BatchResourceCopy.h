@@ -18,13 +18,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
-#include <future>
 #include "Texture.h"
 
+#include "DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h"
 #include "DenOfIzGraphics/Assets/Serde/Mesh/MeshAssetReader.h"
 #include "DenOfIzGraphics/Assets/Serde/Texture/TextureAssetReader.h"
 #include "DenOfIzGraphics/Backends/Interface/ILogicalDevice.h"
 #include "DenOfIzGraphics/Data/Geometry.h"
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
 
 namespace DenOfIz
 {
@@ -57,6 +58,7 @@ namespace DenOfIz
     {
         TextureAssetReader *Reader;
         ITextureResource   *DstTexture;
+        uint32_t            FirstMip = 0; // DstTexture only has the mips from this one onwards, see LoadIntoGpuTextureDesc::FirstMip
     };
 
     struct DZ_API LoadAssetStreamToBufferDesc
@@ -75,6 +77,8 @@ namespace DenOfIz
         InteropString       DebugName;
     };
 
+    /// Copies are queued on a GpuResourceLoader and Submit blocks until they and the graphics queue barriers are done. Without a loader
+    /// the device's GpuResourceLoader::Shared one is used, so every batch shares its copy queue and staging ring.
     /// <code>
     /// { // Scope batch resource copy to make sure it waits for the copy to finish, will clean up resources too
     ///     BatchResourceCopy batchResourceCopy( logicalDevice );
@@ -85,34 +89,25 @@ namespace DenOfIz
     /// </code>
     class BatchResourceCopy : public NonCopyable
     {
-        ILogicalDevice *m_device;
-
-        std::unique_ptr<ICommandListPool> m_commandListPool;
-        ICommandList                     *m_copyCommandList;
-
-        std::unique_ptr<IFence>                       m_executeFence;
-        std::mutex                                    m_resourceCleanLock;
-        std::vector<std::unique_ptr<IBufferResource>> m_resourcesToClean;
-        std::vector<Byte *>                           m_freeTextures;
-        std::future<void>                             m_cleanResourcesFuture;
+        ILogicalDevice       *m_device;
+        GpuResourceLoader    *m_loader;
+        std::atomic<uint64_t> m_lastUpdate{ 0 }; // Newest UpdateHandle queued since Begin
         // Syncing
         std::unique_ptr<ICommandListPool> m_syncCommandPool;
         ICommandList                     *m_syncCommandList;
-        std::unique_ptr<ISemaphore>       m_batchCopyWait;
         std::unique_ptr<IFence>           m_syncWait;
         bool                              m_issueBarriers;
 
-        std::unique_ptr<ICommandQueue> m_copyQueue;
         std::unique_ptr<ICommandQueue> m_syncQueue;
 
     public:
-        DZ_API explicit BatchResourceCopy( ILogicalDevice *device, bool issueBarriers = true );
+        DZ_API explicit BatchResourceCopy( ILogicalDevice *device, bool issueBarriers = true, GpuResourceLoader *loader = nullptr );
         DZ_API ~BatchResourceCopy( );
 
         DZ_API void                           Begin( ) const;
         DZ_API void                           CopyToGPUBuffer( const CopyToGpuBufferDesc &copyDesc );
-        DZ_API void                           CopyBufferRegion( const CopyBufferRegionDesc &copyDesc ) const;
-        DZ_API void                           CopyTextureRegion( const CopyTextureRegionDesc &copyDesc ) const;
+        DZ_API void                           CopyBufferRegion( const CopyBufferRegionDesc &copyDesc );
+        DZ_API void                           CopyTextureRegion( const CopyTextureRegionDesc &copyDesc );
         DZ_API void                           CopyDataToTexture( const CopyDataToTextureDesc &copyDesc );
         DZ_API ITextureResource              *CreateAndLoadTexture( const InteropString &file );
         DZ_API ITextureResource              *CreateAndLoadAssetTexture( const CreateAssetTextureDesc &loadDesc );
@@ -125,11 +120,12 @@ namespace DenOfIz
         DZ_API void                           Submit( ISemaphore *notify = nullptr );
 
     private:
-        void                   CleanResources( );
-        void                   LoadTextureInternal( const Texture &texture, ITextureResource *dstTexture );
-        void                   AlignDataForTexture( const Byte *src, uint32_t width, uint32_t height, uint32_t bitsize, Byte *dst ) const;
-        void                   CopyTextureToMemoryAligned( const Texture &texture, const TextureMip &mipData, Byte *dst ) const;
-        [[nodiscard]] uint32_t GetSubresourceAlignment( uint32_t bitSize ) const;
-        static std::string     NextId( const std::string &prefix );
+        void                    QueueStagedCopy( const StagedCopyDesc &copyDesc );
+        void                    TrackUpdate( UpdateHandle handle );
+        void                    LoadTextureInternal( const Texture &texture, ITextureResource *dstTexture );
+        void                    AlignDataForTexture( const Byte *src, uint32_t width, uint32_t height, uint32_t bitsize, Byte *dst ) const;
+        void                    CopyTextureToMemoryAligned( const Texture &texture, const TextureMip &mipData, Byte *dst ) const;
+        [[nodiscard]] uint32_t  GetSubresourceAlignment( uint32_t bitSize ) const;
+        static std::string      NextId( const std::string &prefix );
     };
 } // namespace DenOfIz
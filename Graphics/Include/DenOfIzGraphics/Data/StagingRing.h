@@ -0,0 +1,82 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "DenOfIzGraphics/Backends/Interface/ILogicalDevice.h"
+
+namespace DenOfIz
+{
+    struct DZ_API StagingRingDesc
+    {
+        ILogicalDevice *Device   = nullptr;
+        uint64_t        NumBytes = 32ull * 1024 * 1024;
+    };
+
+    /// One persistently mapped upload buffer that GpuResourceLoader sub allocates its staging memory from instead of creating a buffer
+    /// per copy. Memory is handed out in order and returned once the batch that used it finished executing, so a single ring serves every
+    /// batch of the loader, including every BatchResourceCopy that shares it.
+    /// Copies larger than a quarter of the ring use a dedicated staging buffer instead. The ring never waits, when it is full the loader
+    /// retires the batches holding it.
+    class StagingRing : public NonCopyable
+    {
+        friend class GpuResourceLoader;
+
+        struct Allocation
+        {
+            IBufferResource *Buffer   = nullptr;
+            uint64_t         Offset   = 0; // Into Buffer
+            Byte            *Data     = nullptr;
+            uint64_t         Position = 0; // Identifies the allocation when it is released
+        };
+
+        struct Region
+        {
+            uint64_t Begin; // Positions grow forever, the offset into the buffer is Position % NumBytes
+            uint64_t End;
+            bool     IsReleased = false;
+        };
+
+        std::unique_ptr<IBufferResource> m_buffer;
+        Byte                            *m_mappedMemory = nullptr;
+        uint64_t                         m_numBytes     = 0;
+        uint64_t                         m_head         = 0;
+        uint64_t                         m_tail         = 0;
+        std::deque<Region>               m_regions; // Ordered by Begin, released regions stay until every older one is released
+        std::mutex                       m_mutex;
+
+        Region *FindRegion( uint64_t position );
+
+        [[nodiscard]] bool CanHold( uint64_t numBytes ) const;
+        // False while the ring is too full, release regions and try again. CanHold( numBytes ) must be true.
+        bool Allocate( uint64_t numBytes, uint64_t alignment, Allocation &allocation );
+        // The copies that used the regions must be done executing
+        void Release( const std::vector<uint64_t> &positions );
+
+    public:
+        DZ_API explicit StagingRing( const StagingRingDesc &desc );
+        DZ_API ~StagingRing( );
+
+        DZ_API [[nodiscard]] uint64_t NumBytes( ) const;
+    };
+} // namespace DenOfIz
@@ -0,0 +1,77 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+#include "DenOfIzGraphics/Assets/Serde/Texture/TextureAsset.h"
+#include "DenOfIzGraphics/Backends/Interface/ITextureResource.h"
+
+namespace DenOfIz
+{
+    struct DZ_API TextureResidencyPlannerDesc
+    {
+        // Bytes of mip data kept resident across every texture, tail mips count towards it but are never dropped
+        uint64_t MemoryBudget = 256ull * 1024 * 1024;
+        // The tail is every mip with both sides at most this size
+        uint32_t MaxTailSize = 64;
+    };
+
+    /// Picks the mip every streamed texture starts at, the CPU half of TextureStreamer. Requested mips are kept while they fit
+    /// MemoryBudget, otherwise the least recently requested textures fall back towards their tail first. Block compressed textures only
+    /// start at mips with sides that are a multiple of the block size.
+    /// Textures are identified by an index chosen by the caller, TextureStreamer uses its handle values.
+    class TextureResidencyPlanner : public NonCopyable
+    {
+        struct PlannedTexture
+        {
+            TextureDesc           Desc;
+            std::vector<uint64_t> NumBytesFromMip; // Resident bytes when the texture starts at a mip, one past the last mip is 0
+            uint32_t              TailMip          = 0;
+            uint32_t              RequestedMip     = 0;
+            uint32_t              TargetMip        = 0;
+            uint64_t              LastRequestFrame = 0;
+            bool                  IsUsed           = false;
+        };
+
+        TextureResidencyPlannerDesc m_desc;
+        std::vector<PlannedTexture> m_textures;
+        uint64_t                    m_frame = 0;
+
+        PlannedTexture       *FindTexture( uint32_t index );
+        const PlannedTexture *FindTexture( uint32_t index ) const;
+
+    public:
+        DZ_API explicit TextureResidencyPlanner( const TextureResidencyPlannerDesc &desc );
+
+        // Sizes come from desc, mip byte counts from the SlicePitch of mips. The texture starts out at its tail.
+        DZ_API void SetTexture( uint32_t index, const TextureDesc &desc, const TextureMipArray &mips );
+        DZ_API void RemoveTexture( uint32_t index );
+        // Finest mip needed this frame, the finest of every request since the last Plan is used. Requests persist until the next one.
+        DZ_API void RequestMip( uint32_t index, uint32_t mipLevel );
+        // Ends the frame of requests and updates the target mip of every texture
+        DZ_API void Plan( );
+
+        DZ_API [[nodiscard]] uint32_t GetTargetMip( uint32_t index ) const;
+        DZ_API [[nodiscard]] uint32_t GetTailMip( uint32_t index ) const;
+        DZ_API [[nodiscard]] uint64_t GetLastRequestFrame( uint32_t index ) const;
+        DZ_API [[nodiscard]] uint64_t GetNumBytesFromMip( uint32_t index, uint32_t mip ) const;
+        // Bytes of every texture at its target mip, above MemoryBudget only when the tails don't fit
+        DZ_API [[nodiscard]] uint64_t GetTargetNumBytes( ) const;
+    };
+} // namespace DenOfIz
@@ -0,0 +1,122 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "DenOfIzGraphics/Data/BatchResourceCopy.h"
+#include "DenOfIzGraphics/Data/TextureResidencyPlanner.h"
+
+namespace DenOfIz
+{
+    struct DZ_API StreamedTextureHandle
+    {
+        uint32_t Value;
+    };
+
+    struct DZ_API StreamedTextureHandleArray
+    {
+        StreamedTextureHandle *Elements;
+        uint32_t               NumElements;
+    };
+
+    struct DZ_API TextureStreamerDesc
+    {
+        ILogicalDevice *Device = nullptr;
+        // Bytes of mip data kept resident across every streamed texture, the least recently requested textures drop mips first when the
+        // requested mips don't fit. Tail mips count towards it but are never dropped.
+        uint64_t MemoryBudget = 256ull * 1024 * 1024;
+        // The tail is every mip with both sides at most this size, it is uploaded by the first Update after AddTexture
+        uint32_t MaxTailSize = 64;
+        // Textures that gain mips in one Update, the rest wait for the next Updates. Dropping mips is not limited.
+        uint32_t MaxUploadsPerUpdate = 4;
+        // Replaced textures are destroyed this many Updates later so frames still in flight can finish sampling them
+        uint32_t NumFramesInFlight = 3;
+    };
+
+    struct DZ_API StreamedTextureDesc
+    {
+        // Must outlive the streamed texture, mips are read from it on every upload. Like CreateAndLoadAssetTexture the streamer takes
+        // ownership of the TextureAsset returned by Reader->Read( ), a reader can only be added once.
+        TextureAssetReader *Reader                = nullptr;
+        uint32_t            AdditionalDescriptors = 0;
+        uint32_t            AdditionalUsages      = 0;
+        InteropString       DebugName;
+    };
+
+    /// Keeps the tail mips of every texture resident and streams the larger mips in as they are requested, so big scenes don't need every
+    /// texture at full resolution. Request the finest mip each texture needs every frame through RequestMip or RequestScreenSize, then
+    /// call Update once per frame.
+    /// Without tiled resources a texture can't change its mip count, Update creates a texture holding only the resident mips and uploads
+    /// them from the TextureAssetReader instead. The returned handles have a new GetTexture which must be rebound, the previous texture
+    /// stays alive for NumFramesInFlight Updates. Update blocks until its uploads are done. Which mips are resident is decided by a
+    /// TextureResidencyPlanner.
+    /// Threading: not thread safe, call every function from the same thread.
+    class TextureStreamer : public NonCopyable
+    {
+        struct StreamedTexture
+        {
+            TextureAssetReader               *Reader = nullptr;
+            std::unique_ptr<TextureAsset>     Asset;
+            TextureDesc                       Desc; // Of the full mip chain
+            std::unique_ptr<ITextureResource> Texture;
+            uint32_t                          ResidentMip = 0; // Mip of the asset that is mip 0 of Texture
+            bool                              IsUsed      = false;
+        };
+
+        struct RetiredTexture
+        {
+            std::unique_ptr<ITextureResource> Texture;
+            uint64_t                          Frame;
+        };
+
+        TextureStreamerDesc                m_desc;
+        TextureResidencyPlanner            m_planner;
+        std::unique_ptr<BatchResourceCopy> m_batchCopy;
+        std::vector<StreamedTexture>       m_textures;
+        std::vector<uint32_t>              m_freeTextures;
+        std::vector<RetiredTexture>        m_retiredTextures;
+        std::vector<StreamedTextureHandle> m_replacedTextures;
+        uint64_t                           m_frame            = 0;
+        uint64_t                           m_residentNumBytes = 0;
+
+        StreamedTexture       *FindTexture( StreamedTextureHandle handle );
+        const StreamedTexture *FindTexture( StreamedTextureHandle handle ) const;
+        void                   MakeResident( uint32_t index, uint32_t firstMip );
+        void                   RetireTexture( uint32_t index );
+        void                   ReleaseRetiredTextures( );
+
+    public:
+        DZ_API explicit TextureStreamer( const TextureStreamerDesc &desc );
+        DZ_API ~TextureStreamer( );
+
+        DZ_API StreamedTextureHandle AddTexture( const StreamedTextureDesc &desc );
+        DZ_API void                  RemoveTexture( StreamedTextureHandle handle );
+        // Finest mip needed this frame, the finest of every request since the last Update is used. Requests persist until the next one.
+        DZ_API void RequestMip( StreamedTextureHandle handle, uint32_t mipLevel );
+        // Requests the mip with about one texel per pixel when the texture covers width x height pixels on screen
+        DZ_API void RequestScreenSize( StreamedTextureHandle handle, float width, float height );
+        // Returns the textures whose GetTexture changed, valid until the next Update
+        DZ_API StreamedTextureHandleArray Update( );
+
+        // Null until the first Update after AddTexture
+        DZ_API [[nodiscard]] ITextureResource *GetTexture( StreamedTextureHandle handle ) const;
+        DZ_API [[nodiscard]] uint32_t          GetResidentMip( StreamedTextureHandle handle ) const;
+        DZ_API [[nodiscard]] uint64_t          GetResidentNumBytes( ) const;
+    };
+} // namespace DenOfIz
@@ -20,7 +20,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphics/Data/AlignedDataWriter.h"
 #include "DenOfIzGraphics/Data/Geometry.h"
+#include "DenOfIzGraphics/Data/StagingRing.h"
 #include "DenOfIzGraphics/Data/BatchResourceCopy.h"
+#include "DenOfIzGraphics/Data/TextureResidencyPlanner.h"
+#include "DenOfIzGraphics/Data/TextureStreamer.h"
 #include "DenOfIzGraphics/Renderer/Sync/FrameSync.h"
 #include "DenOfIzGraphics/Renderer/Sync/ResourceTracking.h"
 #include "DenOfIzGraphics/Assets/Assets.h"
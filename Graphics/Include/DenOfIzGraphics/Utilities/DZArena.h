@@ -18,6 +18,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -26,12 +27,20 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace DenOfIz
 {
+    enum class DZArenaMode
+    {
+        Contiguous, // A single buffer that is reallocated when it grows, earlier allocations move. Required by DZArenaCursor
+        Chunked     // Growing links a new block, allocations never move until Reset/Clear
+    };
+
+    /// In Chunked mode GetWritePointer, AdvanceCursor, EnsureCapacity and Write operate on the current block, EnsureCapacity( n ) makes
+    /// sure n - used bytes can be written contiguously. Reset keeps every block for reuse, Clear only keeps the first one.
     class DZ_API DZArena : public NonCopyable
     {
         friend struct DZArenaCursor;
 
     public:
-        explicit DZArena( size_t initialCapacity );
+        explicit DZArena( size_t initialCapacity, DZArenaMode mode = DZArenaMode::Chunked );
         ~DZArena( );
 
         void                 Reset( );
@@ -45,14 +54,37 @@ namespace DenOfIz
         void                 Write( const void *data, size_t size );
 
     private:
-        void Grow( size_t requiredSize );
+        struct alignas( std::max_align_t ) Block
+        {
+            Block *Next;
+            size_t Capacity;
+        };
+
+        void          Grow( size_t requiredSize );
+        void          NextBlock( size_t minCapacity );
+        void          UseBlock( Block *block );
+        static Block *CreateBlock( size_t capacity );
 
-        Byte  *Buffer;
-        size_t Capacity;
-        size_t Used;
-        size_t InitialCapacity;
+        Byte       *Buffer;
+        size_t      Capacity;
+        size_t      Used;
+        size_t      InitialCapacity;
+        DZArenaMode Mode;
+        Block      *FirstBlock   = nullptr; // Chunked mode only, blocks are linked through a header in front of their data
+        Block      *CurrentBlock = nullptr;
+    };
+
+    /// Per thread chunked arena for transient allocations that only live until the next BeginFrame, FrameSync::NextFrame begins a
+    /// frame. A thread's arena is reset lazily the first time it is used in a new frame, so threads never touch each others memory.
+    class DZ_API DZFrameArena
+    {
+    public:
+        static void     BeginFrame( );
+        static DZArena &ThisThread( );
+        static Byte    *Allocate( size_t size, size_t alignment = alignof( std::max_align_t ) );
     };
 
+    // Positions are offsets into a single buffer, the arena must be DZArenaMode::Contiguous
     struct DZ_API DZArenaCursor
     {
         DZArena *Arena;
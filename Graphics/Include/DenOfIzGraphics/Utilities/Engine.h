@@ -27,6 +27,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Common_Apple.h"
 #include "Common_Windows.h"
 #include "DenOfIzGraphics/Assets/FileSystem/FSConfig.h"
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
 
 namespace DenOfIz
 {
@@ -40,9 +42,11 @@ namespace DenOfIz
 
     struct DZ_API EngineDesc
     {
-        LogLevel      LogLevel  = LogLevel::Info;
-        InteropString LogFile   = "DenOfIz.log";
-        FSDesc        FS = { };
+        LogLevel               LogLevel = LogLevel::Info;
+        InteropString          LogFile  = "DenOfIz.log";
+        FSDesc                 FS       = { };
+        JobSystemDesc          Jobs     = { };
+        EngineShaderSourceDesc Shaders  = { }; // Precompiled engine shaders, built offline with EngineShaders::Build
     };
 
     class DZ_API Engine
@@ -0,0 +1,57 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "DenOfIzGraphics/Utilities/Interop.h"
+
+namespace DenOfIz
+{
+    struct InternedStringEntry;
+
+    /// Handle to a string in the process wide intern table. Equal strings intern to the same entry, so Equals is a pointer compare and
+    /// Id can key maps directly. Interning locks the table, entries live until the process exits. Empty strings intern to the default handle.
+    class DZ_API InternedString
+    {
+        const InternedStringEntry *m_entry = nullptr;
+
+    public:
+        InternedString( ) = default;
+        explicit InternedString( const InteropString &str );
+        explicit InternedString( const char *str );
+
+        [[nodiscard]] bool Equals( const InternedString &other ) const
+        {
+            return m_entry == other.m_entry;
+        }
+
+        // Unique among the strings interned by this process, not stable across runs
+        [[nodiscard]] uint64_t Id( ) const
+        {
+            return reinterpret_cast<uint64_t>( m_entry );
+        }
+
+        [[nodiscard]] uint64_t      Hash( ) const; // Same as InteropString::Hash( )
+        [[nodiscard]] size_t        NumChars( ) const;
+        [[nodiscard]] bool          IsEmpty( ) const;
+        [[nodiscard]] const char   *Get( ) const;
+        [[nodiscard]] InteropString ToInteropString( ) const;
+        static size_t               NumInterned( );
+    };
+} // namespace DenOfIz
@@ -18,7 +18,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
 
@@ -45,10 +47,66 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 namespace DenOfIz
 {
 
+    /// Strings of up to InlineCapacity characters are stored in place, longer ones are heap allocated. The length is stored and the
+    /// hash is computed once, so copies, NumChars and Equals don't scan the string.
     class DZ_API InteropString
     {
-        char     *m_data              = nullptr;
-        const int s_nullTerminatorLen = 1;
+        static constexpr size_t   InlineCapacity    = 23;
+        static constexpr size_t   NullTerminatorLen = 1;
+        static constexpr uint64_t HashOffsetBasis   = 14695981039346656037ULL;
+        static constexpr uint64_t HashPrime         = 1099511628211ULL;
+
+        char                         *m_data     = nullptr; // nullptr, m_inline or a heap allocation
+        size_t                        m_numChars = 0;
+        mutable std::atomic<uint64_t> m_hash{ 0 }; // 0 until Hash( ) is called
+        char                          m_inline[ InlineCapacity + NullTerminatorLen ];
+
+        char *AllocateChars( const size_t len )
+        {
+            m_numChars    = len;
+            m_data        = len <= InlineCapacity ? m_inline : new char[ len + NullTerminatorLen ];
+            m_data[ len ] = '\0';
+            return m_data;
+        }
+
+        void CopyFrom( const InteropString &other )
+        {
+            if ( other.m_data )
+            {
+                std::memcpy( AllocateChars( other.m_numChars ), other.m_data, other.m_numChars );
+                m_hash.store( other.m_hash.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+            }
+        }
+
+        void MoveFrom( InteropString &other )
+        {
+            if ( other.m_data == other.m_inline )
+            {
+                std::memcpy( m_inline, other.m_inline, other.m_numChars + NullTerminatorLen );
+                m_data = m_inline;
+            }
+            else
+            {
+                m_data = other.m_data;
+            }
+            m_numChars = other.m_numChars;
+            m_hash.store( other.m_hash.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+
+            other.m_data     = nullptr;
+            other.m_numChars = 0;
+            other.m_hash.store( 0, std::memory_order_relaxed );
+        }
+
+        void Release( )
+        {
+            if ( m_data != m_inline )
+            {
+                delete[] m_data;
+            }
+            m_data     = nullptr;
+            m_numChars = 0;
+            m_hash.store( 0, std::memory_order_relaxed );
+        }
 
     public:
         // ReSharper disable once CppNonExplicitConvertingConstructor
@@ -57,8 +115,7 @@ namespace DenOfIz
             if ( str )
             {
                 const size_t len = std::strlen( str );
-                m_data           = new char[ len + 1 ];
-                SafeCopyString( m_data, len + s_nullTerminatorLen, str );
+                std::memcpy( AllocateChars( len ), str, len );
             }
         }
 
@@ -66,55 +123,33 @@ namespace DenOfIz
         {
             if ( str )
             {
-                m_data = new char[ len + 1 ];
-                std::memcpy( m_data, str, len );
-                m_data[ len ] = '\0';
+                std::memcpy( AllocateChars( len ), str, len );
             }
         }
 
         ~InteropString( )
         {
-            delete[] m_data;
-            m_data = nullptr;
+            Release( );
         }
 
         InteropString( const InteropString &other )
         {
-            if ( other.m_data )
-            {
-                const size_t len = strlen( other.m_data );
-                m_data           = new char[ len + 1 ];
-                SafeCopyString( m_data, len + s_nullTerminatorLen, other.m_data );
-            }
-            else
-            {
-                m_data = nullptr;
-            }
+            CopyFrom( other );
         }
 
         InteropString &operator=( const InteropString &other )
         {
             if ( this != &other )
             {
-                delete[] m_data;
-                m_data = nullptr;
-                if ( other.m_data )
-                {
-                    const size_t len = strlen( other.m_data );
-                    m_data           = new char[ len + 1 ];
-                    SafeCopyString( m_data, len + s_nullTerminatorLen, other.m_data );
-                }
-                else
-                {
-                    m_data = nullptr;
-                }
+                Release( );
+                CopyFrom( other );
             }
             return *this;
         }
 
-        InteropString( InteropString &&other ) noexcept : m_data( other.m_data )
+        InteropString( InteropString &&other ) noexcept
         {
-            other.m_data = nullptr;
+            MoveFrom( other );
         }
 
         [[nodiscard]] bool Equals( const InteropString &other ) const
@@ -129,12 +164,37 @@ namespace DenOfIz
                 return true;
             }
 
-            if ( m_data == nullptr || other.m_data == nullptr )
+            if ( m_data == nullptr || other.m_data == nullptr || m_numChars != other.m_numChars )
+            {
+                return false;
+            }
+
+            // Only compared when both are already known, Equals itself never hashes
+            const uint64_t hash      = m_hash.load( std::memory_order_relaxed );
+            const uint64_t otherHash = other.m_hash.load( std::memory_order_relaxed );
+            if ( hash != 0 && otherHash != 0 && hash != otherHash )
             {
                 return false;
             }
 
-            return strcmp( m_data, other.m_data ) == 0;
+            return std::memcmp( m_data, other.m_data, m_numChars ) == 0;
+        }
+
+        // 64 bit FNV-1a of the characters, computed on the first call and carried along by copies
+        [[nodiscard]] uint64_t Hash( ) const
+        {
+            uint64_t hash = m_hash.load( std::memory_order_relaxed );
+            if ( hash == 0 )
+            {
+                hash = HashOffsetBasis;
+                for ( size_t i = 0; i < m_numChars; ++i )
+                {
+                    hash ^= static_cast<uint8_t>( m_data[ i ] );
+                    hash *= HashPrime;
+                }
+                m_hash.store( hash, std::memory_order_relaxed );
+            }
+            return hash;
         }
 
         [[nodiscard]] InteropString ToLower( ) const
@@ -143,12 +203,12 @@ namespace DenOfIz
             {
                 return { };
             }
-            InteropString result( m_data );
-            for ( size_t i = 0; i < strlen( result.m_data ); ++i )
+            InteropString result( m_data, m_numChars );
+            for ( size_t i = 0; i < m_numChars; ++i )
             {
                 result.m_data[ i ] = static_cast<char>( tolower( result.m_data[ i ] ) );
             }
-            return std::move( result );
+            return result;
         }
 
         [[nodiscard]] InteropString ToUpper( ) const
@@ -157,21 +217,20 @@ namespace DenOfIz
             {
                 return { };
             }
-            InteropString result( m_data );
-            for ( size_t i = 0; i < strlen( result.m_data ); ++i )
+            InteropString result( m_data, m_numChars );
+            for ( size_t i = 0; i < m_numChars; ++i )
             {
                 result.m_data[ i ] = static_cast<char>( toupper( result.m_data[ i ] ) );
             }
-            return std::move( result );
+            return result;
         }
 
         InteropString &operator=( InteropString &&other ) noexcept
         {
             if ( this != &other )
             {
-                delete[] m_data;
-                m_data       = other.m_data;
-                other.m_data = nullptr;
+                Release( );
+                MoveFrom( other );
             }
             return *this;
         }
@@ -182,32 +241,25 @@ namespace DenOfIz
             {
                 return *this;
             }
-            const size_t  len    = strlen( str );
-            const size_t  oldLen = NumChars( );
+            const size_t  len = strlen( str );
             InteropString result;
-            const auto    newData = new char[ oldLen + len + s_nullTerminatorLen ];
+            char         *newData = result.AllocateChars( m_numChars + len );
             if ( m_data != nullptr )
             {
-                SafeCopyString( newData, oldLen + s_nullTerminatorLen, m_data );
+                std::memcpy( newData, m_data, m_numChars );
             }
-            SafeCopyString( newData + oldLen, len + s_nullTerminatorLen, str );
-            delete[] result.m_data;
-            result.m_data = newData;
-            return std::move( result );
+            std::memcpy( newData + m_numChars, str, len );
+            return result;
         }
 
         [[nodiscard]] size_t NumChars( ) const
         {
-            if ( m_data == nullptr )
-            {
-                return 0;
-            }
-            return strlen( m_data );
+            return m_numChars;
         }
 
         [[nodiscard]] bool IsEmpty( ) const
         {
-            return m_data == nullptr || strlen( m_data ) == 0;
+            return m_numChars == 0;
         }
 
         [[nodiscard]] const char *Get( ) const
@@ -0,0 +1,117 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "DenOfIzGraphics/Utilities/Common_Macro.h"
+
+namespace tf
+{
+    class Executor;
+    class Taskflow;
+} // namespace tf
+
+namespace DenOfIz
+{
+    struct DZ_API JobSystemDesc
+    {
+        uint32_t NumWorkers = 0; // 0 means one worker per hardware thread
+    };
+
+    using Job = std::function<void( )>;
+
+    /// Number of jobs that have not finished yet, pass it to JobSystem::Submit/Run and wait on it with JobSystem::Wait.
+    class DZ_API JobCounter : public NonCopyable
+    {
+        friend class JobSystem;
+
+        std::atomic<uint32_t>   m_pending{ 0 };
+        std::mutex              m_mutex; // Held while finishing the last job so a waiter can't destroy the counter under it
+        std::condition_variable m_finished;
+
+        void Increment( );
+        void Decrement( );
+
+    public:
+        [[nodiscard]] bool IsDone( ) const;
+    };
+
+    /// Jobs with dependencies between them, built once and run any number of times. The graph must outlive its runs and must not
+    /// be modified while running.
+    class DZ_API JobGraph : public NonCopyable
+    {
+        friend class JobSystem;
+
+        struct Node
+        {
+            Job                   Function;
+            std::vector<uint32_t> Successors;
+        };
+
+        std::vector<Node> m_nodes;
+        tf::Taskflow     *m_taskflow = nullptr; // Built from m_nodes on the first run after a change
+
+        tf::Taskflow &GetTaskflow( );
+
+    public:
+        JobGraph( ) = default;
+        ~JobGraph( );
+
+        // Returns the id used by Precede
+        uint32_t Add( Job job );
+        // after starts once before has finished
+        void Precede( uint32_t before, uint32_t after );
+        void Clear( );
+        [[nodiscard]] uint32_t NumJobs( ) const;
+    };
+
+    /// Work stealing pool shared by the engine, Engine::Init creates it from EngineDesc::Jobs and Get( ) returns it. Waiting on a
+    /// worker thread runs other jobs until the wait is over instead of blocking, so jobs can wait on jobs they spawn without deadlocking.
+    class DZ_API JobSystem : public NonCopyable
+    {
+        tf::Executor *m_executor;
+
+    public:
+        explicit JobSystem( const JobSystemDesc &desc = { } );
+        ~JobSystem( );
+
+        void Submit( Job job, JobCounter *counter = nullptr ) const;
+        void Run( JobGraph &graph, JobCounter *counter = nullptr ) const;
+        // Calls body( begin, end ) for consecutive ranges of at least grainSize indices that together cover [0, count), the calling
+        // thread takes part and the call returns once every range is done
+        void ParallelFor( uint32_t count, const std::function<void( uint32_t begin, uint32_t end )> &body, uint32_t grainSize = 1 ) const;
+        void Wait( JobCounter &counter ) const;
+        // Waits for every submitted job, must not be called from a worker thread
+        void WaitIdle( ) const;
+
+        [[nodiscard]] uint32_t NumWorkers( ) const;
+        [[nodiscard]] bool     IsWorkerThread( ) const;
+
+        // Called by Engine::Init/Shutdown, Get( ) creates a default sized pool if Init was not called
+        static void       Init( const JobSystemDesc &desc );
+        static void       Shutdown( );
+        static JobSystem &Get( );
+    };
+} // namespace DenOfIz
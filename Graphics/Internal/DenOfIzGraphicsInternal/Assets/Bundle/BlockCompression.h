@@ -0,0 +1,97 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <istream>
+#include <vector>
+#include "DenOfIzGraphics/Utilities/Common_Arrays.h"
+
+namespace DenOfIz
+{
+    class RandomAccessFile;
+
+    // Layout of a block compressed payload, all values little endian:
+    //  uint32 BlockSize                  - Uncompressed bytes per block, the last block may be smaller
+    //  uint32 NumBlocks
+    //  uint32 CompressedBlockSizes[ NumBlocks ]
+    //  Blocks, each compressed independently
+    struct BlockCompressionIndex
+    {
+        uint32_t              BlockSize            = 0;
+        uint64_t              UncompressedNumBytes = 0;
+        uint64_t              BlocksOffset         = 0; // Offset of the first block relative to the start of the payload
+        std::vector<uint64_t> BlockOffsets;             // NumBlocks + 1 entries, relative to BlocksOffset
+
+        [[nodiscard]] uint32_t NumBlocks( ) const;
+        [[nodiscard]] uint64_t UncompressedBlockSize( uint32_t block ) const;
+    };
+
+    class BlockCompression
+    {
+    public:
+        static constexpr uint32_t HeaderNumBytes = 2 * sizeof( uint32_t );
+
+        static bool Compress( const ByteArrayView &data, uint32_t blockSize, std::vector<Byte> &result );
+        // Reads the fixed header, returns the number of block size entries that follow it
+        static uint32_t ReadNumBlocks( const ByteArrayView &header, uint32_t &blockSize );
+        static bool     ReadIndex( const ByteArrayView &header, uint64_t uncompressedNumBytes, BlockCompressionIndex &index );
+    };
+
+    // Decompresses blocks on demand, seeking only decodes the block that is landed on and reads spanning multiple whole blocks decode
+    // them in parallel straight into the destination.
+    class BlockDecompressionStreamBuf final : public std::streambuf
+    {
+        BlockCompressionIndex   m_index;
+        const Byte             *m_mappedBlocks = nullptr; // Either the blocks are mapped in memory or read from m_file
+        const RandomAccessFile *m_file         = nullptr;
+        uint64_t                m_fileOffset   = 0;
+        std::vector<Byte>       m_block;
+        uint32_t                m_currentBlock = 0; // Block currently decoded into m_block
+        uint64_t                m_blockStart   = 0; // Uncompressed offset of eback( ), or the read position while the get area is empty
+
+    public:
+        BlockDecompressionStreamBuf( BlockCompressionIndex index, const Byte *mappedBlocks );
+        BlockDecompressionStreamBuf( BlockCompressionIndex index, const RandomAccessFile *file, uint64_t blocksFileOffset );
+
+    protected:
+        int_type        underflow( ) override;
+        std::streamsize xsgetn( char_type *destination, std::streamsize count ) override;
+        std::streamsize showmanyc( ) override;
+        pos_type        seekoff( off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode ) override;
+        pos_type        seekpos( pos_type position, std::ios_base::openmode mode ) override;
+
+    private:
+        [[nodiscard]] uint64_t Position( ) const;
+        bool                   LoadBlock( uint32_t block );
+        bool                   DecompressBlock( uint32_t block, Byte *destination ) const;
+        bool                   DecompressBlocks( uint32_t firstBlock, uint32_t numBlocks, Byte *destination ) const;
+    };
+
+    class BlockDecompressionStream final : public std::istream
+    {
+        BlockDecompressionStreamBuf m_buffer;
+
+    public:
+        template <typename... Args>
+        explicit BlockDecompressionStream( Args &&...args ) : std::istream( nullptr ), m_buffer( std::forward<Args>( args )... )
+        {
+            rdbuf( &m_buffer );
+        }
+    };
+} // namespace DenOfIz
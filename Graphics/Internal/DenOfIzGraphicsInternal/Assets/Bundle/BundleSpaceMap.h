@@ -0,0 +1,65 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace DenOfIz
+{
+    // Tracks the byte ranges of a bundle file that are referenced by its table of contents or by assets added since the last save,
+    // anything else past the header is dead and can be written over.
+    // Released ranges only become free on Commit, until the next save lands the table of contents on disk may still point at them.
+    class BundleSpaceMap
+    {
+        struct Extent
+        {
+            uint64_t NumBytes      = 0;
+            uint32_t NumReferences = 0;
+        };
+
+        struct Range
+        {
+            uint64_t Offset;
+            uint64_t NumBytes;
+        };
+
+        std::unordered_map<uint64_t, Extent> m_extents;    // By offset, deduplicated payloads share an extent
+        std::map<uint64_t, uint64_t>         m_freeRanges; // Offset to number of bytes, adjacent ranges are merged
+        std::vector<Range>                   m_releasedRanges;
+
+    public:
+        void Clear( );
+        // Empty ranges are not tracked
+        void AddReference( uint64_t offset, uint64_t numBytes );
+        // Returns true if the last reference to the range at offset was dropped
+        bool Release( uint64_t offset );
+        // Everything between reservedNumBytes and fileNumBytes that isn't referenced becomes free
+        void BuildFreeRanges( uint64_t reservedNumBytes, uint64_t fileNumBytes );
+        // Best fit, returns false if no free range is large enough and the data has to be appended instead
+        [[nodiscard]] bool Allocate( uint64_t numBytes, uint64_t &offset );
+        void               Commit( );
+
+    private:
+        void Free( uint64_t offset, uint64_t numBytes );
+    };
+} // namespace DenOfIz
@@ -0,0 +1,101 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
+
+namespace DenOfIz
+{
+    // Serialized layout, starting at BundleHeader::TOCOffset, all values little endian:
+    //  uint64 PathsNumBytes
+    //  Records[ NumAssets ] sorted by PathHash, see BundleTOCEntry for the fields
+    //  Paths, BundleTOCEntry::PathOffset is relative to the start of the paths
+    // Lookups binary search the serialized records in place, so a memory mapped table of contents is usable without parsing it.
+    class BundleTableOfContents
+    {
+    public:
+        static constexpr uint32_t HeaderNumBytes = sizeof( uint64_t );
+        static constexpr uint32_t RecordNumBytes = 3 * sizeof( uint64_t ) + 3 * sizeof( uint32_t );
+
+        struct Entry
+        {
+            uint64_t         PathHash = 0;
+            AssetType        Type     = AssetType::Unknown;
+            uint64_t         Offset   = 0;
+            uint64_t         NumBytes = 0;
+            std::string_view Path;
+        };
+
+    private:
+        struct AddedEntry
+        {
+            Entry       Value;
+            std::string Path; // Value.Path views this
+        };
+
+        const Byte                              *m_records       = nullptr;
+        uint32_t                                 m_numRecords    = 0;
+        const char                              *m_paths         = nullptr;
+        uint64_t                                 m_pathsNumBytes = 0;
+        uint32_t                                 m_numShadowed   = 0; // Records replaced by added entries
+        std::vector<Byte>                        m_storage;
+        std::unordered_map<uint64_t, AddedEntry> m_addedEntries;
+
+    public:
+        // Returns the number of bytes to read to get the whole table of contents, header must hold HeaderNumBytes
+        static uint64_t NumBytes( const Byte *header, uint32_t numEntries );
+        // Views a serialized table of contents which must stay alive until the next View/Adopt/Clear
+        bool View( const Byte *data, uint64_t numBytes, uint32_t numEntries );
+        bool Adopt( std::vector<Byte> data, uint32_t numEntries );
+        void Clear( );
+
+        [[nodiscard]] bool     Find( uint64_t pathHash, Entry &entry ) const;
+        [[nodiscard]] bool     Contains( uint64_t pathHash ) const;
+        [[nodiscard]] uint32_t NumEntries( ) const;
+        // Added entries replace entries with the same path hash
+        void Add( const Entry &entry );
+        // Serializes every entry, the result can be passed to Adopt
+        void Serialize( std::vector<Byte> &result ) const;
+
+        template <typename Fn>
+        void ForEach( Fn &&fn ) const
+        {
+            for ( uint32_t i = 0; i < m_numRecords; ++i )
+            {
+                if ( const Entry entry = ReadRecord( i ); !m_addedEntries.contains( entry.PathHash ) )
+                {
+                    fn( entry );
+                }
+            }
+            for ( const auto &[ pathHash, added ] : m_addedEntries )
+            {
+                fn( added.Value );
+            }
+        }
+
+    private:
+        bool                SetRecords( const Byte *data, uint64_t numBytes, uint32_t numEntries );
+        [[nodiscard]] Entry ReadRecord( uint32_t index ) const;
+        [[nodiscard]] bool  FindRecord( uint64_t pathHash, Entry &entry ) const;
+    };
+} // namespace DenOfIz
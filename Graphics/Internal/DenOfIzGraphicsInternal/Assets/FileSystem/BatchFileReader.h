@@ -0,0 +1,35 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+
+namespace DenOfIz
+{
+    // Backend of FileIO::ReadFiles. Requests are split into chunks and submitted through io_uring on Linux, when io_uring is not
+    // available (older kernels, seccomp filters, other platforms) the chunks are read with pread/overlapped ReadFile on a thread pool.
+    class BatchFileReader
+    {
+    public:
+        // resolvedPaths[ i ] is the path opened for requests.Elements[ i ], fills in NumBytesRead of every request
+        static bool Read( const FileReadRequestArray &requests, const std::vector<std::string> &resolvedPaths );
+    };
+} // namespace DenOfIz
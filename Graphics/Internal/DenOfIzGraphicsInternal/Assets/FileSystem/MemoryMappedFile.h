@@ -0,0 +1,53 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "DenOfIzGraphics/Utilities/Common_Arrays.h"
+
+namespace DenOfIz
+{
+    // Read-only view of an entire file mapped into the address space. The mapping is shared between all readers and is only
+    // released when the object is destroyed or Close is called, any ByteArrayView handed out must not outlive it.
+    class MemoryMappedFile
+    {
+        const Byte *m_data     = nullptr;
+        uint64_t    m_numBytes = 0;
+#ifdef _WIN32
+        void *m_fileHandle    = nullptr;
+        void *m_mappingHandle = nullptr;
+#endif
+
+    public:
+        MemoryMappedFile( ) = default;
+        ~MemoryMappedFile( );
+
+        MemoryMappedFile( const MemoryMappedFile & )            = delete;
+        MemoryMappedFile &operator=( const MemoryMappedFile & ) = delete;
+
+        // Path is used as is, resolve it with FileIO::GetResourcePath first if necessary
+        bool Open( const InteropString &path );
+        void Close( );
+
+        [[nodiscard]] bool          IsOpen( ) const;
+        [[nodiscard]] const Byte   *Data( ) const;
+        [[nodiscard]] uint64_t      NumBytes( ) const;
+        [[nodiscard]] ByteArrayView View( uint64_t offset, uint64_t numBytes ) const;
+        [[nodiscard]] bool          Contains( uint64_t offset, uint64_t numBytes ) const;
+    };
+} // namespace DenOfIz
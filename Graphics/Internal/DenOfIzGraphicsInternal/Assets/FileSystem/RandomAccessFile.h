@@ -0,0 +1,53 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "DenOfIzGraphics/Utilities/Common_Arrays.h"
+
+namespace DenOfIz
+{
+    // Read only file handle that reads at explicit offsets(pread/overlapped ReadFile) and never touches a shared file
+    // position, ReadAt can be called from any number of threads concurrently.
+    class RandomAccessFile
+    {
+#ifdef _WIN32
+        void *m_fileHandle = nullptr;
+#else
+        int m_fileDescriptor = -1;
+#endif
+
+    public:
+        RandomAccessFile( ) = default;
+        ~RandomAccessFile( );
+
+        RandomAccessFile( const RandomAccessFile & )            = delete;
+        RandomAccessFile &operator=( const RandomAccessFile & ) = delete;
+
+        // Path is used as is, resolve it with FileIO::GetResourcePath first if necessary
+        bool Open( const InteropString &path );
+        void Close( );
+
+        [[nodiscard]] bool IsOpen( ) const;
+        // Returns the number of bytes read, less than numBytes only if the end of the file was reached or an error occurred
+        uint64_t ReadAt( uint64_t offset, Byte *destination, uint64_t numBytes ) const;
+#ifndef _WIN32
+        [[nodiscard]] int FileDescriptor( ) const;
+#endif
+    };
+} // namespace DenOfIz
@@ -49,8 +49,9 @@ namespace DenOfIz
         std::unordered_map<uint32_t, const aiNode *>    IndexToAssimpNodeMap;
         std::unordered_map<const aiNode *, aiMatrix4x4> NodeWorldTransformCache;
 
-        std::vector<AssetUri> CreatedAssets;
-        AssetUri              SkeletonAssetUri;
+        std::vector<AssetUri>    CreatedAssets;
+        AssetUri                 SkeletonAssetUri;
+        std::vector<std::string> InputFiles; // Read besides the files Assimp opened, for ImportCache
 
         DZArena *MainArena           = nullptr;
         DZArena *TempArena           = nullptr; // For temporary allocations
@@ -20,6 +20,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <assimp/material.h>
 #include <assimp/scene.h>
+#include <filesystem>
 #include "AssimpImportContext.h"
 #include "DenOfIzGraphics/Assets/Serde/Material/MaterialAsset.h"
 #include "DenOfIzGraphics/Assets/Serde/Texture/TextureAsset.h"
@@ -36,8 +37,11 @@ namespace DenOfIz
         ImporterResultCode ProcessAllMaterials( AssimpImportContext &context ) const;
         ImporterResultCode ProcessMaterial( AssimpImportContext &context, const aiMaterial *material, AssetUri &outMaterialUri ) const;
         ImporterResultCode ProcessMaterialTextures( AssimpImportContext &context, const aiMaterial *material, MaterialAsset &materialAsset ) const;
+        // Absolute paths of the texture files ProcessMaterialTextures would import, in the form TexturePathToAssetUriMap is keyed by
+        void CollectExternalTextures( const aiScene *scene, const InteropString &sourceFilePath, std::vector<std::string> &outPaths ) const;
 
     private:
+        static std::filesystem::path ResolveExternalTexturePath( const InteropString &sourceFilePath, const std::string &texturePath );
         bool ProcessTexture( AssimpImportContext &context, const aiMaterial *material, aiTextureType textureType, const InteropString &semanticName, AssetUri &outAssetUri ) const;
         ImporterResultCode WriteTextureAsset( AssimpImportContext &context, const aiTexture *texture, const std::string &path, const InteropString &semanticName,
                                               AssetUri &outAssetUri ) const;
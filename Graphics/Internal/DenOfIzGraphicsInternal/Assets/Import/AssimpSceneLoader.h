@@ -21,7 +21,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include "DenOfIzGraphics/Assets/Import/AssimpImporter.h"
 #include "DenOfIzGraphics/Assets/Import/ImporterCommon.h"
 
@@ -48,9 +50,12 @@ namespace DenOfIz
         size_t EstimatedAssetsCreated = 0;
     };
 
+    class AssimpRecordingIOSystem;
+
     class AssimpSceneLoader
     {
         std::unique_ptr<Assimp::Importer> m_importer;
+        AssimpRecordingIOSystem          *m_ioSystem; // Owned by m_importer
         const aiScene                    *m_scene = nullptr;
         AssimpSceneStats                  m_stats;
         unsigned int                      m_importFlags = 0;
@@ -67,6 +72,8 @@ namespace DenOfIz
         const aiScene          *GetScene( ) const;
         const AssimpSceneStats &GetStats( ) const;
         unsigned int            GetImportFlags( ) const;
+        // Every file the last LoadScene opened, a model can be split over several files such as glTF buffers or OBJ material libraries
+        const std::vector<std::string> &GetOpenedFiles( ) const;
 
     private:
         void ConfigureImportFlags( const AssimpImportDesc &desc );
@@ -0,0 +1,47 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "DenOfIzGraphics/Assets/Import/TextureImporter.h"
+#include "DenOfIzGraphicsInternal/Assets/Import/TextureMipGenerator.h"
+
+namespace DenOfIz
+{
+    struct BlockCompressionDesc
+    {
+        TextureCompression Compression = TextureCompression::BC7; // Resolved, None and Auto are invalid here
+        const Byte        *Source      = nullptr;                 // R8G8B8A8 mips laid out as Mips describes
+        const TextureMip  *Mips        = nullptr;
+        uint32_t           NumMips     = 0;
+    };
+
+    /// Encodes R8G8B8A8 mips into BC1, BC3, BC4, BC5 or BC7 blocks. Endpoints are fit along the principal axis of each block and
+    /// refined with least squares against the chosen indices. BC7 blocks use mode 6, a single RGBA subset with 4 bit indices, which
+    /// suits the smooth color and alpha of most albedo textures. Mips smaller than a block, or with sides that aren't a multiple of 4,
+    /// repeat their edge texels to fill the block. Rows of blocks from every mip are spread over the JobSystem together.
+    class TextureBlockCompressor
+    {
+    public:
+        static Format   CompressedFormat( TextureCompression compression );
+        static uint32_t NumBlockBytes( TextureCompression compression );
+        // The same mips as the source in the same order, DataOffset is into chain.Data
+        static bool Compress( const BlockCompressionDesc &desc, MipChain &chain );
+    };
+} // namespace DenOfIz
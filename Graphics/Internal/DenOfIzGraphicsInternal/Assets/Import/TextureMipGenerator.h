@@ -0,0 +1,56 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <vector>
+#include "DenOfIzGraphics/Assets/Import/TextureImporter.h"
+#include "DenOfIzGraphics/Assets/Serde/Texture/TextureAsset.h"
+
+namespace DenOfIz
+{
+    struct MipChainDesc
+    {
+        const Byte      *Source                 = nullptr; // Tightly packed R8G8B8A8 slices, one after another
+        uint32_t         Width                  = 0;
+        uint32_t         Height                 = 0;
+        uint32_t         ArraySize              = 1;
+        TextureMipFilter Filter                 = TextureMipFilter::Kaiser;
+        bool             IsSrgb                 = true;
+        bool             PreserveAlphaCoverage  = false;
+        float            AlphaCoverageReference = 0.5f;
+    };
+
+    struct MipChain
+    {
+        std::vector<Byte>       Data; // Every mip of the first slice, then every mip of the next slice, like DDS files
+        std::vector<TextureMip> Mips; // DataOffset is into Data
+        uint32_t                MipLevels = 0;
+    };
+
+    /// Builds complete mip chains for R8G8B8A8 images. Levels are filtered separably in 32 bit float from the previous level, so
+    /// rounding doesn't accumulate down the chain, one float4 per texel multiplied and accumulated with SSE2 or NEON (scalar on
+    /// other targets). Rows of every slice are spread over the JobSystem for each pass.
+    class TextureMipGenerator
+    {
+    public:
+        static uint32_t NumMipLevels( uint32_t width, uint32_t height );
+        static bool     Generate( const MipChainDesc &desc, MipChain &chain );
+    };
+} // namespace DenOfIz
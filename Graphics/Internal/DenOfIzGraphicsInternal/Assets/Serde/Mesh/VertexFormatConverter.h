@@ -0,0 +1,52 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "DenOfIzGraphics/Backends/Interface/CommonData.h"
+#include "DenOfIzGraphics/Utilities/Common_Arrays.h"
+#include "DenOfIzGraphics/Utilities/InteropMath.h"
+
+namespace DenOfIz
+{
+    struct VertexConversionDesc
+    {
+        const Byte *Source              = nullptr;
+        uint32_t    SourceStride        = 0;
+        uint32_t    NumSourceComponents = 0;
+        Float_4     Defaults{ 0.0f, 0.0f, 0.0f, 0.0f }; // Fills components missing from the source
+        Byte       *Destination       = nullptr;
+        uint32_t    DestinationStride = 0;
+        Format      Format            = Format::R32G32B32A32Float;
+        size_t      NumVertices       = 0;
+    };
+
+    /// Converts strided runs of serialized vertex attributes (32 bit float or uint components) into GPU vertex formats.
+    /// Float sources are widened into four component rows first so normalized and half formats are packed one vector per vertex
+    /// with SSE2/F16C or NEON, falling back to scalar code on other targets.
+    class VertexFormatConverter
+    {
+    public:
+        static bool IsFloatFormatSupported( Format format );
+        static bool IsUIntFormatSupported( Format format );
+
+        static void ConvertFloat( const VertexConversionDesc &desc );
+        // Returns false if a value didn't fit a narrower format, such values are clamped to its maximum
+        static bool ConvertUInt( const VertexConversionDesc &desc );
+    };
+} // namespace DenOfIz
@@ -0,0 +1,69 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+#include "DenOfIzGraphics/Utilities/Common_Arrays.h"
+
+namespace DenOfIz
+{
+    // Fixed little endian encoding for on disk tables that are read in place, unlike BinaryWriter which splits 64 bit values into
+    // high and low words
+    class LittleEndian
+    {
+    public:
+        LittleEndian( ) = delete;
+
+        static void AppendUInt32( std::vector<Byte> &result, const uint32_t value )
+        {
+            for ( int i = 0; i < 4; ++i )
+            {
+                result.push_back( static_cast<Byte>( value >> i * 8 & 0xFF ) );
+            }
+        }
+
+        static void AppendUInt64( std::vector<Byte> &result, const uint64_t value )
+        {
+            for ( int i = 0; i < 8; ++i )
+            {
+                result.push_back( static_cast<Byte>( value >> i * 8 & 0xFF ) );
+            }
+        }
+
+        static uint32_t ReadUInt32( const Byte *data )
+        {
+            uint32_t value = 0;
+            for ( int i = 0; i < 4; ++i )
+            {
+                value |= static_cast<uint32_t>( data[ i ] ) << i * 8;
+            }
+            return value;
+        }
+
+        static uint64_t ReadUInt64( const Byte *data )
+        {
+            uint64_t value = 0;
+            for ( int i = 0; i < 8; ++i )
+            {
+                value |= static_cast<uint64_t>( data[ i ] ) << i * 8;
+            }
+            return value;
+        }
+    };
+} // namespace DenOfIz
@@ -0,0 +1,119 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+#include "DenOfIzGraphics/Utilities/Interop.h"
+
+namespace DenOfIz::EmbeddedQuadRendererShaders
+{
+    static auto QuadVertexShaderSource = R"(
+struct VertexInput
+{
+    float3 Position : POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+struct InstanceData
+{
+    float4x4 Transform;
+    float4 UVScaleOffset;
+    uint TextureIndex;
+    float4 Color;
+    float3 _Pad0;
+};
+
+struct VertexOutput
+{
+    float4 Position : SV_Position;
+    float2 TexCoord : TEXCOORD0;
+    uint TextureIndex : TEXCOORD1;
+    float4 Color : TEXCOORD2;
+};
+
+StructuredBuffer<InstanceData> Instances : register(t0);
+cbuffer FrameConstants : register(b0)
+{
+    float4x4 Projection;
+};
+
+VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
+{
+    VertexOutput output;
+    InstanceData instance = Instances[instanceID];
+    float4 worldPos = mul(float4(input.Position, 1.0), instance.Transform);
+    output.Position = mul(worldPos, Projection);
+    output.TexCoord = input.TexCoord * instance.UVScaleOffset.xy + instance.UVScaleOffset.zw;
+    output.TextureIndex = instance.TextureIndex;
+    output.Color = instance.Color;
+    return output;
+}
+)";
+
+    static auto RasterPixelShaderSource = R"(
+struct PixelInput
+{
+    float4 Position : SV_Position;
+    float2 TexCoord : TEXCOORD0;
+    uint TextureIndex : TEXCOORD1;
+    float4 Color : TEXCOORD2;
+};
+
+// Bindless texture array
+Texture2D<float4> g_Textures[] : register(t0, space1);
+SamplerState g_Sampler : register(s0, space1);
+
+float4 main(PixelInput input) : SV_Target
+{
+    if (input.TextureIndex == 0) // 0 means no texture (null texture)
+    {
+        return input.Color;
+    }
+    
+    // Use dynamic indexing with the bindless texture array
+    float4 texColor = g_Textures[input.TextureIndex].Sample(g_Sampler, input.TexCoord);
+    
+    // Multiply with vertex color for tinting
+    return texColor * input.Color;
+}
+)";
+
+    static std::vector<Byte> StringToByteArray( const char *str )
+    {
+        const size_t      len = strlen( str );
+        std::vector<Byte> result( len );
+        for ( size_t i = 0; i < len; i++ )
+        {
+            result[ i ] = static_cast<Byte>( str[ i ] );
+        }
+        return result;
+    }
+
+    static std::vector<Byte> GetQuadVertexShaderBytes( )
+    {
+        return StringToByteArray( QuadVertexShaderSource );
+    }
+
+    static std::vector<Byte> GetRasterPixelShaderBytes( )
+    {
+        return StringToByteArray( RasterPixelShaderSource );
+    }
+} // namespace DenOfIz::EmbeddedQuadRendererShaders
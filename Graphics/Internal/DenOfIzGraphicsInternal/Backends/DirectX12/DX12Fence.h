@@ -39,6 +39,7 @@ namespace DenOfIz
         ~DX12Fence( ) override;
         void Wait( ) override;
         void Reset( ) override;
+        bool IsSignaled( ) override;
         void NotifyCommandQueue( ID3D12CommandQueue *commandQueue );
     };
 
@@ -36,6 +36,7 @@ namespace DenOfIz
         ~MetalFence( ) override;
         void Wait( ) override;
         void Reset( ) override;
+        bool IsSignaled( ) override;
         void Notify( );
 
         void NotifyOnCommandBufferCompletion( const id<MTLCommandBuffer> &commandBuffer );
@@ -34,6 +34,7 @@ namespace DenOfIz
         ~                     VulkanFence( ) override;
         void                  Wait( ) override;
         void                  Reset( ) override;
+        bool                  IsSignaled( ) override;
         [[nodiscard]] VkFence GetFence( ) const;
     };
 
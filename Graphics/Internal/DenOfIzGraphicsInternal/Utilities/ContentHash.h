@@ -0,0 +1,90 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include "DenOfIzGraphics/Utilities/Common_Arrays.h"
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
+
+namespace DenOfIz
+{
+    // FNV-1a over 8 byte words in four independent lanes, favours speed over distribution. Appending data in pieces gives the same
+    // result as hashing it at once, so files can be hashed while they are streamed in.
+    class ContentHash
+    {
+        static constexpr uint64_t Prime     = 1099511628211ULL;
+        static constexpr size_t   WordBytes = 4 * sizeof( uint64_t );
+
+        uint64_t m_lanes[ 4 ]{ 14695981039346656037ULL, 0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL };
+        Byte     m_tail[ WordBytes ]{ };
+        size_t   m_tailNumBytes = 0;
+
+        void AppendWords( const Byte *data )
+        {
+            uint64_t words[ 4 ];
+            std::memcpy( words, data, sizeof( words ) );
+            for ( uint32_t lane = 0; lane < 4; ++lane )
+            {
+                m_lanes[ lane ] = ( m_lanes[ lane ] ^ words[ lane ] ) * Prime;
+            }
+        }
+
+    public:
+        ContentHash &Append( const Byte *data, size_t numBytes )
+        {
+            if ( m_tailNumBytes > 0 )
+            {
+                const size_t numCopied = std::min( numBytes, WordBytes - m_tailNumBytes );
+                std::memcpy( m_tail + m_tailNumBytes, data, numCopied );
+                m_tailNumBytes += numCopied;
+                data += numCopied;
+                numBytes -= numCopied;
+                if ( m_tailNumBytes < WordBytes )
+                {
+                    return *this;
+                }
+                AppendWords( m_tail );
+                m_tailNumBytes = 0;
+            }
+
+            for ( ; numBytes >= WordBytes; data += WordBytes, numBytes -= WordBytes )
+            {
+                AppendWords( data );
+            }
+            std::memcpy( m_tail, data, numBytes );
+            m_tailNumBytes = numBytes;
+            return *this;
+        }
+
+        [[nodiscard]] uint64_t Value( ) const
+        {
+            Fnv1a hash;
+            hash.Append( reinterpret_cast<const char *>( m_lanes ), sizeof( m_lanes ) );
+            hash.Append( reinterpret_cast<const char *>( m_tail ), m_tailNumBytes );
+            return hash.Value( );
+        }
+
+        static uint64_t Hash( const ByteArrayView &data )
+        {
+            return ContentHash( ).Append( data.Elements, data.NumElements ).Value( );
+        }
+    };
+} // namespace DenOfIz
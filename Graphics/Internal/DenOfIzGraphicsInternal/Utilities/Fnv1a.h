@@ -0,0 +1,55 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace DenOfIz
+{
+    // 64 bit FNV-1a, hashing a string in pieces gives the same result as hashing the concatenated string
+    class Fnv1a
+    {
+        static constexpr uint64_t OffsetBasis = 14695981039346656037ULL;
+        static constexpr uint64_t Prime       = 1099511628211ULL;
+
+        uint64_t m_hash = OffsetBasis;
+
+    public:
+        Fnv1a &Append( const char *data, const size_t length )
+        {
+            for ( size_t i = 0; i < length; ++i )
+            {
+                m_hash ^= static_cast<uint8_t>( data[ i ] );
+                m_hash *= Prime;
+            }
+            return *this;
+        }
+
+        [[nodiscard]] uint64_t Value( ) const
+        {
+            return m_hash;
+        }
+
+        static uint64_t Hash( const char *data, const size_t length )
+        {
+            return Fnv1a( ).Append( data, length ).Value( );
+        }
+    };
+} // namespace DenOfIz
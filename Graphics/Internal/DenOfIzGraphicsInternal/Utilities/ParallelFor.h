@@ -0,0 +1,41 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
+
+namespace DenOfIz
+{
+    // Runs fn( i ) for every i in [0, count) on the engine's JobSystem, the calling thread takes part in the work. Jobs get at least
+    // grainSize consecutive indices, raise it when fn( i ) is too cheap to be worth a job of its own.
+    template <typename Fn>
+    void ParallelFor( const uint32_t count, Fn &&fn, const uint32_t grainSize = 1 )
+    {
+        JobSystem::Get( ).ParallelFor( count,
+                                       [ &fn ]( const uint32_t begin, const uint32_t end )
+                                       {
+                                           for ( uint32_t i = begin; i < end; ++i )
+                                           {
+                                               fn( i );
+                                           }
+                                       },
+                                       grainSize );
+    }
+} // namespace DenOfIz
@@ -0,0 +1,130 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Assets/Bundle/AssetAccessTrace.h"
+#include <fstream>
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryReader.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryWriter.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+AssetAccessTrace::AssetAccessTrace( ) : m_start( std::chrono::steady_clock::now( ) )
+{
+}
+
+void AssetAccessTrace::Record( const AssetUri &uri )
+{
+    const auto     elapsed = std::chrono::steady_clock::now( ) - m_start;
+    const uint64_t timeNs  = std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count( );
+
+    std::lock_guard lock( m_mutex );
+    Append( uri, timeNs );
+}
+
+void AssetAccessTrace::Clear( )
+{
+    std::lock_guard lock( m_mutex );
+    m_start = std::chrono::steady_clock::now( );
+    m_accesses.clear( );
+    m_firstTouchOrder.clear( );
+    m_touched.clear( );
+}
+
+AssetAccessArray AssetAccessTrace::GetAccesses( )
+{
+    AssetAccessArray result{ };
+    result.Elements    = m_accesses.data( );
+    result.NumElements = static_cast<uint32_t>( m_accesses.size( ) );
+    return result;
+}
+
+AssetUriArray AssetAccessTrace::FirstTouchOrder( )
+{
+    AssetUriArray result{ };
+    result.Elements    = m_firstTouchOrder.data( );
+    result.NumElements = static_cast<uint32_t>( m_firstTouchOrder.size( ) );
+    return result;
+}
+
+bool AssetAccessTrace::Save( const InteropString &path )
+{
+    std::lock_guard lock( m_mutex );
+    std::ofstream   file( FileIO::GetResourcePath( path ).Get( ), std::ios::binary | std::ios::trunc );
+    if ( !file.is_open( ) )
+    {
+        spdlog::error( "Failed to open access trace for writing: {}", path.Get( ) );
+        return false;
+    }
+
+    const BinaryWriter writer( &file );
+    writer.WriteUInt64( Magic );
+    writer.WriteUInt32( Version );
+    writer.WriteUInt32( static_cast<uint32_t>( m_accesses.size( ) ) );
+    for ( const AssetAccess &access : m_accesses )
+    {
+        writer.WriteString( access.Uri.ToInteropString( ) );
+        writer.WriteUInt64( access.TimeNs );
+    }
+    writer.Flush( );
+    return file.good( );
+}
+
+bool AssetAccessTrace::Load( const InteropString &path )
+{
+    if ( !FileIO::FileExists( path ) )
+    {
+        spdlog::error( "Access trace does not exist: {}", path.Get( ) );
+        return false;
+    }
+
+    BinaryReader reader( path );
+    if ( reader.ReadUInt64( ) != Magic )
+    {
+        spdlog::error( "Invalid access trace: incorrect magic number in {}", path.Get( ) );
+        return false;
+    }
+    if ( const uint32_t version = reader.ReadUInt32( ); version > Version )
+    {
+        spdlog::error( "Unsupported access trace version: {}", version );
+        return false;
+    }
+
+    Clear( );
+    const uint32_t  numAccesses = reader.ReadUInt32( );
+    std::lock_guard lock( m_mutex );
+    m_accesses.reserve( numAccesses );
+    for ( uint32_t i = 0; i < numAccesses; ++i )
+    {
+        const AssetUri uri    = AssetUri::Parse( reader.ReadString( ) );
+        const uint64_t timeNs = reader.ReadUInt64( );
+        Append( uri, timeNs );
+    }
+    return true;
+}
+
+void AssetAccessTrace::Append( const AssetUri &uri, const uint64_t timeNs )
+{
+    m_accesses.push_back( { uri, timeNs } );
+    if ( m_touched.insert( uri.Hash( ) ).second )
+    {
+        m_firstTouchOrder.push_back( uri );
+    }
+}
@@ -0,0 +1,247 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphics/Assets/Bundle/AssetRequestQueue.h"
+#include <algorithm>
+#include <ranges>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+AssetRequestQueue::AssetRequestQueue( const AssetRequestQueueDesc &desc ) : m_desc( desc )
+{
+    if ( m_desc.Manager == nullptr )
+    {
+        spdlog::error( "AssetRequestQueueDesc::Manager is required" );
+    }
+}
+
+AssetRequestQueue::~AssetRequestQueue( )
+{
+    {
+        std::lock_guard lock( m_mutex );
+        m_shutdown = true;
+        m_pending.clear( );
+    }
+    JobSystem::Get( ).Wait( m_loadJobs );
+
+    for ( const auto &request : m_requests | std::views::values )
+    {
+        delete request.Reader;
+    }
+}
+
+AssetRequestHandle AssetRequestQueue::Request( const AssetRequestDesc &desc )
+{
+    AssetRequestHandle handle{ };
+    {
+        std::lock_guard lock( m_mutex );
+        handle.Value = m_nextHandle++;
+
+        RequestState request;
+        request.Uri = desc.Uri;
+        request.Key = { desc.Priority, m_nextSequence++, handle.Value };
+        m_pending.insert( request.Key );
+        m_requests.emplace( handle.Value, std::move( request ) );
+        ScheduleLoadJobs( );
+    }
+    return handle;
+}
+
+bool AssetRequestQueue::Cancel( const AssetRequestHandle &handle )
+{
+    std::lock_guard lock( m_mutex );
+    const auto      it = m_requests.find( handle.Value );
+    if ( it == m_requests.end( ) )
+    {
+        return false;
+    }
+
+    RequestState &request = it->second;
+    switch ( request.Status )
+    {
+    case AssetRequestStatus::Pending:
+        m_pending.erase( request.Key );
+        break;
+    case AssetRequestStatus::Loading:
+        {
+            // The worker owns the request until the load returns, only the first cancel counts
+            const bool wasCancelled = request.CancelRequested;
+            request.CancelRequested = true;
+            return !wasCancelled;
+        }
+    default:
+        std::erase( m_finished, handle.Value );
+        delete request.Reader;
+        break;
+    }
+    m_requests.erase( it );
+    m_requestFinished.notify_all( );
+    return true;
+}
+
+bool AssetRequestQueue::SetPriority( const AssetRequestHandle &handle, const int32_t priority )
+{
+    std::lock_guard lock( m_mutex );
+    const auto      it = m_requests.find( handle.Value );
+    if ( it == m_requests.end( ) || it->second.Status != AssetRequestStatus::Pending )
+    {
+        return false;
+    }
+
+    // Sequence is kept so the request doesn't lose its place among requests of the new priority
+    RequestState &request = it->second;
+    m_pending.erase( request.Key );
+    request.Key.Priority = priority;
+    m_pending.insert( request.Key );
+    return true;
+}
+
+AssetRequestStatus AssetRequestQueue::GetStatus( const AssetRequestHandle &handle ) const
+{
+    std::lock_guard lock( m_mutex );
+    const auto      it = m_requests.find( handle.Value );
+    if ( it == m_requests.end( ) || it->second.CancelRequested )
+    {
+        return AssetRequestStatus::Unknown;
+    }
+    return it->second.Status;
+}
+
+bool AssetRequestQueue::WaitForRequest( const AssetRequestHandle &handle ) const
+{
+    std::unique_lock lock( m_mutex );
+    bool             known = true;
+    m_requestFinished.wait( lock,
+                            [ & ]
+                            {
+                                const auto it = m_requests.find( handle.Value );
+                                known         = it != m_requests.end( ) && !it->second.CancelRequested;
+                                return !known || it->second.Status == AssetRequestStatus::Ready || it->second.Status == AssetRequestStatus::Failed;
+                            } );
+    return known;
+}
+
+uint32_t AssetRequestQueue::NumOutstandingRequests( ) const
+{
+    std::lock_guard lock( m_mutex );
+    return static_cast<uint32_t>( m_requests.size( ) );
+}
+
+AssetRequestResultArray AssetRequestQueue::CompleteRequests( )
+{
+    std::lock_guard lock( m_mutex );
+    m_frameResults.clear( );
+
+    uint64_t completedNumBytes = 0;
+    while ( !m_finished.empty( ) )
+    {
+        if ( m_desc.MaxCompletionsPerFrame > 0 && m_frameResults.size( ) >= m_desc.MaxCompletionsPerFrame )
+        {
+            break;
+        }
+
+        const auto it = m_requests.find( m_finished.front( ) );
+        if ( m_desc.MaxCompletedBytesPerFrame > 0 && !m_frameResults.empty( ) && completedNumBytes + it->second.NumBytes > m_desc.MaxCompletedBytesPerFrame )
+        {
+            break;
+        }
+
+        AssetRequestResult &result = m_frameResults.emplace_back( );
+        result.Handle.Value        = it->first;
+        result.Uri                 = it->second.Uri;
+        result.Status              = it->second.Status;
+        result.Reader              = it->second.Reader;
+        completedNumBytes += it->second.NumBytes;
+
+        m_requests.erase( it );
+        m_finished.pop_front( );
+    }
+
+    AssetRequestResultArray results{ };
+    results.Elements    = m_frameResults.data( );
+    results.NumElements = static_cast<uint32_t>( m_frameResults.size( ) );
+    return results;
+}
+
+void AssetRequestQueue::ScheduleLoadJobs( )
+{
+    if ( m_desc.Manager == nullptr )
+    {
+        return;
+    }
+
+    const uint32_t maxLoadJobs = std::max( 1u, m_desc.NumWorkers );
+    while ( m_numLoadJobs < maxLoadJobs && m_numLoadJobs < m_pending.size( ) )
+    {
+        ++m_numLoadJobs;
+        JobSystem::Get( ).Submit( [ this ] { LoadPendingRequests( ); }, &m_loadJobs );
+    }
+}
+
+void AssetRequestQueue::LoadPendingRequests( )
+{
+    std::unique_lock lock( m_mutex );
+    while ( !m_shutdown && !m_pending.empty( ) )
+    {
+        const uint64_t handle = m_pending.begin( )->Handle;
+        m_pending.erase( m_pending.begin( ) );
+        RequestState &request = m_requests.at( handle );
+        request.Status        = AssetRequestStatus::Loading;
+        const AssetUri uri    = request.Uri;
+
+        lock.unlock( );
+        uint64_t      numBytes = 0;
+        BinaryReader *reader   = LoadAsset( uri, numBytes );
+        lock.lock( );
+
+        // References into m_requests can't be held across the unlocked region
+        RequestState &loaded = m_requests.at( handle );
+        if ( loaded.CancelRequested )
+        {
+            delete reader;
+            m_requests.erase( handle );
+        }
+        else
+        {
+            loaded.Status   = reader ? AssetRequestStatus::Ready : AssetRequestStatus::Failed;
+            loaded.Reader   = reader;
+            loaded.NumBytes = numBytes;
+            m_finished.push_back( handle );
+        }
+        m_requestFinished.notify_all( );
+    }
+    // Checked and released under the same lock as Request schedules, so a request can't be left without a job
+    --m_numLoadJobs;
+}
+
+BinaryReader *AssetRequestQueue::LoadAsset( const AssetUri &uri, uint64_t &numBytes ) const
+{
+    const std::unique_ptr<BinaryReader> source( m_desc.Manager->OpenReader( uri ) );
+    if ( !source )
+    {
+        spdlog::error( "Failed to load asset: {}", uri.ToInteropString( ).Get( ) );
+        return nullptr;
+    }
+
+    // Pull the whole asset through now, disk reads and decompression happen here instead of wherever the reader is used.
+    // The reader takes the buffer over, so the bytes are only copied once
+    const ByteArray bytes = source->ReadAllBytes( );
+    numBytes              = bytes.NumElements;
+    return new BinaryReader( bytes );
+}
@@ -0,0 +1,340 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphicsInternal/Assets/Bundle/BlockCompression.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <miniz/miniz.h>
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/RandomAccessFile.h"
+#include "DenOfIzGraphicsInternal/Assets/Stream/LittleEndian.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+#include "DenOfIzGraphicsInternal/Utilities/ParallelFor.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr uint32_t NoBlock = UINT32_MAX;
+} // namespace
+
+uint32_t BlockCompressionIndex::NumBlocks( ) const
+{
+    return BlockOffsets.empty( ) ? 0 : static_cast<uint32_t>( BlockOffsets.size( ) - 1 );
+}
+
+uint64_t BlockCompressionIndex::UncompressedBlockSize( const uint32_t block ) const
+{
+    const uint64_t blockStart = static_cast<uint64_t>( block ) * BlockSize;
+    return std::min<uint64_t>( BlockSize, UncompressedNumBytes - blockStart );
+}
+
+bool BlockCompression::Compress( const ByteArrayView &data, const uint32_t blockSize, std::vector<Byte> &result )
+{
+    if ( blockSize == 0 )
+    {
+        spdlog::error( "Compression block size must be greater than zero" );
+        return false;
+    }
+
+    const auto                     numBlocks = static_cast<uint32_t>( ( data.NumElements + blockSize - 1 ) / blockSize );
+    std::vector<std::vector<Byte>> blocks( numBlocks );
+    std::atomic<bool>              succeeded = true;
+
+    ParallelFor( numBlocks,
+                 [ & ]( const uint32_t block )
+                 {
+                     const uint64_t offset         = static_cast<uint64_t>( block ) * blockSize;
+                     const auto     sourceSize     = static_cast<mz_ulong>( std::min<uint64_t>( blockSize, data.NumElements - offset ) );
+                     mz_ulong       compressedSize = mz_compressBound( sourceSize );
+
+                     blocks[ block ].resize( compressedSize );
+                     if ( mz_compress( blocks[ block ].data( ), &compressedSize, data.Elements + offset, sourceSize ) != MZ_OK )
+                     {
+                         succeeded = false;
+                         return;
+                     }
+                     blocks[ block ].resize( compressedSize );
+                 } );
+
+    if ( !succeeded )
+    {
+        return false;
+    }
+
+    size_t totalNumBytes = HeaderNumBytes + numBlocks * sizeof( uint32_t );
+    for ( const auto &block : blocks )
+    {
+        totalNumBytes += block.size( );
+    }
+
+    result.clear( );
+    result.reserve( totalNumBytes );
+    LittleEndian::AppendUInt32( result, blockSize );
+    LittleEndian::AppendUInt32( result, numBlocks );
+    for ( const auto &block : blocks )
+    {
+        LittleEndian::AppendUInt32( result, static_cast<uint32_t>( block.size( ) ) );
+    }
+    for ( const auto &block : blocks )
+    {
+        result.insert( result.end( ), block.begin( ), block.end( ) );
+    }
+    return true;
+}
+
+uint32_t BlockCompression::ReadNumBlocks( const ByteArrayView &header, uint32_t &blockSize )
+{
+    if ( header.NumElements < HeaderNumBytes )
+    {
+        blockSize = 0;
+        return 0;
+    }
+    blockSize = LittleEndian::ReadUInt32( header.Elements );
+    return LittleEndian::ReadUInt32( header.Elements + sizeof( uint32_t ) );
+}
+
+bool BlockCompression::ReadIndex( const ByteArrayView &header, const uint64_t uncompressedNumBytes, BlockCompressionIndex &index )
+{
+    uint32_t       blockSize = 0;
+    const uint32_t numBlocks = ReadNumBlocks( header, blockSize );
+    if ( header.NumElements < HeaderNumBytes + static_cast<uint64_t>( numBlocks ) * sizeof( uint32_t ) )
+    {
+        spdlog::error( "Block compression index is truncated" );
+        return false;
+    }
+    if ( blockSize == 0 || static_cast<uint64_t>( numBlocks ) * blockSize < uncompressedNumBytes )
+    {
+        spdlog::error( "Block compression index does not cover {} bytes", uncompressedNumBytes );
+        return false;
+    }
+
+    index.BlockSize            = blockSize;
+    index.UncompressedNumBytes = uncompressedNumBytes;
+    index.BlocksOffset         = HeaderNumBytes + static_cast<uint64_t>( numBlocks ) * sizeof( uint32_t );
+    index.BlockOffsets.resize( numBlocks + 1 );
+    index.BlockOffsets[ 0 ] = 0;
+
+    const Byte *compressedSizes = header.Elements + HeaderNumBytes;
+    for ( uint32_t i = 0; i < numBlocks; ++i )
+    {
+        index.BlockOffsets[ i + 1 ] = index.BlockOffsets[ i ] + LittleEndian::ReadUInt32( compressedSizes + i * sizeof( uint32_t ) );
+    }
+    return true;
+}
+
+BlockDecompressionStreamBuf::BlockDecompressionStreamBuf( BlockCompressionIndex index, const Byte *mappedBlocks ) :
+    m_index( std::move( index ) ), m_mappedBlocks( mappedBlocks ), m_currentBlock( NoBlock )
+{
+}
+
+BlockDecompressionStreamBuf::BlockDecompressionStreamBuf( BlockCompressionIndex index, const RandomAccessFile *file, const uint64_t blocksFileOffset ) :
+    m_index( std::move( index ) ), m_file( file ), m_fileOffset( blocksFileOffset ), m_currentBlock( NoBlock )
+{
+}
+
+BlockDecompressionStreamBuf::int_type BlockDecompressionStreamBuf::underflow( )
+{
+    if ( gptr( ) < egptr( ) )
+    {
+        return traits_type::to_int_type( *gptr( ) );
+    }
+
+    const uint64_t position = Position( );
+    if ( position >= m_index.UncompressedNumBytes || !LoadBlock( static_cast<uint32_t>( position / m_index.BlockSize ) ) )
+    {
+        return traits_type::eof( );
+    }
+
+    setg( eback( ), eback( ) + ( position - m_blockStart ), egptr( ) );
+    return traits_type::to_int_type( *gptr( ) );
+}
+
+std::streamsize BlockDecompressionStreamBuf::xsgetn( char_type *destination, const std::streamsize count )
+{
+    std::streamsize total = 0;
+    while ( total < count )
+    {
+        if ( const std::streamsize available = egptr( ) - gptr( ); available > 0 )
+        {
+            const std::streamsize numBytes = std::min( available, count - total );
+            std::memcpy( destination + total, gptr( ), static_cast<size_t>( numBytes ) );
+            gbump( static_cast<int>( numBytes ) );
+            total += numBytes;
+            continue;
+        }
+
+        const uint64_t position = Position( );
+        if ( position >= m_index.UncompressedNumBytes )
+        {
+            break;
+        }
+
+        // Whole blocks are decoded directly into the destination, skipping the intermediate block buffer
+        const auto block     = static_cast<uint32_t>( position / m_index.BlockSize );
+        uint32_t   numBlocks = 0;
+        uint64_t   numBytes  = 0;
+        if ( position % m_index.BlockSize == 0 )
+        {
+            const auto remaining = static_cast<uint64_t>( count - total );
+            while ( block + numBlocks < m_index.NumBlocks( ) && numBytes + m_index.UncompressedBlockSize( block + numBlocks ) <= remaining )
+            {
+                numBytes += m_index.UncompressedBlockSize( block + numBlocks );
+                ++numBlocks;
+            }
+        }
+
+        if ( numBlocks > 0 )
+        {
+            if ( !DecompressBlocks( block, numBlocks, reinterpret_cast<Byte *>( destination + total ) ) )
+            {
+                break;
+            }
+            total += static_cast<std::streamsize>( numBytes );
+            m_blockStart = position + numBytes;
+            setg( nullptr, nullptr, nullptr );
+            continue;
+        }
+
+        if ( traits_type::eq_int_type( underflow( ), traits_type::eof( ) ) )
+        {
+            break;
+        }
+    }
+    return total;
+}
+
+std::streamsize BlockDecompressionStreamBuf::showmanyc( )
+{
+    const uint64_t position = Position( );
+    return position < m_index.UncompressedNumBytes ? static_cast<std::streamsize>( m_index.UncompressedNumBytes - position ) : -1;
+}
+
+BlockDecompressionStreamBuf::pos_type BlockDecompressionStreamBuf::seekoff( const off_type offset, const std::ios_base::seekdir direction, const std::ios_base::openmode mode )
+{
+    off_type base = 0;
+    switch ( direction )
+    {
+    case std::ios_base::cur:
+        base = static_cast<off_type>( Position( ) );
+        break;
+    case std::ios_base::end:
+        base = static_cast<off_type>( m_index.UncompressedNumBytes );
+        break;
+    default:
+        break;
+    }
+    return seekpos( pos_type( base + offset ), mode );
+}
+
+BlockDecompressionStreamBuf::pos_type BlockDecompressionStreamBuf::seekpos( const pos_type position, const std::ios_base::openmode mode )
+{
+    const auto target = static_cast<off_type>( position );
+    if ( !( mode & std::ios_base::in ) || target < 0 || static_cast<uint64_t>( target ) > m_index.UncompressedNumBytes )
+    {
+        return pos_type( off_type( -1 ) );
+    }
+
+    // Decoding is deferred until the next read so seeking around is free
+    const auto newPosition = static_cast<uint64_t>( target );
+    if ( eback( ) != nullptr && newPosition >= m_blockStart && newPosition < m_blockStart + ( egptr( ) - eback( ) ) )
+    {
+        setg( eback( ), eback( ) + ( newPosition - m_blockStart ), egptr( ) );
+    }
+    else
+    {
+        m_blockStart = newPosition;
+        setg( nullptr, nullptr, nullptr );
+    }
+    return position;
+}
+
+uint64_t BlockDecompressionStreamBuf::Position( ) const
+{
+    return m_blockStart + static_cast<uint64_t>( gptr( ) - eback( ) );
+}
+
+bool BlockDecompressionStreamBuf::LoadBlock( const uint32_t block )
+{
+    if ( block >= m_index.NumBlocks( ) )
+    {
+        return false;
+    }
+
+    if ( block != m_currentBlock )
+    {
+        m_block.resize( m_index.UncompressedBlockSize( block ) );
+        if ( !DecompressBlock( block, m_block.data( ) ) )
+        {
+            m_currentBlock = NoBlock;
+            return false;
+        }
+        m_currentBlock = block;
+    }
+
+    m_blockStart = static_cast<uint64_t>( block ) * m_index.BlockSize;
+    auto *begin  = reinterpret_cast<char_type *>( m_block.data( ) );
+    setg( begin, begin, begin + m_block.size( ) );
+    return true;
+}
+
+bool BlockDecompressionStreamBuf::DecompressBlock( const uint32_t block, Byte *destination ) const
+{
+    const uint64_t    compressedOffset = m_index.BlockOffsets[ block ];
+    const uint64_t    compressedSize   = m_index.BlockOffsets[ block + 1 ] - compressedOffset;
+    const Byte       *source           = nullptr;
+    std::vector<Byte> staging;
+    if ( m_mappedBlocks != nullptr )
+    {
+        source = m_mappedBlocks + compressedOffset;
+    }
+    else
+    {
+        staging.resize( compressedSize );
+        if ( m_file == nullptr || m_file->ReadAt( m_fileOffset + compressedOffset, staging.data( ), compressedSize ) != compressedSize )
+        {
+            spdlog::error( "Failed to read compressed block {}", block );
+            return false;
+        }
+        source = staging.data( );
+    }
+
+    const uint64_t expectedSize     = m_index.UncompressedBlockSize( block );
+    auto           decompressedSize = static_cast<mz_ulong>( expectedSize );
+    if ( mz_uncompress( destination, &decompressedSize, source, static_cast<mz_ulong>( compressedSize ) ) != MZ_OK || decompressedSize != expectedSize )
+    {
+        spdlog::error( "Failed to decompress block {}", block );
+        return false;
+    }
+    return true;
+}
+
+bool BlockDecompressionStreamBuf::DecompressBlocks( const uint32_t firstBlock, const uint32_t numBlocks, Byte *destination ) const
+{
+    std::atomic<bool> succeeded = true;
+    ParallelFor( numBlocks,
+                 [ & ]( const uint32_t i )
+                 {
+                     const uint64_t offset = static_cast<uint64_t>( i ) * m_index.BlockSize;
+                     if ( !DecompressBlock( firstBlock + i, destination + offset ) )
+                     {
+                         succeeded = false;
+                     }
+                 } );
+    return succeeded;
+}
@@ -18,22 +18,40 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <miniz/miniz.h>
 #include <ranges>
 #include <string>
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphicsInternal/Assets/Bundle/BlockCompression.h"
+#include "DenOfIzGraphicsInternal/Assets/Bundle/BundleSpaceMap.h"
+#include "DenOfIzGraphicsInternal/Assets/Bundle/BundleTableOfContents.h"
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/MemoryMappedFile.h"
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/RandomAccessFile.h"
+#include "DenOfIzGraphicsInternal/Utilities/ContentHash.h"
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
 using namespace DenOfIz;
 
-Bundle::Bundle( const BundleDesc &desc ) : m_desc( desc ), m_bundleFile( nullptr ), m_isDirty( false ), m_isCompressed( desc.Compress )
+namespace
+{
+    // Magic, Version, NumBytes, NumAssets, TOCOffset and IsCompressed as written by Bundle::WriteHeader
+    constexpr uint64_t SerializedHeaderNumBytes = 2 * sizeof( uint64_t ) + 3 * sizeof( uint32_t ) + 1;
+} // namespace
+
+Bundle::Bundle( const BundleDesc &desc ) :
+    m_desc( desc ), m_toc( new BundleTableOfContents( ) ), m_spaceMap( new BundleSpaceMap( ) ), m_bundleFile( nullptr ), m_isDirty( false ), m_isCompressed( desc.Compress )
 {
     const InteropString resolvedPath = FileIO::GetResourcePath( desc.Path );
+    m_resolvedPath                   = resolvedPath;
     if ( FileIO::FileExists( resolvedPath ) )
     {
         m_bundleFile = new std::fstream( resolvedPath.Get( ), std::ios::binary | std::ios::in | std::ios::out );
+        OpenReadHandles( );
         LoadTableOfContents( );
     }
     else if ( desc.CreateIfNotExists )
@@ -46,16 +64,20 @@ Bundle::Bundle( const BundleDesc &desc ) : m_desc( desc ), m_bundleFile( nullptr
 
         m_bundleFile = new std::fstream( resolvedPath.Get( ), std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc );
         WriteEmptyHeader( );
+        OpenReadHandles( );
     }
 }
 
-Bundle::Bundle( const BundleDirectoryDesc &directoryDesc ) : m_bundleFile( nullptr ), m_isDirty( false ), m_isCompressed( directoryDesc.Compress )
+Bundle::Bundle( const BundleDirectoryDesc &directoryDesc ) :
+    m_toc( new BundleTableOfContents( ) ), m_spaceMap( new BundleSpaceMap( ) ), m_bundleFile( nullptr ), m_isDirty( false ), m_isCompressed( directoryDesc.Compress )
 {
     BundleDesc desc;
     desc.Path              = FileIO::GetResourcePath( directoryDesc.OutputBundlePath );
     desc.CreateIfNotExists = true;
-    desc.Compress          = directoryDesc.Compress;
-    m_desc                 = desc;
+    desc.Compress             = directoryDesc.Compress;
+    desc.CompressionBlockSize = directoryDesc.CompressionBlockSize;
+    m_desc                    = desc;
+    m_resolvedPath            = desc.Path;
 
     const std::filesystem::path bundlePath( desc.Path.Get( ) );
     const std::filesystem::path parentPath = bundlePath.parent_path( );
@@ -66,6 +88,7 @@ Bundle::Bundle( const BundleDirectoryDesc &directoryDesc ) : m_bundleFile( nullp
 
     m_bundleFile = new std::fstream( desc.Path.Get( ), std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc );
     WriteEmptyHeader( );
+    OpenReadHandles( );
 
     const InteropString resolvedDirPath = FileIO::GetResourcePath( directoryDesc.DirectoryPath );
     const std::string   dirPath         = resolvedDirPath.Get( );
@@ -77,7 +100,23 @@ Bundle::Bundle( const BundleDirectoryDesc &directoryDesc ) : m_bundleFile( nullp
     }
 
     const std::filesystem::path basePath = dirPath;
-    auto                        visitor  = [ & ]( const std::filesystem::path &path )
+
+    struct DirectoryAsset
+    {
+        std::filesystem::path Path;
+        std::string           RelativePath;
+        AssetType             Type;
+        uint64_t              LoadRank;
+    };
+
+    std::unordered_map<uint64_t, uint64_t> loadOrder;
+    for ( uint32_t i = 0; i < directoryDesc.LoadOrder.NumElements; ++i )
+    {
+        loadOrder.try_emplace( directoryDesc.LoadOrder.Elements[ i ].Hash( ), i );
+    }
+
+    std::vector<DirectoryAsset> assets;
+    auto                        visitor = [ & ]( const std::filesystem::path &path )
     {
         if ( !std::filesystem::is_regular_file( path ) )
         {
@@ -110,18 +149,8 @@ Bundle::Bundle( const BundleDirectoryDesc &directoryDesc ) : m_bundleFile( nullp
             }
         }
 
-        const InteropString filePath( path.string( ).c_str( ) );
-        if ( FileIO::FileExists( filePath ) )
-        {
-            std::vector<Byte> fileData( FileIO::GetFileNumBytes( filePath ) );
-            FileIO::ReadFile( filePath, { fileData.data( ), fileData.size( ) } );
-            const AssetUri assetUri = AssetUri::Create( InteropString( relPathStr.c_str( ) ) );
-            AddAsset( assetUri, assetType, ByteArrayView( fileData.data( ), fileData.size( ) ) );
-        }
-        else
-        {
-            spdlog::error( "Failed to add asset: file does not exist: {}", relPathStr );
-        }
+        const auto rank = loadOrder.find( AssetUri::Create( InteropString( relPathStr.c_str( ) ) ).Hash( ) );
+        assets.push_back( { path, relPathStr, assetType, rank == loadOrder.end( ) ? loadOrder.size( ) : rank->second } );
     };
 
     if ( directoryDesc.Recursive )
@@ -139,12 +168,40 @@ Bundle::Bundle( const BundleDirectoryDesc &directoryDesc ) : m_bundleFile( nullp
         }
     }
 
+    // Payloads are appended in the order they are added, so this is the layout of the bundle. Directory iteration order is unspecified,
+    // assets outside of the load order are sorted by path to keep the output reproducible
+    std::ranges::sort( assets, [ ]( const DirectoryAsset &a, const DirectoryAsset &b )
+                       { return a.LoadRank != b.LoadRank ? a.LoadRank < b.LoadRank : a.RelativePath < b.RelativePath; } );
+    for ( const DirectoryAsset &asset : assets )
+    {
+        const InteropString filePath( asset.Path.string( ).c_str( ) );
+        if ( FileIO::FileExists( filePath ) )
+        {
+            std::vector<Byte> fileData( FileIO::GetFileNumBytes( filePath ) );
+            FileIO::ReadFile( filePath, { fileData.data( ), fileData.size( ) } );
+            const AssetUri assetUri = AssetUri::Create( InteropString( asset.RelativePath.c_str( ) ) );
+            AddAsset( assetUri, asset.Type, ByteArrayView( fileData.data( ), fileData.size( ) ) );
+        }
+        else
+        {
+            spdlog::error( "Failed to add asset: file does not exist: {}", asset.RelativePath );
+        }
+    }
+
     Save( );
 }
 
 Bundle::~Bundle( )
 {
+    delete m_toc;
+    delete m_spaceMap;
     delete m_bundleFile;
+    delete m_readFile;
+    delete m_mappedFile;
+    for ( const MemoryMappedFile *mapping : m_retiredMappings )
+    {
+        delete mapping;
+    }
 }
 
 Bundle *Bundle::CreateFromDirectory( const BundleDirectoryDesc &directoryDesc )
@@ -154,42 +211,14 @@ Bundle *Bundle::CreateFromDirectory( const BundleDirectoryDesc &directoryDesc )
 
 BinaryReader *Bundle::OpenReader( const AssetUri &assetUri )
 {
-    const std::string uriStr = assetUri.ToInteropString( ).Get( );
-    const auto        it     = m_assetEntries.find( uriStr );
-    if ( it != m_assetEntries.end( ) )
+    if ( BundleTableOfContents::Entry entry; m_toc->Find( assetUri.Hash( ), entry ) )
     {
-        BinaryReaderDesc desc{ };
-        desc.NumBytes = it->second.NumBytes;
-
-        if ( m_isCompressed )
+        BinaryReader *reader = OpenAssetReader( entry.Offset, entry.NumBytes );
+        if ( reader == nullptr )
         {
-            m_bundleFile->seekg( it->second.Offset, std::ios::beg );
-            BinaryReader fileReader( m_bundleFile );
-
-            const uint64_t  compressedSize = fileReader.ReadUInt64( );
-            const ByteArray compressedData = fileReader.ReadBytes( static_cast<uint32_t>( compressedSize ) );
-
-            std::vector<Byte> decompressedData( it->second.NumBytes );
-            mz_ulong          decompressedSize = static_cast<mz_ulong>( it->second.NumBytes );
-            const int         result           = mz_uncompress( decompressedData.data( ), &decompressedSize, compressedData.Elements, static_cast<mz_ulong>( compressedSize ) );
-
-            if ( result != MZ_OK )
-            {
-                spdlog::error( "Failed to decompress asset: {}", uriStr );
-                return nullptr;
-            }
-
-            ByteArray decompressedDataArray{ };
-            decompressedDataArray.Elements    = decompressedData.data( );
-            decompressedDataArray.NumElements = decompressedSize;
-            return new BinaryReader( ByteArrayView( decompressedDataArray ) );
+            spdlog::error( "Failed to read asset: {}", entry.Path );
         }
-
-        // Uncompressed data
-        m_bundleFile->seekg( it->second.Offset, std::ios::beg );
-        BinaryReader    fileReader( m_bundleFile );
-        const ByteArray buffer = fileReader.ReadBytes( static_cast<uint32_t>( it->second.NumBytes ) );
-        return new BinaryReader( ByteArrayView( buffer ) );
+        return reader;
     }
 
     // If it's not in the bundle, check if we can find it in the filesystem, useful for dev mode
@@ -202,10 +231,144 @@ BinaryReader *Bundle::OpenReader( const AssetUri &assetUri )
     return nullptr;
 }
 
+BinaryReader *Bundle::OpenAssetReader( const uint64_t offset, const uint64_t numBytes ) const
+{
+    if ( m_isCompressed )
+    {
+        return m_version < BundleHeader::BlockCompressionVersion ? OpenLegacyCompressedReader( offset, numBytes ) : OpenBlockCompressedReader( offset, numBytes );
+    }
+    // Uncompressed data, zero copy if the asset is within the mapped range. Assets added after the mapping was created are
+    // read from the file until the next Save
+    if ( m_mappedFile && m_mappedFile->Contains( offset, numBytes ) )
+    {
+        BinaryReaderDesc viewDesc{ };
+        viewDesc.CopyData = false;
+        return new BinaryReader( m_mappedFile->View( offset, numBytes ), viewDesc );
+    }
+    if ( std::vector<Byte> data( numBytes ); ReadAt( offset, data.data( ), data.size( ) ) )
+    {
+        return new BinaryReader( ByteArrayView( data.data( ), data.size( ) ) );
+    }
+    return nullptr;
+}
+
+bool Bundle::ReadBlockIndex( const uint64_t offset, const uint64_t numBytes, BlockCompressionIndex &index ) const
+{
+    std::vector<Byte> headerStorage;
+    ByteArrayView     header{ nullptr, 0 };
+    uint32_t          blockSize = 0;
+    if ( !ReadRange( offset, BlockCompression::HeaderNumBytes, headerStorage, header ) )
+    {
+        return false;
+    }
+
+    const uint32_t numBlocks = BlockCompression::ReadNumBlocks( header, blockSize );
+    if ( blockSize == 0 || numBlocks != ( numBytes + blockSize - 1 ) / blockSize )
+    {
+        spdlog::error( "Corrupt compression block header at offset {}", offset );
+        return false;
+    }
+
+    return ReadRange( offset, BlockCompression::HeaderNumBytes + numBlocks * sizeof( uint32_t ), headerStorage, header ) &&
+           BlockCompression::ReadIndex( header, numBytes, index );
+}
+
+bool Bundle::ReadStoredNumBytes( const uint64_t offset, const uint64_t numBytes, uint64_t &storedNumBytes ) const
+{
+    if ( !m_isCompressed )
+    {
+        storedNumBytes = numBytes;
+        return true;
+    }
+
+    if ( m_version < BundleHeader::BlockCompressionVersion )
+    {
+        BinaryReaderDesc viewDesc{ };
+        viewDesc.CopyData = false;
+
+        std::vector<Byte> sizeStorage;
+        ByteArrayView     sizeBytes{ nullptr, 0 };
+        if ( !ReadRange( offset, sizeof( uint64_t ), sizeStorage, sizeBytes ) )
+        {
+            return false;
+        }
+        BinaryReader sizeReader( sizeBytes, viewDesc );
+        storedNumBytes = sizeof( uint64_t ) + sizeReader.ReadUInt64( );
+        return true;
+    }
+
+    BlockCompressionIndex index;
+    if ( !ReadBlockIndex( offset, numBytes, index ) )
+    {
+        return false;
+    }
+    storedNumBytes = index.BlocksOffset + index.BlockOffsets.back( );
+    return true;
+}
+
+BinaryReader *Bundle::OpenBlockCompressedReader( const uint64_t offset, const uint64_t numBytes ) const
+{
+    BlockCompressionIndex index;
+    if ( !ReadBlockIndex( offset, numBytes, index ) )
+    {
+        return nullptr;
+    }
+
+    // Blocks are only decompressed as they are read, straight out of the mapping when possible
+    const uint64_t                blocksOffset       = offset + index.BlocksOffset;
+    const uint64_t                compressedNumBytes = index.BlockOffsets.back( );
+    std::unique_ptr<std::istream> stream;
+    if ( m_mappedFile && m_mappedFile->Contains( blocksOffset, compressedNumBytes ) )
+    {
+        stream = std::make_unique<BlockDecompressionStream>( std::move( index ), m_mappedFile->View( blocksOffset, compressedNumBytes ).Elements );
+    }
+    else
+    {
+        stream = std::make_unique<BlockDecompressionStream>( std::move( index ), m_readFile, blocksOffset );
+    }
+    return new BinaryReader( std::move( stream ) );
+}
+
+BinaryReader *Bundle::OpenLegacyCompressedReader( const uint64_t offset, const uint64_t numBytes ) const
+{
+    BinaryReaderDesc viewDesc{ };
+    viewDesc.CopyData = false;
+
+    std::vector<Byte> sizeStorage;
+    ByteArrayView     sizeBytes{ nullptr, 0 };
+    if ( !ReadRange( offset, sizeof( uint64_t ), sizeStorage, sizeBytes ) )
+    {
+        return nullptr;
+    }
+
+    BinaryReader      sizeReader( sizeBytes, viewDesc );
+    const uint64_t    compressedSize = sizeReader.ReadUInt64( );
+    std::vector<Byte> compressedStorage;
+    ByteArrayView     compressedData{ nullptr, 0 };
+    if ( !ReadRange( offset + sizeof( uint64_t ), compressedSize, compressedStorage, compressedData ) )
+    {
+        return nullptr;
+    }
+
+    std::vector<Byte> decompressedData( numBytes );
+    mz_ulong          decompressedSize = static_cast<mz_ulong>( numBytes );
+    const int result = mz_uncompress( decompressedData.data( ), &decompressedSize, compressedData.Elements, static_cast<mz_ulong>( compressedData.NumElements ) );
+
+    if ( result != MZ_OK )
+    {
+        spdlog::error( "Failed to decompress asset at offset {}", offset );
+        return nullptr;
+    }
+
+    ByteArray decompressedDataArray{ };
+    decompressedDataArray.Elements    = decompressedData.data( );
+    decompressedDataArray.NumElements = decompressedSize;
+    return new BinaryReader( ByteArrayView( decompressedDataArray ) );
+}
+
 BinaryWriter *Bundle::OpenWriter( const AssetUri &assetUri )
 {
-    const std::string uriStr = assetUri.ToInteropString( ).Get( );
-    if ( const auto it = m_assetEntries.find( uriStr ); it != m_assetEntries.end( ) )
+    if ( m_toc->Contains( assetUri.Hash( ) ) )
     {
         constexpr BinaryWriterDesc desc{ };
         return new BinaryWriter( m_bundleFile, desc );
@@ -251,30 +414,74 @@ void Bundle::LoadTableOfContents( )
     }
 
     m_isCompressed = header.IsCompressed;
-    m_assetEntries.clear( );
-    reader.Seek( header.TOCOffset );
+    m_version      = header.Version;
+    m_tocOffset    = 0;
+    m_tocNumBytes  = 0;
+    m_toc->Clear( );
+    if ( header.NumAssets == 0 )
+    {
+        return;
+    }
 
-    for ( uint32_t i = 0; i < header.NumAssets; i++ )
+    if ( m_version < BundleHeader::HashedTOCVersion )
     {
-        BundleTOCEntry tocEntry;
-        tocEntry.AssetTypeId = reader.ReadUInt32( );
-        tocEntry.Offset      = reader.ReadUInt64( );
-        tocEntry.NumBytes    = reader.ReadUInt64( );
-        tocEntry.PathLength  = reader.ReadUInt32( );
+        reader.Seek( header.TOCOffset );
+        LoadLegacyTableOfContents( reader, header.NumAssets );
+        return;
+    }
 
-        const InteropString path = reader.ReadString( );
+    // The table of contents is used in place, for mapped bundles it is never copied
+    std::vector<Byte> storage;
+    ByteArrayView     toc{ nullptr, 0 };
+    if ( !ReadRange( header.TOCOffset, BundleTableOfContents::HeaderNumBytes, storage, toc ) ||
+         !ReadRange( header.TOCOffset, BundleTableOfContents::NumBytes( toc.Elements, header.NumAssets ), storage, toc ) )
+    {
+        spdlog::error( "Failed to read bundle table of contents" );
+        return;
+    }
 
-        AssetEntry entry;
-        entry.Type     = static_cast<AssetType>( tocEntry.AssetTypeId );
-        entry.Offset   = tocEntry.Offset;
-        entry.NumBytes = tocEntry.NumBytes;
-        entry.Path     = path;
+    const bool loaded = toc.Elements == storage.data( ) ? m_toc->Adopt( std::move( storage ), header.NumAssets ) : m_toc->View( toc.Elements, toc.NumElements, header.NumAssets );
+    if ( loaded )
+    {
+        m_tocOffset   = header.TOCOffset;
+        m_tocNumBytes = toc.NumElements;
+        spdlog::info( "Loaded bundle TOC: {} assets", header.NumAssets );
+    }
+}
 
-        std::string pathStr       = path.Get( );
-        m_assetEntries[ pathStr ] = entry;
+void Bundle::LoadLegacyTableOfContents( BinaryReader &reader, const uint32_t numAssets ) const
+{
+    for ( uint32_t i = 0; i < numAssets; i++ )
+    {
+        const AssetType assetType = static_cast<AssetType>( reader.ReadUInt32( ) );
+        const uint64_t  offset    = reader.ReadUInt64( );
+        const uint64_t  numBytes  = reader.ReadUInt64( );
+        reader.Skip( sizeof( uint32_t ) ); // Path length, the string is length prefixed as well
+        const InteropString path = reader.ReadString( );
+
+        BundleTableOfContents::Entry entry;
+        entry.PathHash = Fnv1a::Hash( path.Get( ), path.NumChars( ) );
+        entry.Type     = assetType;
+        entry.Offset   = offset;
+        entry.NumBytes = numBytes;
+        entry.Path     = path.Get( );
+        m_toc->Add( entry );
     }
 
-    spdlog::info( "Loaded bundle TOC: {} assets", header.NumAssets );
+    spdlog::info( "Loaded bundle TOC: {} assets", numAssets );
+}
+
+void Bundle::WriteLegacyTableOfContents( const BinaryWriter &writer ) const
+{
+    m_toc->ForEach(
+        [ & ]( const BundleTableOfContents::Entry &entry )
+        {
+            writer.WriteUInt32( static_cast<uint32_t>( entry.Type ) );
+            writer.WriteUInt64( entry.Offset );
+            writer.WriteUInt64( entry.NumBytes );
+            writer.WriteUInt32( static_cast<uint32_t>( entry.Path.size( ) ) );
+            writer.WriteString( InteropString( entry.Path.data( ), entry.Path.size( ) ) );
+        } );
 }
 
 void Bundle::WriteEmptyHeader( ) const
@@ -288,22 +495,125 @@ void Bundle::WriteEmptyHeader( ) const
     const BinaryWriter writer( m_bundleFile );
     BundleHeader       header;
     header.Magic        = BundleHeader::BundleHeaderMagic;
-    header.Version      = BundleHeader::Latest;
+    header.Version      = m_version;
     header.NumAssets    = 0;
     header.TOCOffset    = sizeof( BundleHeader );
     header.IsCompressed = m_isCompressed;
+    WriteHeader( writer, header );
+
+    writer.Seek( header.TOCOffset );
+    writer.Flush( );
 
+    spdlog::info( "Created new empty bundle" );
+}
+
+void Bundle::WriteHeader( const BinaryWriter &writer, const BundleHeader &header )
+{
+    writer.Seek( 0 );
     writer.WriteUInt64( header.Magic );
     writer.WriteUInt32( header.Version );
     writer.WriteUInt32( header.NumBytes );
     writer.WriteUInt32( header.NumAssets );
     writer.WriteUInt64( header.TOCOffset );
     writer.WriteByte( header.IsCompressed ? 1 : 0 );
+}
 
-    writer.Seek( header.TOCOffset );
-    writer.Flush( );
+void Bundle::EnsureSpaceMap( )
+{
+    if ( m_spaceMapBuilt )
+    {
+        return;
+    }
+    m_spaceMapBuilt = true;
+    m_spaceMap->Clear( );
 
-    spdlog::info( "Created new empty bundle" );
+    // Older tables of contents aren't measured, those bundles only reuse space of payloads added since they were opened
+    if ( m_version < BundleHeader::HashedTOCVersion )
+    {
+        return;
+    }
+
+    bool measured = true;
+    m_toc->ForEach(
+        [ & ]( const BundleTableOfContents::Entry &entry )
+        {
+            uint64_t storedNumBytes = 0;
+            measured                = measured && ReadStoredNumBytes( entry.Offset, entry.NumBytes, storedNumBytes );
+            m_spaceMap->AddReference( entry.Offset, storedNumBytes );
+        } );
+    m_spaceMap->AddReference( m_tocOffset, m_tocNumBytes );
+    if ( !measured )
+    {
+        spdlog::warn( "Failed to measure bundle assets, free space won't be reused: {}", m_resolvedPath.Get( ) );
+        m_spaceMap->Clear( );
+        return;
+    }
+
+    m_bundleFile->seekp( 0, std::ios::end );
+    m_spaceMap->BuildFreeRanges( SerializedHeaderNumBytes, m_bundleFile->tellp( ) );
+}
+
+void Bundle::ReleasePayload( const uint64_t offset, const uint64_t numBytes )
+{
+    // Empty uncompressed payloads take no space and may share their offset with the payload that follows them
+    if ( ( !m_isCompressed && numBytes == 0 ) || !m_spaceMap->Release( offset ) )
+    {
+        return;
+    }
+    // The space is about to be reused, it can't be a deduplication candidate anymore
+    std::erase_if( m_storedPayloads, [ & ]( const auto &stored ) { return stored.second.Offset == offset; } );
+}
+
+void Bundle::OpenReadHandles( )
+{
+    m_readFile = new RandomAccessFile( );
+    if ( !m_readFile->Open( m_resolvedPath ) )
+    {
+        spdlog::error( "Failed to open bundle for reading: {}", m_resolvedPath.Get( ) );
+    }
+    MapBundleFile( );
+}
+
+bool Bundle::ReadAt( const uint64_t offset, Byte *destination, const uint64_t numBytes ) const
+{
+    return m_readFile != nullptr && m_readFile->ReadAt( offset, destination, numBytes ) == numBytes;
+}
+
+bool Bundle::ReadRange( const uint64_t offset, const uint64_t numBytes, std::vector<Byte> &storage, ByteArrayView &range ) const
+{
+    if ( m_mappedFile && m_mappedFile->Contains( offset, numBytes ) )
+    {
+        range = m_mappedFile->View( offset, numBytes );
+        return true;
+    }
+
+    storage.resize( numBytes );
+    if ( !ReadAt( offset, storage.data( ), numBytes ) )
+    {
+        return false;
+    }
+    range = ByteArrayView( storage.data( ), storage.size( ) );
+    return true;
+}
+
+void Bundle::MapBundleFile( )
+{
+    if ( !m_desc.MemoryMapped )
+    {
+        return;
+    }
+
+    if ( m_mappedFile )
+    {
+        m_retiredMappings.push_back( m_mappedFile );
+    }
+    m_mappedFile = new MemoryMappedFile( );
+    if ( !m_mappedFile->Open( m_resolvedPath ) )
+    {
+        spdlog::warn( "Failed to memory map bundle, falling back to file reads: {}", m_resolvedPath.Get( ) );
+        delete m_mappedFile;
+        m_mappedFile = nullptr;
+    }
 }
 
 void Bundle::AddAsset( const AssetUri &assetUri, const AssetType type, const ByteArrayView &data )
@@ -314,122 +624,437 @@ void Bundle::AddAsset( const AssetUri &assetUri, const AssetType type, const Byt
         return;
     }
 
-    const std::string uriStr = assetUri.ToInteropString( ).Get( );
-    if ( const auto existingIt = m_assetEntries.find( uriStr ); existingIt != m_assetEntries.end( ) )
+    const uint64_t    contentHash = ContentHash::Hash( data );
+    std::lock_guard   lock( m_writeMutex );
+    const std::string uriStr      = assetUri.ToInteropString( ).Get( );
+    const uint64_t    pathHash    = assetUri.Hash( );
+    EnsureSpaceMap( );
+
+    BundleTableOfContents::Entry existing;
+    const bool                   replacing = m_toc->Find( pathHash, existing );
+    if ( replacing )
     {
+        if ( existing.Path != uriStr )
+        {
+            spdlog::error( "Failed to add asset: path hash of {} collides with {}", uriStr, existing.Path );
+            return;
+        }
         spdlog::warn( "Asset already exists in bundle, replacing: {}", uriStr );
     }
 
-    m_bundleFile->seekp( 0, std::ios::end );
-    const uint64_t assetOffset = m_bundleFile->tellp( );
-    const uint64_t numBytes    = data.NumElements;
+    const uint64_t numBytes = data.NumElements;
+    uint64_t       assetOffset;
+    uint64_t       storedNumBytes;
+    if ( const StoredPayload *stored = FindStoredPayload( contentHash, data ) )
+    {
+        spdlog::info( "Asset content already stored in bundle, sharing it: {}", uriStr );
+        assetOffset    = stored->Offset;
+        storedNumBytes = stored->StoredNumBytes;
+    }
+    else
+    {
+        if ( !WritePayload( data, uriStr, assetOffset, storedNumBytes ) )
+        {
+            return;
+        }
+        m_storedPayloads.emplace( contentHash, StoredPayload{ assetOffset, numBytes, storedNumBytes } );
+    }
 
-    const BinaryWriter writer( m_bundleFile );
-    if ( m_isCompressed )
+    // Referenced before the replaced payload is released in case both are the same deduplicated payload
+    m_spaceMap->AddReference( assetOffset, storedNumBytes );
+    if ( replacing )
     {
-        const mz_ulong    sourceSize = static_cast<mz_ulong>( numBytes );
-        const mz_ulong    destSize   = mz_compressBound( sourceSize );
-        std::vector<Byte> compressedData( destSize );
+        ReleasePayload( existing.Offset, existing.NumBytes );
+    }
 
-        mz_ulong  compressedSize = destSize;
-        const int result         = mz_compress( compressedData.data( ), &compressedSize, data.Elements, sourceSize );
+    BundleTableOfContents::Entry entry;
+    entry.PathHash = pathHash;
+    entry.Type     = type;
+    entry.Offset   = assetOffset;
+    entry.NumBytes = numBytes;
+    entry.Path     = uriStr;
+    m_toc->Add( entry );
+    m_isDirty = true;
 
-        if ( result != MZ_OK )
+    spdlog::info( "Added asset to bundle: {} ({} bytes)", uriStr, numBytes );
+}
+
+bool Bundle::WritePayload( const ByteArrayView &data, const std::string &uriStr, uint64_t &offset, uint64_t &storedNumBytes )
+{
+    std::vector<Byte> compressedData;
+    ByteArrayView     payload      = data;
+    bool              sizePrefixed = false;
+    if ( m_isCompressed && m_version >= BundleHeader::BlockCompressionVersion )
+    {
+        if ( !BlockCompression::Compress( data, m_desc.CompressionBlockSize, compressedData ) )
         {
             spdlog::error( "Failed to compress asset: {}", uriStr );
-            return;
+            return false;
         }
-
-        std::vector<Byte> compressedInteropData( compressedSize );
-        for ( size_t i = 0; i < compressedSize; ++i )
+        payload = ByteArrayView( compressedData.data( ), compressedData.size( ) );
+    }
+    // Bundles written before block compression keep their single blob layout so their existing assets stay readable
+    else if ( m_isCompressed )
+    {
+        const mz_ulong sourceSize     = static_cast<mz_ulong>( data.NumElements );
+        mz_ulong       compressedSize = mz_compressBound( sourceSize );
+        compressedData.resize( compressedSize );
+        if ( mz_compress( compressedData.data( ), &compressedSize, data.Elements, sourceSize ) != MZ_OK )
         {
-            compressedInteropData[ i ] = compressedData[ i ];
+            spdlog::error( "Failed to compress asset: {}", uriStr );
+            return false;
         }
+        payload      = ByteArrayView( compressedData.data( ), compressedSize );
+        sizePrefixed = true;
+    }
 
-        writer.WriteUInt64( compressedSize );
-        ByteArrayView compressedDataArray{ };
-        compressedDataArray.Elements    = compressedInteropData.data( );
-        compressedDataArray.NumElements = compressedInteropData.size( );
-        writer.WriteBytes( compressedDataArray );
+    // Dead space is reused when the payload fits in it, otherwise the payload is appended
+    storedNumBytes = payload.NumElements + ( sizePrefixed ? sizeof( uint64_t ) : 0 );
+    if ( m_spaceMap->Allocate( storedNumBytes, offset ) )
+    {
+        m_bundleFile->seekp( static_cast<std::streamoff>( offset ) );
     }
     else
     {
-        writer.WriteBytes( data );
+        m_bundleFile->seekp( 0, std::ios::end );
+        offset = m_bundleFile->tellp( );
     }
 
-    AssetEntry entry;
-    entry.Type     = type;
-    entry.Offset   = assetOffset;
-    entry.NumBytes = numBytes;
-    entry.Path     = assetUri.Path;
+    const BinaryWriter writer( m_bundleFile );
+    if ( sizePrefixed )
+    {
+        writer.WriteUInt64( payload.NumElements );
+    }
+    writer.WriteBytes( payload );
+    // Reads go through a separate handle, make the bytes visible to it
+    writer.Flush( );
+    return true;
+}
 
-    m_assetEntries[ uriStr ] = entry;
-    m_isDirty                = true;
+const Bundle::StoredPayload *Bundle::FindStoredPayload( const uint64_t contentHash, const ByteArrayView &data ) const
+{
+    const auto [ begin, end ] = m_storedPayloads.equal_range( contentHash );
+    for ( auto it = begin; it != end; ++it )
+    {
+        if ( it->second.NumBytes != data.NumElements )
+        {
+            continue;
+        }
 
-    spdlog::info( "Added asset to bundle: {} ({} bytes)", uriStr, numBytes );
+        // Hashes only nominate candidates, the stored bytes are compared before the payload is shared
+        const std::unique_ptr<BinaryReader> reader( OpenAssetReader( it->second.Offset, it->second.NumBytes ) );
+        if ( reader == nullptr )
+        {
+            continue;
+        }
+
+        constexpr uint64_t chunkNumBytes = 64 * 1024;
+        std::vector<Byte>  chunk( std::min( chunkNumBytes, data.NumElements ) );
+        bool               matches = true;
+        for ( uint64_t position = 0; matches && position < data.NumElements; position += chunkNumBytes )
+        {
+            const uint64_t numBytes = std::min( chunkNumBytes, data.NumElements - position );
+            matches = reader->ReadArray( chunk.data( ), numBytes ) && std::memcmp( chunk.data( ), data.Elements + position, numBytes ) == 0;
+        }
+        if ( matches )
+        {
+            return &it->second;
+        }
+    }
+    return nullptr;
 }
 
 bool Bundle::Exists( const AssetUri &assetUri ) const
 {
-    return m_assetEntries.contains( assetUri.ToInteropString( ).Get( ) );
+    return m_toc->Contains( assetUri.Hash( ) );
 }
 
 bool Bundle::Save( )
 {
+    std::lock_guard lock( m_writeMutex );
     if ( !m_bundleFile || !m_bundleFile->good( ) )
     {
         spdlog::error( "Failed to save bundle: invalid file stream" );
         return false;
     }
 
+    EnsureSpaceMap( );
     m_bundleFile->seekg( 0, std::ios::end );
-    const uint64_t currentSize  = m_bundleFile->tellg( );
-    const uint64_t newTocOffset = currentSize;
+    const uint64_t fileNumBytes = m_bundleFile->tellg( );
+    uint64_t       newTocOffset = fileNumBytes;
 
     const BinaryWriter writer( m_bundleFile );
-    writer.Seek( newTocOffset );
-
-    for ( const auto &entry : m_assetEntries )
+    std::vector<Byte>  toc;
+    if ( m_version >= BundleHeader::HashedTOCVersion )
     {
-        writer.WriteUInt32( static_cast<uint32_t>( entry.second.Type ) );
-        writer.WriteUInt64( entry.second.Offset );
-        writer.WriteUInt64( entry.second.NumBytes );
-        writer.WriteUInt32( static_cast<uint32_t>( entry.first.length( ) ) );
-        writer.WriteString( InteropString( entry.first.c_str( ) ) );
+        // Written into free space when it fits, the table of contents currently on disk stays intact until the header points at the new one
+        m_toc->Serialize( toc );
+        if ( !m_spaceMap->Allocate( toc.size( ), newTocOffset ) )
+        {
+            newTocOffset = fileNumBytes;
+        }
+        writer.Seek( newTocOffset );
+        writer.WriteBytes( ByteArrayView( toc.data( ), toc.size( ) ) );
+    }
+    else
+    {
+        writer.Seek( newTocOffset );
+        WriteLegacyTableOfContents( writer );
     }
 
     BundleHeader header;
     header.Magic        = BundleHeader::BundleHeaderMagic;
-    header.Version      = BundleHeader::Latest;
-    header.NumAssets    = static_cast<uint32_t>( m_assetEntries.size( ) );
+    header.Version      = m_version;
+    header.NumAssets    = m_toc->NumEntries( );
     header.TOCOffset    = newTocOffset;
     header.IsCompressed = m_isCompressed;
 
-    writer.Seek( 0 );
-    writer.WriteUInt64( header.Magic );
-    writer.WriteUInt32( header.Version );
-    writer.WriteUInt32( header.NumBytes );
-    writer.WriteUInt32( header.NumAssets );
-    writer.WriteUInt64( header.TOCOffset );
-    writer.WriteByte( header.IsCompressed ? 1 : 0 );
+    WriteHeader( writer, header );
 
     writer.Flush( );
     m_isDirty = false;
+    MapBundleFile( );
+
+    // Nothing on disk references the previous table of contents or replaced payloads anymore
+    if ( m_tocNumBytes > 0 )
+    {
+        m_spaceMap->Release( m_tocOffset );
+    }
+    m_tocOffset   = newTocOffset;
+    m_tocNumBytes = toc.size( );
+    m_spaceMap->AddReference( m_tocOffset, m_tocNumBytes );
+    m_spaceMap->Commit( );
+
+    // Switch lookups over to the table of contents that was just written
+    if ( m_version >= BundleHeader::HashedTOCVersion )
+    {
+        if ( m_mappedFile && m_mappedFile->Contains( newTocOffset, toc.size( ) ) )
+        {
+            m_toc->View( m_mappedFile->View( newTocOffset, toc.size( ) ).Elements, toc.size( ), header.NumAssets );
+        }
+        else
+        {
+            m_toc->Adopt( std::move( toc ), header.NumAssets );
+        }
+    }
 
     spdlog::info( "Saved bundle with {} assets", header.NumAssets );
     return true;
 }
 
-AssetUriArray Bundle::GetAllAssets( ) const
+bool Bundle::Compact( const BundleCompactDesc &desc )
 {
-    if ( m_allAssets.size( ) != m_assetEntries.size( ) )
+    std::lock_guard lock( m_writeMutex );
+    if ( !m_bundleFile || !m_bundleFile->good( ) )
     {
-        m_allAssets.clear( );
-        m_allAssets.reserve( m_assetEntries.size( ) );
-        for ( const auto &key : m_assetEntries | std::views::keys )
+        spdlog::error( "Failed to compact bundle: invalid file stream" );
+        return false;
+    }
+
+    std::unordered_map<uint64_t, size_t> loadOrder;
+    for ( uint32_t i = 0; i < desc.LoadOrder.NumElements; ++i )
+    {
+        loadOrder.try_emplace( desc.LoadOrder.Elements[ i ].Hash( ), i );
+    }
+    const auto loadRank = [ & ]( const BundleTableOfContents::Entry &entry )
+    {
+        const auto it = loadOrder.find( entry.PathHash );
+        return it == loadOrder.end( ) ? loadOrder.size( ) : it->second;
+    };
+
+    std::vector<BundleTableOfContents::Entry> entries;
+    entries.reserve( m_toc->NumEntries( ) );
+    m_toc->ForEach( [ & ]( const BundleTableOfContents::Entry &entry ) { entries.push_back( entry ); } );
+    std::ranges::sort( entries,
+                       [ & ]( const BundleTableOfContents::Entry &a, const BundleTableOfContents::Entry &b )
+                       {
+                           if ( const size_t rankA = loadRank( a ), rankB = loadRank( b ); rankA != rankB )
+                           {
+                               return rankA < rankB;
+                           }
+                           switch ( desc.Order )
+                           {
+                           case BundleCompactOrder::Offset:
+                               return a.Offset < b.Offset;
+                           case BundleCompactOrder::Type:
+                               return a.Type != b.Type ? a.Type < b.Type : a.Path < b.Path;
+                           case BundleCompactOrder::Path:
+                               return a.Path < b.Path;
+                           }
+                           return false;
+                       } );
+
+    // Written next to the bundle and swapped in once complete, a failure leaves the bundle untouched
+    const std::string     bundlePath  = m_resolvedPath.Get( );
+    const std::string     compactPath = bundlePath + ".compact";
+    BundleTableOfContents compacted;
+    bool                  succeeded = true;
+    // Old offset to the new offset and stored size, payloads shared by deduplicated assets are copied once and stay shared
+    std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> movedPayloads;
+    {
+        std::ofstream      output( compactPath, std::ios::binary | std::ios::trunc );
+        const BinaryWriter writer( &output );
+        WriteHeader( writer, BundleHeader( ) );
+
+        uint64_t position = SerializedHeaderNumBytes;
+        for ( BundleTableOfContents::Entry entry : entries )
         {
-            m_allAssets.push_back( AssetUri::Parse( InteropString( key.c_str( ) ) ) );
+            // Empty uncompressed payloads store nothing and may share their offset with the next payload, they must not claim that offset
+            if ( !m_isCompressed && entry.NumBytes == 0 )
+            {
+                entry.Offset = position;
+                compacted.Add( entry );
+                continue;
+            }
+
+            auto [ moved, inserted ] = movedPayloads.try_emplace( entry.Offset, position, 0 );
+            if ( inserted )
+            {
+                if ( !CopyPayload( entry.Offset, entry.NumBytes, writer, moved->second.second ) )
+                {
+                    spdlog::error( "Failed to compact bundle: could not copy asset {}", entry.Path );
+                    succeeded = false;
+                    break;
+                }
+                position += moved->second.second;
+            }
+            entry.Offset = moved->second.first;
+            compacted.Add( entry );
         }
+
+        if ( succeeded )
+        {
+            std::vector<Byte> toc;
+            compacted.Serialize( toc );
+            writer.WriteBytes( ByteArrayView( toc.data( ), toc.size( ) ) );
+
+            BundleHeader header;
+            header.Magic        = BundleHeader::BundleHeaderMagic;
+            header.Version      = BundleHeader::Latest;
+            header.NumAssets    = compacted.NumEntries( );
+            header.TOCOffset    = position;
+            header.IsCompressed = m_isCompressed;
+            WriteHeader( writer, header );
+            writer.Flush( );
+            succeeded = output.good( );
+        }
+    }
+
+    if ( !succeeded )
+    {
+        std::filesystem::remove( compactPath );
+        return false;
+    }
+
+    // Handles are closed first, open files can't be replaced on every platform. Mappings are retired since readers may still view them
+    delete m_bundleFile;
+    delete m_readFile;
+    m_bundleFile = nullptr;
+    m_readFile   = nullptr;
+    if ( m_mappedFile )
+    {
+        m_retiredMappings.push_back( m_mappedFile );
+        m_mappedFile = nullptr;
+    }
+
+    std::error_code error;
+    ReplaceBundleFile( compactPath, bundlePath, error );
+    if ( error )
+    {
+        spdlog::error( "Failed to replace bundle with its compacted copy: {}", error.message( ) );
+        std::filesystem::remove( compactPath );
+    }
+
+    m_bundleFile = new std::fstream( bundlePath, std::ios::binary | std::ios::in | std::ios::out );
+    OpenReadHandles( );
+    LoadTableOfContents( );
+    m_spaceMapBuilt = false;
+    if ( error )
+    {
+        return false;
+    }
+
+    // Empty uncompressed payloads weren't moved, their old offset may now point at another payload
+    std::erase_if( m_storedPayloads,
+                   [ & ]( const auto &stored ) { return ( !m_isCompressed && stored.second.NumBytes == 0 ) || !movedPayloads.contains( stored.second.Offset ); } );
+    for ( auto &[ contentHash, stored ] : m_storedPayloads )
+    {
+        const auto [ offset, storedNumBytes ] = movedPayloads.at( stored.Offset );
+        stored.Offset                         = offset;
+        stored.StoredNumBytes                 = storedNumBytes;
+    }
+    m_isDirty = false;
+    spdlog::info( "Compacted bundle with {} assets", compacted.NumEntries( ) );
+    return true;
+}
+
+void Bundle::ReplaceBundleFile( const std::string &replacementPath, const std::string &bundlePath, std::error_code &error ) const
+{
+#ifdef _WIN32
+    // Retired mappings keep the old file open, Windows refuses to replace a file with open handles but lets it be renamed aside and
+    // deleted since mappings share delete access. The deleted file goes away once the last retired mapping is closed.
+    const std::string retiredPath = bundlePath + ".retired" + std::to_string( m_retiredMappings.size( ) );
+    std::filesystem::rename( bundlePath, retiredPath, error );
+    if ( error )
+    {
+        return;
+    }
+    std::filesystem::rename( replacementPath, bundlePath, error );
+    if ( error )
+    {
+        std::error_code restoreError;
+        std::filesystem::rename( retiredPath, bundlePath, restoreError );
+        return;
+    }
+    std::error_code removeError;
+    if ( !std::filesystem::remove( retiredPath, removeError ) )
+    {
+        spdlog::warn( "Failed to remove replaced bundle file {}: {}", retiredPath, removeError.message( ) );
+    }
+#else
+    // Mappings of the old file stay valid after it is unlinked
+    std::filesystem::rename( replacementPath, bundlePath, error );
+#endif
+}
+
+bool Bundle::CopyPayload( const uint64_t offset, const uint64_t numBytes, const BinaryWriter &writer, uint64_t &numBytesWritten ) const
+{
+    // Compacted bundles are always the latest version, compressed payloads from before block compression are recompressed
+    if ( m_isCompressed && m_version < BundleHeader::BlockCompressionVersion )
+    {
+        const std::unique_ptr<BinaryReader> reader( OpenAssetReader( offset, numBytes ) );
+        std::vector<Byte>                   data( numBytes );
+        std::vector<Byte>                   compressedData;
+        if ( reader == nullptr || !reader->ReadArray( data.data( ), data.size( ) ) ||
+             !BlockCompression::Compress( ByteArrayView( data.data( ), data.size( ) ), m_desc.CompressionBlockSize, compressedData ) )
+        {
+            return false;
+        }
+        writer.WriteBytes( ByteArrayView( compressedData.data( ), compressedData.size( ) ) );
+        numBytesWritten = compressedData.size( );
+        return true;
+    }
+
+    uint64_t          storedNumBytes = 0;
+    std::vector<Byte> storage;
+    ByteArrayView     payload{ nullptr, 0 };
+    if ( !ReadStoredNumBytes( offset, numBytes, storedNumBytes ) || !ReadRange( offset, storedNumBytes, storage, payload ) )
+    {
+        return false;
+    }
+    writer.WriteBytes( payload );
+    numBytesWritten = storedNumBytes;
+    return true;
+}
+
+AssetUriArray Bundle::GetAllAssets( ) const
+{
+    if ( m_allAssets.size( ) != m_toc->NumEntries( ) )
+    {
+        m_allAssets.clear( );
+        m_allAssets.reserve( m_toc->NumEntries( ) );
+        m_toc->ForEach( [ & ]( const BundleTableOfContents::Entry &entry )
+                        { m_allAssets.push_back( AssetUri::Parse( InteropString( entry.Path.data( ), entry.Path.size( ) ) ) ); } );
     }
 
     AssetUriArray result{ };
@@ -441,15 +1066,14 @@ AssetUriArray Bundle::GetAllAssets( ) const
 AssetUriArray Bundle::GetAssetsByType( const AssetType type ) const
 {
     m_assetsByType.clear( );
-    m_assetsByType.reserve( m_assetEntries.size( ) );
-
-    for ( const auto &entry : m_assetEntries )
-    {
-        if ( entry.second.Type == type )
+    m_toc->ForEach(
+        [ & ]( const BundleTableOfContents::Entry &entry )
         {
-            m_assetsByType.push_back( AssetUri::Parse( InteropString( entry.first.c_str( ) ) ) );
-        }
-    }
+            if ( entry.Type == type )
+            {
+                m_assetsByType.push_back( AssetUri::Parse( InteropString( entry.Path.data( ), entry.Path.size( ) ) ) );
+            }
+        } );
 
     AssetUriArray result{ };
     result.Elements    = m_assetsByType.data( );
@@ -68,23 +68,40 @@ void BundleManager::MountDirectory( const InteropString &directoryPath, bool rec
     MountBundle( bundle );
 }
 
-BinaryReader *BundleManager::OpenReader( const AssetUri &path )
+Bundle *BundleManager::FindBundle( const AssetUri &path )
 {
-    const std::string uriStr = path.ToInteropString( ).Get( );
-
-    if ( const auto cacheIt = m_assetLocationCache.find( uriStr ); cacheIt != m_assetLocationCache.end( ) )
+    const uint64_t pathHash = path.Hash( );
     {
-        return cacheIt->second->OpenReader( path );
+        std::shared_lock lock( m_cacheMutex );
+        if ( const auto cacheIt = m_assetLocationCache.find( pathHash ); cacheIt != m_assetLocationCache.end( ) )
+        {
+            return cacheIt->second;
+        }
     }
 
     for ( Bundle *bundle : m_mountedBundles )
     {
         if ( bundle->Exists( path ) )
         {
-            m_assetLocationCache[ uriStr ] = bundle;
-            return bundle->OpenReader( path );
+            std::unique_lock lock( m_cacheMutex );
+            m_assetLocationCache.try_emplace( pathHash, bundle );
+            return bundle;
         }
     }
+    return nullptr;
+}
+
+BinaryReader *BundleManager::OpenReader( const AssetUri &path )
+{
+    if ( AssetAccessTrace *trace = m_accessTrace.load( std::memory_order_acquire ) )
+    {
+        trace->Record( path );
+    }
+
+    if ( Bundle *bundle = FindBundle( path ) )
+    {
+        return bundle->OpenReader( path );
+    }
 
     // If it's not in any bundle, return from filesystem
     const InteropString resolvedPath = FileIO::GetResourcePath( path.Path );
@@ -98,19 +115,9 @@ BinaryReader *BundleManager::OpenReader( const AssetUri &path )
 
 BinaryWriter *BundleManager::OpenWriter( const AssetUri &path )
 {
-    const std::string uriStr = path.ToInteropString( ).Get( );
-    if ( const auto cacheIt = m_assetLocationCache.find( uriStr ); cacheIt != m_assetLocationCache.end( ) )
+    if ( Bundle *bundle = FindBundle( path ) )
     {
-        return cacheIt->second->OpenWriter( path );
-    }
-
-    for ( Bundle *bundle : m_mountedBundles )
-    {
-        if ( bundle->Exists( path ) )
-        {
-            m_assetLocationCache[ uriStr ] = bundle;
-            return bundle->OpenWriter( path );
-        }
+        return bundle->OpenWriter( path );
     }
 
     // If it's not in any bundle, return from filesystem
@@ -141,27 +148,17 @@ void BundleManager::AddAsset( Bundle *bundle, const AssetUri &path, AssetType ty
     }
 
     bundle->AddAsset( path, type, data );
-    const std::string uriStr       = path.ToInteropString( ).Get( );
-    m_assetLocationCache[ uriStr ] = bundle;
+    std::unique_lock lock( m_cacheMutex );
+    m_assetLocationCache[ path.Hash( ) ] = bundle;
 }
 
 bool BundleManager::Exists( const AssetUri &path )
 {
-    const std::string uriStr = path.ToInteropString( ).Get( );
-    if ( const auto cacheIt = m_assetLocationCache.find( uriStr ); cacheIt != m_assetLocationCache.end( ) )
+    if ( FindBundle( path ) )
     {
         return true;
     }
 
-    for ( Bundle *bundle : m_mountedBundles )
-    {
-        if ( bundle->Exists( path ) )
-        {
-            m_assetLocationCache[ uriStr ] = bundle;
-            return true;
-        }
-    }
-
     const InteropString resolvedPath = FileIO::GetResourcePath( path.Path );
     if ( FileIO::FileExists( resolvedPath ) )
     {
@@ -173,20 +170,29 @@ bool BundleManager::Exists( const AssetUri &path )
 
 void BundleManager::InvalidateCache( )
 {
+    std::unique_lock lock( m_cacheMutex );
     m_assetLocationCache.clear( );
     m_allAssets.clear( );
     m_assetsByType.clear( );
 }
 
-InteropString BundleManager::ResolveToFilesystemPath( const AssetUri &path )
+void BundleManager::SetAccessTrace( AssetAccessTrace *trace )
 {
-    const std::string pathStr = path.Path.Get( );
+    m_accessTrace.store( trace, std::memory_order_release );
+}
 
-    if ( const auto cacheIt = m_assetLocationCache.find( pathStr ); cacheIt != m_assetLocationCache.end( ) )
+InteropString BundleManager::ResolveToFilesystemPath( const AssetUri &path )
+{
     {
-        return InteropString{ };
+        std::shared_lock lock( m_cacheMutex );
+        if ( m_assetLocationCache.contains( path.Hash( ) ) )
+        {
+            return InteropString{ };
+        }
     }
 
+    const std::string pathStr = path.Path.Get( );
+
     const std::filesystem::path searchPath( m_defaultSearchPath.Get( ) );
     const std::filesystem::path assetPath( pathStr );
     const std::filesystem::path fullPath = searchPath / assetPath;
@@ -0,0 +1,147 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphicsInternal/Assets/Bundle/BundleSpaceMap.h"
+#include <algorithm>
+
+using namespace DenOfIz;
+
+void BundleSpaceMap::Clear( )
+{
+    m_extents.clear( );
+    m_freeRanges.clear( );
+    m_releasedRanges.clear( );
+}
+
+void BundleSpaceMap::AddReference( const uint64_t offset, const uint64_t numBytes )
+{
+    if ( numBytes == 0 )
+    {
+        return;
+    }
+
+    Extent &extent  = m_extents[ offset ];
+    extent.NumBytes = std::max( extent.NumBytes, numBytes );
+    ++extent.NumReferences;
+}
+
+bool BundleSpaceMap::Release( const uint64_t offset )
+{
+    const auto it = m_extents.find( offset );
+    if ( it == m_extents.end( ) || --it->second.NumReferences > 0 )
+    {
+        return false;
+    }
+
+    m_releasedRanges.push_back( { offset, it->second.NumBytes } );
+    m_extents.erase( it );
+    return true;
+}
+
+void BundleSpaceMap::BuildFreeRanges( const uint64_t reservedNumBytes, const uint64_t fileNumBytes )
+{
+    std::vector<Range> liveRanges;
+    liveRanges.reserve( m_extents.size( ) + m_releasedRanges.size( ) );
+    for ( const auto &[ offset, extent ] : m_extents )
+    {
+        liveRanges.push_back( { offset, extent.NumBytes } );
+    }
+    // Released ranges are still live until they are committed
+    liveRanges.insert( liveRanges.end( ), m_releasedRanges.begin( ), m_releasedRanges.end( ) );
+    std::ranges::sort( liveRanges, { }, &Range::Offset );
+
+    m_freeRanges.clear( );
+    uint64_t position = reservedNumBytes;
+    for ( const Range &range : liveRanges )
+    {
+        if ( range.Offset > position )
+        {
+            Free( position, std::min( range.Offset, fileNumBytes ) - position );
+        }
+        position = std::max( position, range.Offset + range.NumBytes );
+    }
+    if ( fileNumBytes > position )
+    {
+        Free( position, fileNumBytes - position );
+    }
+}
+
+bool BundleSpaceMap::Allocate( const uint64_t numBytes, uint64_t &offset )
+{
+    if ( numBytes == 0 )
+    {
+        return false;
+    }
+
+    auto bestFit = m_freeRanges.end( );
+    for ( auto it = m_freeRanges.begin( ); it != m_freeRanges.end( ); ++it )
+    {
+        if ( it->second >= numBytes && ( bestFit == m_freeRanges.end( ) || it->second < bestFit->second ) )
+        {
+            bestFit = it;
+        }
+    }
+    if ( bestFit == m_freeRanges.end( ) )
+    {
+        return false;
+    }
+
+    offset                   = bestFit->first;
+    const uint64_t remainder   = bestFit->second - numBytes;
+    m_freeRanges.erase( bestFit );
+    if ( remainder > 0 )
+    {
+        m_freeRanges.emplace( offset + numBytes, remainder );
+    }
+    return true;
+}
+
+void BundleSpaceMap::Commit( )
+{
+    for ( const Range &range : m_releasedRanges )
+    {
+        Free( range.Offset, range.NumBytes );
+    }
+    m_releasedRanges.clear( );
+}
+
+void BundleSpaceMap::Free( uint64_t offset, uint64_t numBytes )
+{
+    if ( numBytes == 0 )
+    {
+        return;
+    }
+
+    auto next = m_freeRanges.lower_bound( offset );
+    if ( next != m_freeRanges.begin( ) )
+    {
+        if ( const auto previous = std::prev( next ); previous->first + previous->second == offset )
+        {
+            offset = previous->first;
+            numBytes += previous->second;
+            m_freeRanges.erase( previous );
+        }
+    }
+    if ( next != m_freeRanges.end( ) && offset + numBytes == next->first )
+    {
+        numBytes += next->second;
+        m_freeRanges.erase( next );
+    }
+    m_freeRanges[ offset ] = numBytes;
+}
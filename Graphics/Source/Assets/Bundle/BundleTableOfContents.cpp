@@ -0,0 +1,198 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphicsInternal/Assets/Bundle/BundleTableOfContents.h"
+#include <algorithm>
+#include "DenOfIzGraphicsInternal/Assets/Stream/LittleEndian.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr uint32_t OffsetFieldOffset     = sizeof( uint64_t );
+    constexpr uint32_t NumBytesFieldOffset   = 2 * sizeof( uint64_t );
+    constexpr uint32_t TypeFieldOffset       = 3 * sizeof( uint64_t );
+    constexpr uint32_t PathOffsetFieldOffset = TypeFieldOffset + sizeof( uint32_t );
+    constexpr uint32_t PathLengthFieldOffset = PathOffsetFieldOffset + sizeof( uint32_t );
+} // namespace
+
+uint64_t BundleTableOfContents::NumBytes( const Byte *header, const uint32_t numEntries )
+{
+    return HeaderNumBytes + static_cast<uint64_t>( numEntries ) * RecordNumBytes + LittleEndian::ReadUInt64( header );
+}
+
+bool BundleTableOfContents::View( const Byte *data, const uint64_t numBytes, const uint32_t numEntries )
+{
+    m_storage.clear( );
+    return SetRecords( data, numBytes, numEntries );
+}
+
+bool BundleTableOfContents::Adopt( std::vector<Byte> data, const uint32_t numEntries )
+{
+    m_storage = std::move( data );
+    return SetRecords( m_storage.data( ), m_storage.size( ), numEntries );
+}
+
+void BundleTableOfContents::Clear( )
+{
+    m_records       = nullptr;
+    m_numRecords    = 0;
+    m_paths         = nullptr;
+    m_pathsNumBytes = 0;
+    m_numShadowed   = 0;
+    m_storage.clear( );
+    m_addedEntries.clear( );
+}
+
+bool BundleTableOfContents::SetRecords( const Byte *data, const uint64_t numBytes, const uint32_t numEntries )
+{
+    m_addedEntries.clear( );
+    m_numShadowed = 0;
+
+    const uint64_t recordsNumBytes = static_cast<uint64_t>( numEntries ) * RecordNumBytes;
+    if ( numBytes < HeaderNumBytes + recordsNumBytes || numBytes < NumBytes( data, numEntries ) )
+    {
+        spdlog::error( "Bundle table of contents is truncated" );
+        m_records    = nullptr;
+        m_numRecords = 0;
+        return false;
+    }
+
+    m_records       = data + HeaderNumBytes;
+    m_numRecords    = numEntries;
+    m_paths         = reinterpret_cast<const char *>( m_records + recordsNumBytes );
+    m_pathsNumBytes = LittleEndian::ReadUInt64( data );
+    return true;
+}
+
+bool BundleTableOfContents::Find( const uint64_t pathHash, Entry &entry ) const
+{
+    if ( const auto it = m_addedEntries.find( pathHash ); it != m_addedEntries.end( ) )
+    {
+        entry = it->second.Value;
+        return true;
+    }
+    return FindRecord( pathHash, entry );
+}
+
+bool BundleTableOfContents::Contains( const uint64_t pathHash ) const
+{
+    Entry entry;
+    return Find( pathHash, entry );
+}
+
+uint32_t BundleTableOfContents::NumEntries( ) const
+{
+    return m_numRecords - m_numShadowed + static_cast<uint32_t>( m_addedEntries.size( ) );
+}
+
+void BundleTableOfContents::Add( const Entry &entry )
+{
+    auto [ it, inserted ] = m_addedEntries.try_emplace( entry.PathHash );
+    if ( inserted )
+    {
+        if ( Entry existing; FindRecord( entry.PathHash, existing ) )
+        {
+            ++m_numShadowed;
+        }
+    }
+
+    AddedEntry &added = it->second;
+    added.Path        = entry.Path;
+    added.Value       = entry;
+    added.Value.Path  = added.Path;
+}
+
+void BundleTableOfContents::Serialize( std::vector<Byte> &result ) const
+{
+    std::vector<Entry> entries;
+    entries.reserve( NumEntries( ) );
+    ForEach( [ & ]( const Entry &entry ) { entries.push_back( entry ); } );
+    std::ranges::sort( entries, { }, &Entry::PathHash );
+
+    uint64_t pathsNumBytes = 0;
+    for ( const Entry &entry : entries )
+    {
+        pathsNumBytes += entry.Path.size( );
+    }
+
+    result.clear( );
+    result.reserve( HeaderNumBytes + entries.size( ) * RecordNumBytes + pathsNumBytes );
+    LittleEndian::AppendUInt64( result, pathsNumBytes );
+
+    uint32_t pathOffset = 0;
+    for ( const Entry &entry : entries )
+    {
+        LittleEndian::AppendUInt64( result, entry.PathHash );
+        LittleEndian::AppendUInt64( result, entry.Offset );
+        LittleEndian::AppendUInt64( result, entry.NumBytes );
+        LittleEndian::AppendUInt32( result, static_cast<uint32_t>( entry.Type ) );
+        LittleEndian::AppendUInt32( result, pathOffset );
+        LittleEndian::AppendUInt32( result, static_cast<uint32_t>( entry.Path.size( ) ) );
+        pathOffset += static_cast<uint32_t>( entry.Path.size( ) );
+    }
+    for ( const Entry &entry : entries )
+    {
+        result.insert( result.end( ), entry.Path.begin( ), entry.Path.end( ) );
+    }
+}
+
+BundleTableOfContents::Entry BundleTableOfContents::ReadRecord( const uint32_t index ) const
+{
+    const Byte *record = m_records + static_cast<uint64_t>( index ) * RecordNumBytes;
+
+    Entry entry;
+    entry.PathHash            = LittleEndian::ReadUInt64( record );
+    entry.Offset              = LittleEndian::ReadUInt64( record + OffsetFieldOffset );
+    entry.NumBytes            = LittleEndian::ReadUInt64( record + NumBytesFieldOffset );
+    entry.Type                = static_cast<AssetType>( LittleEndian::ReadUInt32( record + TypeFieldOffset ) );
+    const uint64_t pathOffset = LittleEndian::ReadUInt32( record + PathOffsetFieldOffset );
+    const uint64_t pathLength = LittleEndian::ReadUInt32( record + PathLengthFieldOffset );
+    if ( pathOffset + pathLength <= m_pathsNumBytes )
+    {
+        entry.Path = std::string_view( m_paths + pathOffset, pathLength );
+    }
+    return entry;
+}
+
+bool BundleTableOfContents::FindRecord( const uint64_t pathHash, Entry &entry ) const
+{
+    uint32_t first = 0;
+    uint32_t count = m_numRecords;
+    while ( count > 0 )
+    {
+        const uint32_t step = count / 2;
+        if ( LittleEndian::ReadUInt64( m_records + static_cast<uint64_t>( first + step ) * RecordNumBytes ) < pathHash )
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    if ( first == m_numRecords || LittleEndian::ReadUInt64( m_records + static_cast<uint64_t>( first ) * RecordNumBytes ) != pathHash )
+    {
+        return false;
+    }
+    entry = ReadRecord( first );
+    return true;
+}
@@ -0,0 +1,354 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/BatchFileReader.h"
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/RandomAccessFile.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+#include "DenOfIzGraphicsInternal/Utilities/ParallelFor.h"
+
+#if defined( __linux__ ) && __has_include( <linux/io_uring.h> )
+#define DZ_IO_URING
+#include <cerrno>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace DenOfIz;
+
+namespace
+{
+    // Large requests are split so a single big file is still read in parallel
+    constexpr uint64_t MaxChunkNumBytes = 8ull << 20;
+
+    struct ReadChunk
+    {
+        const RandomAccessFile *File        = nullptr;
+        uint64_t                Offset      = 0;
+        Byte                   *Destination = nullptr;
+        uint64_t                NumBytes    = 0;
+        uint64_t                NumRead     = 0;
+        size_t                  Request     = 0;
+        bool                    Finished    = false;
+        bool                    InFlight    = false; // Accepted by the kernel and not completed yet, its destination can't be touched
+    };
+
+    void ReadChunkBlocking( ReadChunk &chunk )
+    {
+        chunk.NumRead += chunk.File->ReadAt( chunk.Offset + chunk.NumRead, chunk.Destination + chunk.NumRead, chunk.NumBytes - chunk.NumRead );
+        chunk.Finished = true;
+    }
+
+#ifdef DZ_IO_URING
+    // Minimal io_uring wrapper over the raw syscalls, avoids a liburing dependency for the handful of calls needed here
+    class IoUring
+    {
+        int           m_ringFd     = -1;
+        void         *m_sqRing     = nullptr;
+        size_t        m_sqRingSize = 0;
+        void         *m_cqRing     = nullptr;
+        size_t        m_cqRingSize = 0;
+        io_uring_sqe *m_sqes       = nullptr;
+        size_t        m_sqesSize   = 0;
+        uint32_t      m_numEntries = 0;
+
+        unsigned     *m_sqTail = nullptr;
+        unsigned     *m_sqMask = nullptr;
+        unsigned     *m_cqHead = nullptr;
+        unsigned     *m_cqTail = nullptr;
+        unsigned     *m_cqMask = nullptr;
+        io_uring_cqe *m_cqes   = nullptr;
+
+    public:
+        IoUring( )                            = default;
+        IoUring( const IoUring & )            = delete;
+        IoUring &operator=( const IoUring & ) = delete;
+
+        ~IoUring( )
+        {
+            if ( m_sqes != nullptr )
+            {
+                munmap( m_sqes, m_sqesSize );
+            }
+            if ( m_cqRing != nullptr )
+            {
+                munmap( m_cqRing, m_cqRingSize );
+            }
+            if ( m_sqRing != nullptr )
+            {
+                munmap( m_sqRing, m_sqRingSize );
+            }
+            if ( m_ringFd >= 0 )
+            {
+                close( m_ringFd );
+            }
+        }
+
+        bool Init( const uint32_t numEntries )
+        {
+            io_uring_params params{ };
+            m_ringFd = static_cast<int>( syscall( __NR_io_uring_setup, numEntries, &params ) );
+            if ( m_ringFd < 0 )
+            {
+                return false;
+            }
+
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof( io_uring_cqe );
+            m_sqesSize   = params.sq_entries * sizeof( io_uring_sqe );
+            m_sqRing     = Map( m_sqRingSize, IORING_OFF_SQ_RING );
+            m_cqRing     = Map( m_cqRingSize, IORING_OFF_CQ_RING );
+            m_sqes       = static_cast<io_uring_sqe *>( Map( m_sqesSize, IORING_OFF_SQES ) );
+            if ( m_sqRing == nullptr || m_cqRing == nullptr || m_sqes == nullptr )
+            {
+                return false;
+            }
+
+            auto *sqRing = static_cast<Byte *>( m_sqRing );
+            auto *cqRing = static_cast<Byte *>( m_cqRing );
+            m_sqTail     = reinterpret_cast<unsigned *>( sqRing + params.sq_off.tail );
+            m_sqMask     = reinterpret_cast<unsigned *>( sqRing + params.sq_off.ring_mask );
+            m_cqHead     = reinterpret_cast<unsigned *>( cqRing + params.cq_off.head );
+            m_cqTail     = reinterpret_cast<unsigned *>( cqRing + params.cq_off.tail );
+            m_cqMask     = reinterpret_cast<unsigned *>( cqRing + params.cq_off.ring_mask );
+            m_cqes       = reinterpret_cast<io_uring_cqe *>( cqRing + params.cq_off.cqes );
+            m_numEntries = params.sq_entries;
+
+            // Submission slots are always used in ring order, so the indirection array is the identity
+            auto *sqArray = reinterpret_cast<unsigned *>( sqRing + params.sq_off.array );
+            for ( uint32_t i = 0; i < params.sq_entries; ++i )
+            {
+                sqArray[ i ] = i;
+            }
+            return true;
+        }
+
+        [[nodiscard]] uint32_t NumEntries( ) const
+        {
+            return m_numEntries;
+        }
+
+        void QueueRead( const int fd, Byte *destination, const uint32_t numBytes, const uint64_t offset, const uint64_t userData ) const
+        {
+            const unsigned tail = *m_sqTail;
+            io_uring_sqe  &sqe  = m_sqes[ tail & *m_sqMask ];
+            sqe                 = { };
+            sqe.opcode          = IORING_OP_READ;
+            sqe.fd              = fd;
+            sqe.addr            = reinterpret_cast<uint64_t>( destination );
+            sqe.len             = numBytes;
+            sqe.off             = offset;
+            sqe.user_data       = userData;
+            __atomic_store_n( m_sqTail, tail + 1, __ATOMIC_RELEASE );
+        }
+
+        // Returns the number of queued reads the kernel accepted or -errno, with nothing to submit it only waits for a completion
+        int SubmitAndWait( const uint32_t numToSubmit ) const
+        {
+            const long result = syscall( __NR_io_uring_enter, m_ringFd, numToSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0 );
+            return result < 0 ? -errno : static_cast<int>( result );
+        }
+
+        template <typename Fn>
+        void ForEachCompletion( Fn &&fn ) const
+        {
+            unsigned       head = *m_cqHead;
+            const unsigned tail = __atomic_load_n( m_cqTail, __ATOMIC_ACQUIRE );
+            for ( ; head != tail; ++head )
+            {
+                const io_uring_cqe &cqe = m_cqes[ head & *m_cqMask ];
+                fn( cqe.user_data, cqe.res );
+            }
+            __atomic_store_n( m_cqHead, head, __ATOMIC_RELEASE );
+        }
+
+    private:
+        void *Map( const size_t numBytes, const off_t offset ) const
+        {
+            void *memory = mmap( nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, offset );
+            return memory == MAP_FAILED ? nullptr : memory;
+        }
+    };
+
+    // Returns false if io_uring is unavailable or failed part way, unfinished chunks that aren't in flight are then read by the caller
+    bool ReadWithIoUring( std::vector<ReadChunk> &chunks )
+    {
+        IoUring ring;
+        if ( !ring.Init( static_cast<uint32_t>( std::min<size_t>( chunks.size( ), 128 ) ) ) )
+        {
+            return false;
+        }
+
+        std::vector<uint32_t> queue( chunks.size( ) );
+        for ( uint32_t i = 0; i < queue.size( ); ++i )
+        {
+            queue[ i ] = i;
+        }
+
+        size_t               queueHead   = 0;
+        std::deque<uint32_t> ringQueued; // In the submission ring, not yet accepted by the kernel. The kernel consumes them in order
+        uint32_t             numInFlight = 0;
+
+        const auto onCompletion = [ & ]( const uint64_t userData, const int32_t res )
+        {
+            --numInFlight;
+            ReadChunk &chunk = chunks[ userData ];
+            chunk.InFlight   = false;
+            if ( res == -EINTR || res == -EAGAIN )
+            {
+                queue.push_back( static_cast<uint32_t>( userData ) );
+                return;
+            }
+            if ( res < 0 )
+            {
+                // e.g. IORING_OP_READ is not supported before Linux 5.6
+                ReadChunkBlocking( chunk );
+                return;
+            }
+            chunk.NumRead += static_cast<uint64_t>( res );
+            if ( res > 0 && chunk.NumRead < chunk.NumBytes )
+            {
+                queue.push_back( static_cast<uint32_t>( userData ) );
+                return;
+            }
+            chunk.Finished = true;
+        };
+
+        while ( queueHead < queue.size( ) || !ringQueued.empty( ) || numInFlight > 0 )
+        {
+            while ( queueHead < queue.size( ) && ringQueued.size( ) + numInFlight < ring.NumEntries( ) )
+            {
+                const uint32_t   index = queue[ queueHead++ ];
+                const ReadChunk &chunk = chunks[ index ];
+                ring.QueueRead( chunk.File->FileDescriptor( ), chunk.Destination + chunk.NumRead, static_cast<uint32_t>( chunk.NumBytes - chunk.NumRead ),
+                                chunk.Offset + chunk.NumRead, index );
+                ringQueued.push_back( index );
+            }
+
+            const int result = ring.SubmitAndWait( static_cast<uint32_t>( ringQueued.size( ) ) );
+            if ( result == -EINTR || result == -EAGAIN || result == -EBUSY )
+            {
+                continue;
+            }
+            if ( result < 0 )
+            {
+                // The kernel still writes into the destinations of reads in flight, wait for them so the caller can finish every chunk that is left
+                while ( numInFlight > 0 )
+                {
+                    const int drained = ring.SubmitAndWait( 0 );
+                    if ( drained < 0 && drained != -EINTR && drained != -EAGAIN && drained != -EBUSY )
+                    {
+                        spdlog::error( "io_uring_enter failed with {} reads in flight: {}", numInFlight, drained );
+                        break;
+                    }
+                    ring.ForEachCompletion( onCompletion );
+                }
+                return false;
+            }
+            for ( int i = 0; i < result; ++i )
+            {
+                chunks[ ringQueued.front( ) ].InFlight = true;
+                ringQueued.pop_front( );
+            }
+            numInFlight += static_cast<uint32_t>( result );
+
+            ring.ForEachCompletion( onCompletion );
+        }
+        return true;
+    }
+#endif
+} // namespace
+
+bool BatchFileReader::Read( const FileReadRequestArray &requests, const std::vector<std::string> &resolvedPaths )
+{
+    std::unordered_map<std::string, std::unique_ptr<RandomAccessFile>> files;
+    std::vector<ReadChunk>                                             chunks;
+    for ( size_t i = 0; i < requests.NumElements; ++i )
+    {
+        FileReadRequest &request = requests.Elements[ i ];
+        request.NumBytesRead     = 0;
+        if ( request.NumBytes == 0 )
+        {
+            continue;
+        }
+        if ( request.Destination.Elements == nullptr || request.Destination.NumElements < request.NumBytes )
+        {
+            spdlog::error( "Destination of the read request for {} is too small, it needs {} bytes", resolvedPaths[ i ], request.NumBytes );
+            continue;
+        }
+
+        auto &file = files[ resolvedPaths[ i ] ];
+        if ( file == nullptr )
+        {
+            file = std::make_unique<RandomAccessFile>( );
+            file->Open( resolvedPaths[ i ].c_str( ) );
+        }
+        if ( !file->IsOpen( ) )
+        {
+            continue;
+        }
+
+        for ( uint64_t offset = 0; offset < request.NumBytes; offset += MaxChunkNumBytes )
+        {
+            ReadChunk &chunk  = chunks.emplace_back( );
+            chunk.File        = file.get( );
+            chunk.Offset      = request.Offset + offset;
+            chunk.Destination = request.Destination.Elements + offset;
+            chunk.NumBytes    = std::min( MaxChunkNumBytes, request.NumBytes - offset );
+            chunk.Request     = i;
+        }
+    }
+
+    // A single chunk isn't worth setting up a ring or threads for
+    bool finished = chunks.size( ) <= 1;
+    if ( finished && !chunks.empty( ) )
+    {
+        ReadChunkBlocking( chunks[ 0 ] );
+    }
+#ifdef DZ_IO_URING
+    finished = finished || ReadWithIoUring( chunks );
+#endif
+    if ( !finished )
+    {
+        ParallelFor( static_cast<uint32_t>( chunks.size( ) ),
+                     [ & ]( const uint32_t i )
+                     {
+                         if ( !chunks[ i ].Finished && !chunks[ i ].InFlight )
+                         {
+                             ReadChunkBlocking( chunks[ i ] );
+                         }
+                     } );
+    }
+
+    for ( const ReadChunk &chunk : chunks )
+    {
+        requests.Elements[ chunk.Request ].NumBytesRead += chunk.NumRead;
+    }
+
+    bool allRead = true;
+    for ( size_t i = 0; i < requests.NumElements; ++i )
+    {
+        allRead = allRead && requests.Elements[ i ].NumBytesRead == requests.Elements[ i ].NumBytes;
+    }
+    return allRead;
+}
@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphics/Assets/FileSystem/FSConfig.h"
 #include "DenOfIzGraphics/Utilities/Common.h"
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/BatchFileReader.h"
 
 using namespace DenOfIz;
 
@@ -58,6 +59,17 @@ bool FileIO::ReadFile( const InteropString &path, const ByteArray &buffer )
     return true;
 }
 
+bool FileIO::ReadFiles( const FileReadRequestArray &requests )
+{
+    std::vector<std::string> resolvedPaths;
+    resolvedPaths.reserve( requests.NumElements );
+    for ( size_t i = 0; i < requests.NumElements; ++i )
+    {
+        resolvedPaths.push_back( PlatformResourcePath( requests.Elements[ i ].Path.Get( ) ) );
+    }
+    return BatchFileReader::Read( requests, resolvedPaths );
+}
+
 void FileIO::WriteFile( const InteropString &path, const ByteArrayView &data )
 {
     const std::string resolvedPath = PlatformResourcePath( path.Get( ) );
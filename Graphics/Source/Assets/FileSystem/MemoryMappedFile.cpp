@@ -0,0 +1,156 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/MemoryMappedFile.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+#ifdef _WIN32
+#include "DenOfIzGraphics/Utilities/Common_Windows.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace DenOfIz;
+
+MemoryMappedFile::~MemoryMappedFile( )
+{
+    Close( );
+}
+
+bool MemoryMappedFile::Open( const InteropString &path )
+{
+    Close( );
+
+#ifdef _WIN32
+    // Shares delete access so a file can be renamed aside and deleted while it is still mapped, see Bundle::Compact
+    HANDLE file = CreateFileA( path.Get( ), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( file == INVALID_HANDLE_VALUE )
+    {
+        spdlog::error( "Failed to open file for mapping: {}", path.Get( ) );
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{ };
+    if ( !GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart == 0 )
+    {
+        CloseHandle( file );
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    if ( mapping == nullptr )
+    {
+        spdlog::error( "Failed to create file mapping: {}", path.Get( ) );
+        CloseHandle( file );
+        return false;
+    }
+
+    const void *view = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+    if ( view == nullptr )
+    {
+        spdlog::error( "Failed to map view of file: {}", path.Get( ) );
+        CloseHandle( mapping );
+        CloseHandle( file );
+        return false;
+    }
+
+    m_fileHandle    = file;
+    m_mappingHandle = mapping;
+    m_data          = static_cast<const Byte *>( view );
+    m_numBytes      = static_cast<uint64_t>( fileSize.QuadPart );
+#else
+    const int fd = open( path.Get( ), O_RDONLY );
+    if ( fd < 0 )
+    {
+        spdlog::error( "Failed to open file for mapping: {}", path.Get( ) );
+        return false;
+    }
+
+    struct stat fileStat{ };
+    if ( fstat( fd, &fileStat ) != 0 || fileStat.st_size == 0 )
+    {
+        close( fd );
+        return false;
+    }
+
+    void *view = mmap( nullptr, static_cast<size_t>( fileStat.st_size ), PROT_READ, MAP_SHARED, fd, 0 );
+    // The mapping keeps its own reference to the file
+    close( fd );
+    if ( view == MAP_FAILED )
+    {
+        spdlog::error( "Failed to map file: {}", path.Get( ) );
+        return false;
+    }
+
+    m_data     = static_cast<const Byte *>( view );
+    m_numBytes = static_cast<uint64_t>( fileStat.st_size );
+#endif
+    return true;
+}
+
+void MemoryMappedFile::Close( )
+{
+    if ( m_data == nullptr )
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile( m_data );
+    CloseHandle( m_mappingHandle );
+    CloseHandle( m_fileHandle );
+    m_mappingHandle = nullptr;
+    m_fileHandle    = nullptr;
+#else
+    munmap( const_cast<Byte *>( m_data ), static_cast<size_t>( m_numBytes ) );
+#endif
+    m_data     = nullptr;
+    m_numBytes = 0;
+}
+
+bool MemoryMappedFile::IsOpen( ) const
+{
+    return m_data != nullptr;
+}
+
+const Byte *MemoryMappedFile::Data( ) const
+{
+    return m_data;
+}
+
+uint64_t MemoryMappedFile::NumBytes( ) const
+{
+    return m_numBytes;
+}
+
+ByteArrayView MemoryMappedFile::View( const uint64_t offset, const uint64_t numBytes ) const
+{
+    if ( !Contains( offset, numBytes ) )
+    {
+        return { nullptr, 0 };
+    }
+    return { m_data + offset, static_cast<size_t>( numBytes ) };
+}
+
+bool MemoryMappedFile::Contains( const uint64_t offset, const uint64_t numBytes ) const
+{
+    return m_data != nullptr && offset <= m_numBytes && numBytes <= m_numBytes - offset;
+}
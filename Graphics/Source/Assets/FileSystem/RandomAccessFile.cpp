@@ -0,0 +1,140 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphicsInternal/Assets/FileSystem/RandomAccessFile.h"
+#include <algorithm>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+#ifdef _WIN32
+#include "DenOfIzGraphics/Utilities/Common_Windows.h"
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace DenOfIz;
+
+RandomAccessFile::~RandomAccessFile( )
+{
+    Close( );
+}
+
+bool RandomAccessFile::Open( const InteropString &path )
+{
+    Close( );
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA( path.Get( ), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( file == INVALID_HANDLE_VALUE )
+    {
+        spdlog::error( "Failed to open file for reading: {}", path.Get( ) );
+        return false;
+    }
+    m_fileHandle = file;
+#else
+    m_fileDescriptor = open( path.Get( ), O_RDONLY );
+    if ( m_fileDescriptor < 0 )
+    {
+        spdlog::error( "Failed to open file for reading: {}", path.Get( ) );
+        return false;
+    }
+#endif
+    return true;
+}
+
+void RandomAccessFile::Close( )
+{
+#ifdef _WIN32
+    if ( m_fileHandle != nullptr )
+    {
+        CloseHandle( m_fileHandle );
+        m_fileHandle = nullptr;
+    }
+#else
+    if ( m_fileDescriptor >= 0 )
+    {
+        close( m_fileDescriptor );
+        m_fileDescriptor = -1;
+    }
+#endif
+}
+
+bool RandomAccessFile::IsOpen( ) const
+{
+#ifdef _WIN32
+    return m_fileHandle != nullptr;
+#else
+    return m_fileDescriptor >= 0;
+#endif
+}
+
+#ifndef _WIN32
+int RandomAccessFile::FileDescriptor( ) const
+{
+    return m_fileDescriptor;
+}
+#endif
+
+uint64_t RandomAccessFile::ReadAt( const uint64_t offset, Byte *destination, const uint64_t numBytes ) const
+{
+    if ( !IsOpen( ) )
+    {
+        return 0;
+    }
+
+    uint64_t totalRead = 0;
+    while ( totalRead < numBytes )
+    {
+        // Both platforms cap a single read, large assets are read in multiple calls
+        const uint64_t chunkSize = std::min<uint64_t>( numBytes - totalRead, 1u << 30 );
+        const uint64_t position  = offset + totalRead;
+#ifdef _WIN32
+        OVERLAPPED overlapped{ };
+        overlapped.Offset     = static_cast<DWORD>( position & 0xFFFFFFFF );
+        overlapped.OffsetHigh = static_cast<DWORD>( position >> 32 );
+
+        DWORD bytesRead = 0;
+        if ( !::ReadFile( m_fileHandle, destination + totalRead, static_cast<DWORD>( chunkSize ), &bytesRead, &overlapped ) )
+        {
+            if ( GetLastError( ) != ERROR_HANDLE_EOF )
+            {
+                spdlog::error( "Failed to read {} bytes at offset {}", chunkSize, position );
+            }
+            break;
+        }
+#else
+        const ssize_t bytesRead = pread( m_fileDescriptor, destination + totalRead, static_cast<size_t>( chunkSize ), static_cast<off_t>( position ) );
+        if ( bytesRead < 0 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+            spdlog::error( "Failed to read {} bytes at offset {}", chunkSize, position );
+            break;
+        }
+#endif
+        if ( bytesRead == 0 )
+        {
+            break;
+        }
+        totalRead += static_cast<uint64_t>( bytesRead );
+    }
+    return totalRead;
+}
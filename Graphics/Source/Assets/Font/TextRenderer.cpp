@@ -20,9 +20,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
 #include "DenOfIzGraphics/Assets/FileSystem/PathResolver.h"
 #include "DenOfIzGraphics/Assets/Font/FontLibrary.h"
-#include "DenOfIzGraphics/Assets/Serde/Shader/ShaderAssetReader.h"
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
 #include "DenOfIzGraphicsInternal/Assets/Font/Embedded/EmbeddedFonts.h"
-#include "DenOfIzGraphicsInternal/Assets/Font/EmbeddedTextRendererShaders.h"
 #include "DenOfIzGraphicsInternal/Utilities/InteropMathConverter.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
@@ -41,42 +40,7 @@ TextRenderer::TextRenderer( const TextRendererDesc &desc ) : m_desc( desc )
 
     m_logicalDevice = desc.LogicalDevice;
 
-    // ReSharper disable once CppTooWideScope
-    constexpr bool debugShaders = false;
-    if ( debugShaders )
-    {
-        const auto &shaderAssetBytes = EmbeddedTextRendererShaders::ShaderAssetBytes;
-        // ReSharper disable once CppDFAUnreachableCode
-        BinaryReader      binaryReader{ ByteArrayView( shaderAssetBytes.data( ), shaderAssetBytes.size( ) ) };
-        ShaderAssetReader assetReader{ { &binaryReader } };
-        auto              shaderAsset = std::unique_ptr<ShaderAsset>( assetReader.Read( ) );
-        m_fontShaderProgram           = std::make_unique<ShaderProgram>( *shaderAsset );
-    }
-    // ReSharper disable once CppRedundantElseKeywordInsideCompoundStatement
-    else
-    {
-        std::vector<Byte> vertexShader = EmbeddedTextRendererShaders::GetFontVertexShaderBytes( );
-        std::vector<Byte> pixelShader  = EmbeddedTextRendererShaders::GetFontPixelShaderBytes( );
-
-        std::array<ShaderStageDesc, 2> shaderStages( { } );
-
-        ShaderStageDesc &vsDesc = shaderStages[ 0 ];
-        vsDesc.Stage            = ShaderStage::Vertex;
-        vsDesc.EntryPoint       = "main";
-        vsDesc.Data.Elements    = vertexShader.data( );
-        vsDesc.Data.NumElements = vertexShader.size( );
-
-        ShaderStageDesc &psDesc = shaderStages[ 1 ];
-        psDesc.Stage            = ShaderStage::Pixel;
-        psDesc.EntryPoint       = "main";
-        psDesc.Data.Elements    = pixelShader.data( );
-        psDesc.Data.NumElements = pixelShader.size( );
-
-        ShaderProgramDesc programDesc{ };
-        programDesc.ShaderStages.NumElements = shaderStages.size( );
-        programDesc.ShaderStages.Elements    = shaderStages.data( );
-        m_fontShaderProgram                  = std::make_unique<ShaderProgram>( programDesc );
-    }
+    m_fontShaderProgram = std::unique_ptr<ShaderProgram>( EngineShaders::CreateProgram( { EngineShader::Text } ) );
 
     ShaderReflectDesc reflectDesc = m_fontShaderProgram->Reflect( );
 
@@ -16,60 +16,638 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+
 #include "DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include "DenOfIzGraphics/Data/Texture.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+#include "DenOfIzGraphicsInternal/Utilities/Utilities.h"
 
 using namespace DenOfIz;
 
-StagingBuffer::StagingBuffer( ILogicalDevice *device, const uint64_t numBytes )
+namespace
+{
+    constexpr uint64_t BufferCopyAlignment = 16;
+
+    std::mutex                                                              g_sharedLoadersMutex;
+    std::unordered_map<ILogicalDevice *, std::unique_ptr<GpuResourceLoader>> g_sharedLoaders;
+
+    uint64_t SourceNumBytes( const UpdateSourceDataDesc &source )
+    {
+        return source.NumBytes != 0 ? source.NumBytes : source.Data.NumElements - std::min<uint64_t>( source.Offset, source.Data.NumElements );
+    }
+
+    bool IsSourceDataValid( const UpdateSourceDataDesc &source )
+    {
+        if ( source.Data.Elements == nullptr || source.Offset > source.Data.NumElements || SourceNumBytes( source ) > source.Data.NumElements - source.Offset )
+        {
+            spdlog::error( "SourceData range [{}, {}) is outside of Data ({} bytes)", source.Offset, source.Offset + SourceNumBytes( source ), source.Data.NumElements );
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t SrcSliceStride( const TextureSubresourceDesc &subresource )
+    {
+        return subresource.SrcSliceStride != 0 ? subresource.SrcSliceStride : static_cast<uint64_t>( subresource.SrcRowStride ) * subresource.RowCount;
+    }
+} // namespace
+
+GpuResourceLoader::GpuResourceLoader( const GpuResourceLoaderDesc &desc ) : m_desc( desc ), m_device( desc.Device )
+{
+    DZ_NOT_NULL( m_device );
+    m_desc.NumBatches = std::max( 1u, m_desc.NumBatches );
+
+    m_copyQueue = std::unique_ptr<ICommandQueue>( m_device->CreateCommandQueue( CommandQueueDesc{ QueueType::Copy } ) );
+
+    CommandListPoolDesc poolDesc{ };
+    poolDesc.CommandQueue    = m_copyQueue.get( );
+    poolDesc.NumCommandLists = m_desc.NumBatches;
+    m_commandPool            = std::unique_ptr<ICommandListPool>( m_device->CreateCommandListPool( poolDesc ) );
+
+    const auto commandLists = m_commandPool->GetCommandLists( );
+    DZ_ASSERTM( commandLists.NumElements >= m_desc.NumBatches, "Command list pool did not produce a command list per batch." );
+    m_stagingRing = std::make_unique<StagingRing>( StagingRingDesc{ m_device, m_desc.StagingRingNumBytes } );
+    for ( uint32_t i = 0; i < m_desc.NumBatches; ++i )
+    {
+        const auto &batch  = m_batches.emplace_back( std::make_unique<UploadBatch>( ) );
+        batch->CommandList = commandLists.Elements[ i ];
+        batch->Fence       = std::unique_ptr<IFence>( m_device->CreateFence( ) );
+        batch->Semaphore   = std::unique_ptr<ISemaphore>( m_device->CreateSemaphore( ) );
+    }
+}
+
+GpuResourceLoader::~GpuResourceLoader( )
+{
+    WaitForAllUpdates( );
+    WaitForCopyQueue( );
+}
+
+GpuResourceLoader *GpuResourceLoader::Shared( ILogicalDevice *device )
+{
+    DZ_NOT_NULL( device );
+    std::lock_guard lock( g_sharedLoadersMutex );
+    auto           &loader = g_sharedLoaders[ device ];
+    if ( !loader )
+    {
+        GpuResourceLoaderDesc desc{ };
+        desc.Device = device;
+        loader      = std::make_unique<GpuResourceLoader>( desc );
+    }
+    return loader.get( );
+}
+
+void GpuResourceLoader::ReleaseShared( ILogicalDevice *device )
+{
+    std::unique_ptr<GpuResourceLoader> loader;
+    {
+        std::lock_guard lock( g_sharedLoadersMutex );
+        if ( const auto it = g_sharedLoaders.find( device ); it != g_sharedLoaders.end( ) )
+        {
+            loader = std::move( it->second );
+            g_sharedLoaders.erase( it );
+        }
+    }
+    loader.reset( ); // Waits for its updates outside of the registry lock
+}
+
+IBufferResource *GpuResourceLoader::LoadResource( const BufferLoadDesc &loadDesc, UpdateHandle *handle )
+{
+    if ( handle )
+    {
+        *handle = { };
+    }
+
+    const UpdateSourceDataDesc &source       = loadDesc.SourceData;
+    const bool                  hasData      = source.Data.NumElements != 0;
+    const bool                  isCpuVisible = loadDesc.Desc.HeapType == HeapType::CPU || loadDesc.Desc.HeapType == HeapType::CPU_GPU;
+    if ( hasData && !IsSourceDataValid( source ) )
+    {
+        return nullptr;
+    }
+
+    BufferDesc bufferDesc = loadDesc.Desc;
+    if ( hasData && !isCpuVisible )
+    {
+        bufferDesc.InitialUsage = ResourceUsage::CopyDst;
+    }
+    IBufferResource *buffer = m_device->CreateBufferResource( bufferDesc );
+    if ( !hasData )
+    {
+        return buffer;
+    }
+
+    if ( isCpuVisible )
+    {
+        // Written directly, there is nothing to wait for
+        std::memcpy( buffer->MapMemory( ), source.Data.Elements + source.Offset, SourceNumBytes( source ) );
+        buffer->UnmapMemory( );
+        return buffer;
+    }
+
+    BufferUpdateDesc updateDesc{ };
+    updateDesc.Buffer     = buffer;
+    updateDesc.SourceData = source;
+    QueueResourceUpdate( updateDesc, handle );
+    return buffer;
+}
+
+ITextureResource *GpuResourceLoader::LoadResource( const TextureLoadDesc &loadDesc, UpdateHandle *handle )
+{
+    if ( handle )
+    {
+        *handle = { };
+    }
+    if ( loadDesc.Filename.IsEmpty( ) && loadDesc.Data.NumElements == 0 )
+    {
+        return m_device->CreateTextureResource( loadDesc.Desc );
+    }
+
+    const auto texture = loadDesc.Filename.IsEmpty( ) ? std::make_unique<Texture>( loadDesc.Data, Texture::IdentifyTextureFormat( loadDesc.Data ) )
+                                                      : std::make_unique<Texture>( loadDesc.Filename );
+
+    TextureDesc textureDesc  = loadDesc.Desc;
+    textureDesc.HeapType     = HeapType::GPU;
+    textureDesc.InitialUsage = ResourceUsage::CopyDst;
+    textureDesc.Usages |= ResourceUsage::CopyDst | ResourceUsage::ShaderResource;
+    textureDesc.Descriptor |= ResourceDescriptor::Texture;
+    if ( texture->GetDimension( ) == TextureDimension::TextureCube )
+    {
+        textureDesc.Descriptor |= ResourceDescriptor::TextureCube;
+    }
+    textureDesc.Width     = texture->GetWidth( );
+    textureDesc.Height    = texture->GetHeight( );
+    textureDesc.Depth     = texture->GetDepth( );
+    textureDesc.ArraySize = texture->GetArraySize( );
+    textureDesc.MipLevels = texture->GetMipLevels( );
+    textureDesc.Format    = texture->GetFormat( );
+    if ( textureDesc.DebugName.IsEmpty( ) )
+    {
+        textureDesc.DebugName = InteropString( "GpuResourceLoader(" ).Append( loadDesc.Filename.Get( ) ).Append( ")" );
+    }
+
+    ITextureResource     *outTexture = m_device->CreateTextureResource( textureDesc );
+    const TextureMipArray mips       = texture->ReadMipData( );
+
+    // Every mip gets its own handle, handles complete in order so the last one covers the whole texture
+    UpdateHandle updateHandle{ };
+    for ( uint32_t i = 0; i < mips.NumElements; ++i )
+    {
+        const TextureMip &mip = mips.Elements[ i ];
+
+        TextureUpdateDesc updateDesc{ };
+        updateDesc.Texture                        = outTexture;
+        updateDesc.MipLevel                       = mip.MipIndex;
+        updateDesc.ArrayLayer                     = mip.ArrayIndex;
+        updateDesc.SubresourceDesc.SrcRowStride   = mip.RowPitch;
+        updateDesc.SubresourceDesc.RowCount       = std::max( 1u, mip.NumRows );
+        updateDesc.SubresourceDesc.SrcSliceStride = mip.SlicePitch;
+        updateDesc.Data.Elements                  = texture->GetData( ).Elements + mip.DataOffset;
+        updateDesc.Data.NumElements               = static_cast<uint64_t>( mip.SlicePitch ) * std::max( 1u, texture->GetDepth( ) >> mip.MipIndex );
+        updateHandle                              = QueueTextureUpdate( updateDesc );
+    }
+
+    if ( handle )
+    {
+        *handle = updateHandle;
+    }
+    return outTexture;
+}
+
+void GpuResourceLoader::QueueResourceUpdate( const BufferUpdateDesc &updateDesc, UpdateHandle *handle )
+{
+    if ( handle )
+    {
+        *handle = { };
+    }
+    if ( updateDesc.Buffer == nullptr )
+    {
+        spdlog::error( "QueueResourceUpdate: Buffer cannot be null" );
+        return;
+    }
+    if ( !IsSourceDataValid( updateDesc.SourceData ) || SourceNumBytes( updateDesc.SourceData ) == 0 )
+    {
+        return;
+    }
+
+    const UpdateSourceDataDesc &source       = updateDesc.SourceData;
+    const uint64_t              numBytes     = SourceNumBytes( source );
+    const UpdateHandle          updateHandle = QueueCopy(
+        numBytes, BufferCopyAlignment, [ & ]( const StagedCopy &staged ) { std::memcpy( staged.Data, source.Data.Elements + source.Offset, numBytes ); },
+        [ & ]( const StagedCopy &staged )
+        {
+            CopyBufferRegionDesc copyDesc{ };
+            copyDesc.DstBuffer = updateDesc.Buffer;
+            copyDesc.DstOffset = updateDesc.DstOffset;
+            copyDesc.SrcBuffer = staged.Buffer;
+            copyDesc.SrcOffset = staged.Offset;
+            copyDesc.NumBytes  = numBytes;
+            staged.CommandList->CopyBufferRegion( copyDesc );
+        } );
+    if ( handle )
+    {
+        *handle = updateHandle;
+    }
+}
+
+void GpuResourceLoader::QueueResourceUpdate( const TextureUpdateDesc &updateDesc, UpdateHandle *handle )
+{
+    if ( handle )
+    {
+        *handle = { };
+    }
+
+    const TextureSubresourceDesc &subresource = updateDesc.SubresourceDesc;
+    if ( updateDesc.Texture == nullptr || subresource.SrcRowStride == 0 || subresource.RowCount == 0 )
+    {
+        spdlog::error( "QueueResourceUpdate: Texture, SrcRowStride and RowCount must be set" );
+        return;
+    }
+    if ( updateDesc.Data.Elements == nullptr || updateDesc.Data.NumElements < static_cast<uint64_t>( subresource.SrcRowStride ) * subresource.RowCount )
+    {
+        spdlog::error( "QueueResourceUpdate: Data ({} bytes) is smaller than {} rows of {} bytes", updateDesc.Data.NumElements, subresource.RowCount, subresource.SrcRowStride );
+        return;
+    }
+
+    const UpdateHandle updateHandle = QueueTextureUpdate( updateDesc );
+    if ( handle )
+    {
+        *handle = updateHandle;
+    }
+}
+
+void GpuResourceLoader::QueueStagedCopy( const StagedCopyDesc &copyDesc, UpdateHandle *handle )
+{
+    if ( handle )
+    {
+        *handle = { };
+    }
+    if ( !copyDesc.Record )
+    {
+        spdlog::error( "QueueStagedCopy: Record cannot be empty" );
+        return;
+    }
+
+    const UpdateHandle updateHandle = QueueCopy( copyDesc.NumBytes, std::max<uint64_t>( 1, copyDesc.Alignment ), copyDesc.Fill, copyDesc.Record );
+    if ( handle )
+    {
+        *handle = updateHandle;
+    }
+}
+
+FlushUpdatesResult GpuResourceLoader::FlushResourceUpdates( const FlushUpdatesDesc &flushDesc )
+{
+    OperationLock lock( m_operationMutex );
+    DrainCurrentBatch( lock );
+    RetireCompletedBatches( );
+    if ( !m_batches[ m_currentBatch ]->IsRecording && !m_hasUnsignaledSubmissions && flushDesc.WaitSemaphores.NumElements == 0 && flushDesc.SignalSemaphores.NumElements == 0 )
+    {
+        m_lastSubmittedSemaphore = nullptr;
+        return { };
+    }
+
+    // Batches submitted because the staging ring was full did not signal, the copy queue runs in order so signaling here covers them
+    UploadBatch    &batch        = BeginRecording( );
+    const bool      ownSemaphore = flushDesc.SignalSemaphores.NumElements == 0;
+    ISemaphore     *semaphore    = batch.Semaphore.get( );
+    ISemaphoreArray signalSemaphores{ &semaphore, 1 };
+    SubmitBatch( batch, m_nextHandle - 1, flushDesc.WaitSemaphores, ownSemaphore ? signalSemaphores : flushDesc.SignalSemaphores );
+    m_hasUnsignaledSubmissions = false;
+    m_lastSubmittedSemaphore   = ownSemaphore ? semaphore : nullptr;
+    return FlushUpdatesResult{ batch.Fence.get( ), m_lastSubmittedSemaphore };
+}
+
+bool GpuResourceLoader::IsUpdateComplete( const UpdateHandle &handle )
+{
+    if ( handle.Value <= m_lastCompletedHandle.load( ) )
+    {
+        return true;
+    }
+    if ( OperationLock lock( m_operationMutex, std::try_to_lock ); lock.owns_lock( ) )
+    {
+        RetireCompletedBatches( );
+    }
+    return handle.Value <= m_lastCompletedHandle.load( );
+}
+
+void GpuResourceLoader::WaitForUpdate( const UpdateHandle &handle )
+{
+    if ( handle.Value <= m_lastCompletedHandle.load( ) )
+    {
+        return;
+    }
+
+    OperationLock lock( m_operationMutex );
+    if ( handle.Value >= m_nextHandle )
+    {
+        spdlog::error( "WaitForUpdate: Handle {} was not issued by this loader", handle.Value );
+        return;
+    }
+    if ( !IsHandleSubmitted( handle ) )
+    {
+        SubmitRecorded( lock );
+    }
+
+    // Batches retire in order, the oldest one that completes the handle is the one to wait for
+    const UploadBatch *completes = nullptr;
+    for ( const auto &batch : m_batches )
+    {
+        if ( batch->IsInFlight && batch->CompletesHandle >= handle.Value && ( completes == nullptr || batch->SubmitIndex < completes->SubmitIndex ) )
+        {
+            completes = batch.get( );
+        }
+    }
+    if ( completes != nullptr )
+    {
+        WaitForBatch( *completes );
+    }
+}
+
+uint64_t GpuResourceLoader::PendingUpdates( ) const
 {
-    BufferDesc desc{ };
-    desc.Usages     = ResourceUsage::CopySrc;
-    desc.NumBytes   = numBytes;
-    desc.HeapType   = HeapType::CPU_GPU;
-    m_buffer        = std::unique_ptr<IBufferResource>( device->CreateBufferResource( desc ) );
-    m_currentOffset = 0;
-    m_totalNumBytes = numBytes;
-    m_lastHandle    = { };
+    std::lock_guard lock( m_operationMutex );
+    return m_nextHandle - 1 - m_lastCompletedHandle.load( );
 }
 
-bool StagingBuffer::CanFit( const uint64_t size ) const
+void GpuResourceLoader::WaitForAllUpdates( )
 {
-    return m_currentOffset + size <= m_totalNumBytes;
+    UpdateHandle lastHandle{ };
+    {
+        std::lock_guard lock( m_operationMutex );
+        lastHandle.Value = m_nextHandle - 1;
+    }
+    WaitForUpdate( lastHandle );
 }
 
-void *StagingBuffer::Map( ) const
+void GpuResourceLoader::WaitForCopyQueue( )
 {
-    return m_buffer->MapMemory( );
+    std::lock_guard lock( m_operationMutex );
+    while ( UploadBatch *batch = OldestInFlightBatch( ) )
+    {
+        WaitForBatch( *batch );
+    }
 }
 
-void StagingBuffer::Unmap( ) const
+UpdateHandle GpuResourceLoader::GetLastCompletedHandle( ) const
 {
-    m_buffer->UnmapMemory( );
+    return UpdateHandle{ m_lastCompletedHandle.load( ) };
 }
 
-void StagingBuffer::Reset( )
+UpdateHandle GpuResourceLoader::GetLastSubmittedHandle( ) const
 {
-    m_currentOffset = 0;
-    m_lastHandle    = { };
+    return UpdateHandle{ m_lastSubmittedHandle.load( ) };
 }
 
-IBufferResource *StagingBuffer::GetBuffer( ) const
+bool GpuResourceLoader::IsHandleSubmitted( const UpdateHandle &handle ) const
 {
-    return m_buffer.get( );
+    return handle.Value <= m_lastSubmittedHandle.load( );
 }
 
-uint64_t StagingBuffer::GetOffset( ) const
+void GpuResourceLoader::WaitForHandleSubmission( const UpdateHandle &handle )
 {
-    return m_currentOffset;
+    OperationLock lock( m_operationMutex );
+    if ( !IsHandleSubmitted( handle ) )
+    {
+        SubmitRecorded( lock );
+    }
 }
 
-UpdateHandle StagingBuffer::GetLastHandle( ) const
+ISemaphore *GpuResourceLoader::GetLastSubmittedSemaphore( ) const
 {
-    return m_lastHandle;
+    std::lock_guard lock( m_operationMutex );
+    return m_lastSubmittedSemaphore;
+}
+
+GpuResourceLoader::UploadBatch &GpuResourceLoader::BeginRecording( )
+{
+    RetireCompletedBatches( );
+    UploadBatch &batch = *m_batches[ m_currentBatch ];
+    if ( batch.IsRecording )
+    {
+        return batch;
+    }
+
+    WaitForBatch( batch ); // Only blocks when every batch is in flight
+    batch.Fence->Reset( );
+    batch.CommandList->Begin( );
+    batch.IsRecording = true;
+    return batch;
+}
+
+GpuResourceLoader::UploadBatch *GpuResourceLoader::OldestInFlightBatch( ) const
+{
+    UploadBatch *oldest = nullptr;
+    for ( const auto &batch : m_batches )
+    {
+        if ( batch->IsInFlight && ( oldest == nullptr || batch->SubmitIndex < oldest->SubmitIndex ) )
+        {
+            oldest = batch.get( );
+        }
+    }
+    return oldest;
+}
+
+void GpuResourceLoader::RetireCompletedBatches( )
+{
+    for ( UploadBatch *batch = OldestInFlightBatch( ); batch != nullptr && batch->Fence->IsSignaled( ); batch = OldestInFlightBatch( ) )
+    {
+        RetireBatch( *batch );
+    }
+}
+
+void GpuResourceLoader::WaitForBatch( const UploadBatch &batch )
+{
+    // Blocks on the fences directly, the lock is held but nothing the GPU waits for needs it
+    while ( batch.IsInFlight )
+    {
+        UploadBatch &oldest = *OldestInFlightBatch( );
+        oldest.Fence->Wait( );
+        RetireBatch( oldest );
+    }
+}
+
+void GpuResourceLoader::RetireBatch( UploadBatch &batch )
+{
+    batch.DedicatedBuffers.clear( );
+    m_stagingRing->Release( batch.RingPositions );
+    batch.RingPositions.clear( );
+    batch.IsInFlight = false;
+    PublishCompletedHandle( batch.CompletesHandle );
+}
+
+void GpuResourceLoader::DrainCurrentBatch( OperationLock &lock )
+{
+    m_fillsDone.wait( lock, [ this ] { return m_batches[ m_currentBatch ]->PendingFills == 0; } );
+}
+
+void GpuResourceLoader::SubmitBatch( UploadBatch &batch, const uint64_t completesHandle, const ISemaphoreArray &waitSemaphores, const ISemaphoreArray &signalSemaphores )
+{
+    for ( const auto &buffer : batch.DedicatedBuffers )
+    {
+        buffer->UnmapMemory( );
+    }
+    batch.CommandList->End( );
+
+    ExecuteCommandListsDesc executeDesc{ };
+    executeDesc.Signal                   = batch.Fence.get( );
+    executeDesc.CommandLists.Elements    = &batch.CommandList;
+    executeDesc.CommandLists.NumElements = 1;
+    executeDesc.WaitSemaphores           = waitSemaphores;
+    executeDesc.SignalSemaphores         = signalSemaphores;
+    m_copyQueue->ExecuteCommandLists( executeDesc );
+
+    batch.IsRecording     = false;
+    batch.IsInFlight      = true;
+    batch.CompletesHandle = completesHandle;
+    batch.SubmitIndex     = m_nextSubmit++;
+    m_lastSubmittedHandle.store( completesHandle );
+    m_currentBatch = ( m_currentBatch + 1 ) % m_batches.size( );
+}
+
+void GpuResourceLoader::SubmitRecorded( OperationLock &lock )
+{
+    DrainCurrentBatch( lock );
+    if ( UploadBatch &batch = *m_batches[ m_currentBatch ]; batch.IsRecording )
+    {
+        SubmitBatch( batch, m_nextHandle - 1, { }, { } );
+        m_hasUnsignaledSubmissions = true;
+    }
+}
+
+GpuResourceLoader::StagingAllocation GpuResourceLoader::AllocateStaging( OperationLock &lock, const uint64_t numBytes, const uint64_t alignment )
+{
+    UploadBatch            *batch       = &BeginRecording( );
+    StagingRing::Allocation ringAllocation{ };
+    bool                    isAllocated = false;
+    while ( m_stagingRing->CanHold( numBytes ) && !( isAllocated = m_stagingRing->Allocate( numBytes, alignment, ringAllocation ) ) )
+    {
+        if ( const UploadBatch *oldest = OldestInFlightBatch( ) )
+        {
+            WaitForBatch( *oldest );
+        }
+        else
+        {
+            // Only the recording batch holds the ring, its copies free it once submitted. Handles are issued after their staging memory
+            // is allocated, so every issued handle is recorded once the batch is drained.
+            DrainCurrentBatch( lock );
+            if ( UploadBatch &current = *m_batches[ m_currentBatch ]; current.IsRecording && !current.RingPositions.empty( ) )
+            {
+                SubmitBatch( current, m_nextHandle - 1, { }, { } );
+                m_hasUnsignaledSubmissions = true;
+            }
+        }
+        batch = &BeginRecording( );
+    }
+
+    StagingAllocation allocation{ };
+    if ( isAllocated )
+    {
+        batch->RingPositions.push_back( ringAllocation.Position );
+        allocation.Buffer = ringAllocation.Buffer;
+        allocation.Offset = ringAllocation.Offset;
+        allocation.Data   = ringAllocation.Data;
+        return allocation;
+    }
+
+    BufferDesc bufferDesc{ };
+    bufferDesc.HeapType     = HeapType::CPU_GPU;
+    bufferDesc.InitialUsage = ResourceUsage::CopySrc;
+    bufferDesc.Usages       = ResourceUsage::CopySrc;
+    bufferDesc.NumBytes     = numBytes;
+    bufferDesc.DebugName    = "GpuResourceLoader_DedicatedStagingBuffer";
+
+    allocation.Buffer = m_device->CreateBufferResource( bufferDesc );
+    allocation.Data   = static_cast<Byte *>( allocation.Buffer->MapMemory( ) );
+    batch->DedicatedBuffers.emplace_back( allocation.Buffer );
+    return allocation;
+}
+
+UpdateHandle GpuResourceLoader::QueueCopy( const uint64_t numBytes, const uint64_t alignment, const RecordStagedCopy &fill, const RecordStagedCopy &record )
+{
+    OperationLock lock( m_operationMutex );
+    StagedCopy    staged{ };
+    if ( numBytes == 0 )
+    {
+        staged.CommandList = BeginRecording( ).CommandList;
+        record( staged );
+        return UpdateHandle{ m_nextHandle++ };
+    }
+
+    const StagingAllocation allocation = AllocateStaging( lock, numBytes, alignment );
+    UploadBatch            &batch      = *m_batches[ m_currentBatch ];
+    const UpdateHandle      handle{ m_nextHandle++ };
+    staged.Buffer = allocation.Buffer;
+    staged.Offset = allocation.Offset;
+    staged.Data   = allocation.Data;
+
+    // The batch is not submitted while the staging memory is written, so the copy is recorded into the batch the memory belongs to
+    ++batch.PendingFills;
+    lock.unlock( );
+    if ( fill )
+    {
+        fill( staged );
+    }
+    lock.lock( );
+
+    staged.CommandList = batch.CommandList;
+    record( staged );
+    if ( --batch.PendingFills == 0 )
+    {
+        m_fillsDone.notify_all( );
+    }
+    return handle;
+}
+
+UpdateHandle GpuResourceLoader::QueueTextureUpdate( const TextureUpdateDesc &updateDesc )
+{
+    // Rows are placed at the aligned pitch and depth slices right after each other, which is what every backend copies from
+    const TextureSubresourceDesc &subresource    = updateDesc.SubresourceDesc;
+    const DeviceConstants        &constants      = m_device->DeviceInfo( ).Constants;
+    const uint32_t                dstRowStride   = Utilities::Align( subresource.SrcRowStride, std::max( 1u, constants.BufferTextureRowAlignment ) );
+    const uint64_t                dstSliceStride = static_cast<uint64_t>( dstRowStride ) * subresource.RowCount;
+    const uint64_t                srcSliceStride = SrcSliceStride( subresource );
+    const uint64_t                numSlices      = std::max<uint64_t>( 1, updateDesc.Data.NumElements / srcSliceStride );
+    const uint64_t                alignment      = std::max( { 1u, constants.BufferTextureAlignment, constants.BufferTextureRowAlignment } );
+
+    const auto fill = [ & ]( const StagedCopy &staged )
+    {
+        for ( uint64_t slice = 0; slice < numSlices; ++slice )
+        {
+            const Byte *src = updateDesc.Data.Elements + slice * srcSliceStride;
+            Byte       *dst = staged.Data + slice * dstSliceStride;
+            if ( dstRowStride == subresource.SrcRowStride )
+            {
+                std::memcpy( dst, src, dstSliceStride );
+                continue;
+            }
+            for ( uint32_t row = 0; row < subresource.RowCount; ++row )
+            {
+                std::memcpy( dst + static_cast<uint64_t>( row ) * dstRowStride, src + static_cast<uint64_t>( row ) * subresource.SrcRowStride, subresource.SrcRowStride );
+            }
+        }
+    };
+    const auto record = [ & ]( const StagedCopy &staged )
+    {
+        CopyBufferToTextureDesc copyDesc{ };
+        copyDesc.DstTexture = updateDesc.Texture;
+        copyDesc.SrcBuffer  = staged.Buffer;
+        copyDesc.SrcOffset  = staged.Offset;
+        copyDesc.Format     = updateDesc.Texture->GetFormat( );
+        copyDesc.MipLevel   = updateDesc.MipLevel;
+        copyDesc.ArrayLayer = updateDesc.ArrayLayer;
+        copyDesc.RowPitch   = subresource.SrcRowStride;
+        copyDesc.NumRows    = subresource.RowCount;
+        staged.CommandList->CopyBufferToTexture( copyDesc );
+    };
+    return QueueCopy( dstSliceStride * numSlices, alignment, fill, record );
 }
 
-void StagingBuffer::Advance( const uint64_t size, const UpdateHandle handle )
+void GpuResourceLoader::PublishCompletedHandle( const uint64_t handle )
 {
-    m_currentOffset += size;
-    m_lastHandle = handle;
+    uint64_t completed = m_lastCompletedHandle.load( );
+    while ( completed < handle && !m_lastCompletedHandle.compare_exchange_weak( completed, handle ) )
+    {
+    }
 }
@@ -14,10 +14,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Assets/Import/AssimpImporter.h"
+#include <assimp/version.h>
+#include <cstring>
 #include <memory>
 #include "DenOfIzGraphics/Assets/Bundle/BundleManager.h"
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
 #include "DenOfIzGraphics/Assets/Import/AssetPathUtilities.h"
+#include "DenOfIzGraphics/Assets/Import/ImportCache.h"
 #include "DenOfIzGraphics/Assets/Serde/Mesh/MeshAssetWriter.h"
 #include "DenOfIzGraphics/Assets/Stream/BinaryWriter.h"
 #include "DenOfIzGraphicsInternal/Assets/Import/AssimpAnimationProcessor.h"
@@ -27,10 +30,76 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphicsInternal/Assets/Import/AssimpSceneLoader.h"
 #include "DenOfIzGraphicsInternal/Assets/Import/AssimpSkeletonProcessor.h"
 #include "DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
 using namespace DenOfIz;
 
+namespace
+{
+    constexpr auto     ImporterName    = "Assimp Importer";
+    constexpr uint32_t ImporterVersion = 1; // Bump when the written assets change so cached imports are redone
+
+    // Includes the Assimp version, a different Assimp can read the same file differently
+    uint64_t HashImporter( )
+    {
+        const uint32_t versions[ 4 ]{ ImporterVersion, aiGetVersionMajor( ), aiGetVersionMinor( ), aiGetVersionRevision( ) };
+        return Fnv1a( ).Append( ImporterName, std::strlen( ImporterName ) ).Append( reinterpret_cast<const char *>( versions ), sizeof( versions ) ).Value( );
+    }
+
+    // Every field except SourceFilePath and Cache, strings include the terminator so adjacent strings can't alias
+    uint64_t HashImportOptions( const AssimpImportDesc &desc )
+    {
+        Fnv1a hash;
+        auto  appendString = [ &hash ]( const InteropString &value ) { hash.Append( value.Get( ), value.NumChars( ) + 1 ); };
+        auto  appendValue  = [ &hash ]( const auto &value ) { hash.Append( reinterpret_cast<const char *>( &value ), sizeof( value ) ); };
+
+        appendString( desc.TargetDirectory );
+        appendString( desc.AssetNamePrefix );
+        const bool flags[ ]{ desc.ImportMaterials,
+                             desc.ImportTextures,
+                             desc.ImportAnimations,
+                             desc.ImportSkeletons,
+                             desc.OverwriteExisting,
+                             desc.GenerateLODs,
+                             desc.OptimizeMeshes,
+                             desc.JoinIdenticalVertices,
+                             desc.PreTransformVertices,
+                             desc.LimitBoneWeights,
+                             desc.RemoveRedundantMaterials,
+                             desc.MergeMeshes,
+                             desc.OptimizeGraph,
+                             desc.GenerateNormals,
+                             desc.SmoothNormals,
+                             desc.TriangulateMeshes,
+                             desc.PreservePivots,
+                             desc.DropNormals,
+                             desc.ConvertToLeftHanded,
+                             desc.CalculateTangentSpace };
+        for ( const bool flag : flags )
+        {
+            appendValue( static_cast<uint8_t>( flag ) );
+        }
+        appendValue( desc.MaxLODCount );
+        appendValue( desc.LODScreenPercentages );
+        appendValue( desc.ScaleFactor );
+        appendValue( desc.MaxBoneWeightsPerVertex );
+        appendValue( desc.SmoothNormalsAngle );
+        appendValue( desc.AdditionalOptions.NumElements );
+        for ( uint32_t i = 0; i < desc.AdditionalOptions.NumElements; ++i )
+        {
+            appendString( desc.AdditionalOptions.Elements[ i ] );
+        }
+        appendValue( desc.ImportedTextures.NumElements );
+        for ( uint32_t i = 0; i < desc.ImportedTextures.NumElements; ++i )
+        {
+            appendString( desc.ImportedTextures.Elements[ i ].SourceFilePath );
+            appendString( desc.ImportedTextures.Elements[ i ].Uri.ToInteropString( ) );
+        }
+        return hash.Value( );
+    }
+} // namespace
+
 class AssimpImporter::Impl
 {
 public:
@@ -43,6 +112,8 @@ public:
     std::unique_ptr<AssimpSkeletonProcessor>  m_skeletonProcessor;
     std::unique_ptr<AssimpAnimationProcessor> m_animationProcessor;
     std::vector<InteropString>                m_supportedExtensions;
+    std::vector<InteropString>                m_externalTextures;
+    std::vector<AssetUri>                     m_cachedAssets;
 
     explicit Impl( )
     {
@@ -77,7 +148,8 @@ public:
 
     ~Impl( ) = default;
 
-    ImporterResult Import( const AssimpImportDesc &desc );
+    ImporterResult     Import( const AssimpImportDesc &desc );
+    InteropStringArray GetExternalTextures( const InteropString &sourceFilePath );
 
 private:
     ImporterResultCode ValidateInputs( const AssimpImportDesc &desc, ImporterResult &result ) const;
@@ -93,7 +165,7 @@ AssimpImporter::~AssimpImporter( ) = default;
 
 InteropString AssimpImporter::GetName( ) const
 {
-    return "Assimp Importer";
+    return ImporterName;
 }
 
 InteropStringArray AssimpImporter::GetSupportedExtensions( ) const
@@ -130,6 +202,32 @@ ImporterResult AssimpImporter::Import( const AssimpImportDesc &desc ) const
     return m_pImpl->Import( desc );
 }
 
+InteropStringArray AssimpImporter::GetExternalTextures( const InteropString &sourceFilePath ) const
+{
+    return m_pImpl->GetExternalTextures( sourceFilePath );
+}
+
+InteropStringArray AssimpImporter::Impl::GetExternalTextures( const InteropString &sourceFilePath )
+{
+    m_externalTextures.clear( );
+
+    Assimp::Importer importer;
+    const aiScene   *scene = importer.ReadFile( FileIO::GetResourcePath( sourceFilePath ).Get( ), 0 );
+    if ( scene == nullptr )
+    {
+        spdlog::error( "Failed to read {}: {}", sourceFilePath.Get( ), importer.GetErrorString( ) );
+        return { };
+    }
+
+    std::vector<std::string> paths;
+    m_materialProcessor->CollectExternalTextures( scene, sourceFilePath, paths );
+    for ( const std::string &path : paths )
+    {
+        m_externalTextures.emplace_back( path.c_str( ) );
+    }
+    return { m_externalTextures.data( ), m_externalTextures.size( ) };
+}
+
 ImporterResult AssimpImporter::Impl::Import( const AssimpImportDesc &desc )
 {
     spdlog::info( "Starting Assimp import for file: {}", desc.SourceFilePath.Get( ) );
@@ -139,6 +237,15 @@ ImporterResult AssimpImporter::Impl::Import( const AssimpImportDesc &desc )
         return result;
     }
 
+    const uint64_t importerHash = HashImporter( );
+    const uint64_t optionsHash  = HashImportOptions( desc );
+    if ( desc.Cache != nullptr && desc.Cache->Find( desc.SourceFilePath.Get( ), importerHash, optionsHash, m_cachedAssets ) )
+    {
+        result.CreatedAssets.Elements    = m_cachedAssets.data( );
+        result.CreatedAssets.NumElements = static_cast<uint32_t>( m_cachedAssets.size( ) );
+        return result;
+    }
+
     // Phase 1: Load scene and gather statistics
     spdlog::info( "Phase 1: Loading scene and gathering statistics..." );
     if ( !m_sceneLoader->LoadScene( desc.SourceFilePath, desc ) )
@@ -170,6 +277,11 @@ ImporterResult AssimpImporter::Impl::Import( const AssimpImportDesc &desc )
     context.MeshAsset.MorphTargets.NumElements   = 0;
     context.MeshAsset.UserProperties.Elements    = nullptr;
     context.MeshAsset.UserProperties.NumElements = 0;
+    for ( uint32_t i = 0; i < desc.ImportedTextures.NumElements; ++i )
+    {
+        const ImportedAsset &texture                                    = desc.ImportedTextures.Elements[ i ];
+        context.TexturePathToAssetUriMap[ texture.SourceFilePath.Get( ) ] = texture.Uri;
+    }
 
     // Phase 3: Process the scene
     result.ResultCode = ProcessScene( context );
@@ -183,6 +295,23 @@ ImporterResult AssimpImporter::Impl::Import( const AssimpImportDesc &desc )
         }
 
         spdlog::info( "Assimp import successful. Created {} assets", result.CreatedAssets.NumElements );
+
+        if ( desc.Cache != nullptr )
+        {
+            ImportCacheRecord record;
+            record.SourceFilePath = desc.SourceFilePath.Get( );
+            record.ImporterHash   = importerHash;
+            record.OptionsHash    = optionsHash;
+            record.InputFiles     = m_sceneLoader->GetOpenedFiles( );
+            record.InputFiles.push_back( record.SourceFilePath );
+            record.InputFiles.insert( record.InputFiles.end( ), context.InputFiles.begin( ), context.InputFiles.end( ) );
+            for ( const AssetUri &uri : context.CreatedAssets )
+            {
+                record.OutputFiles.emplace_back( FileIO::GetAbsolutePath( InteropString( desc.TargetDirectory ).Append( "/" ).Append( uri.Path.Get( ) ) ).Get( ) );
+            }
+            record.CreatedAssets = context.CreatedAssets;
+            desc.Cache->Store( record );
+        }
     }
     else
     {
@@ -17,6 +17,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphicsInternal/Assets/Import/AssimpMaterialProcessor.h"
+#include <algorithm>
 #include <filesystem>
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
 #include "DenOfIzGraphics/Assets/Import/AssetPathUtilities.h"
@@ -125,26 +126,72 @@ bool AssimpMaterialProcessor::ProcessTexture( AssimpImportContext &context, cons
     }
 
     spdlog::info( "Processing external texture reference: '{}' for semantic: {}", texPathStr, semanticName.Get( ) );
-    if ( context.TexturePathToAssetUriMap.contains( texPathStr ) )
+    const std::filesystem::path absoluteTexturePath = ResolveExternalTexturePath( context.SourceFilePath, texPathStr );
+    if ( const auto it = context.TexturePathToAssetUriMap.find( absoluteTexturePath.string( ) ); it != context.TexturePathToAssetUriMap.end( ) )
     {
-        outAssetUri = context.TexturePathToAssetUriMap[ texPathStr ];
+        outAssetUri = it->second;
         return true;
     }
 
-    const std::filesystem::path modelPath           = FileIO::GetResourcePath( context.SourceFilePath ).Get( );
-    const std::filesystem::path texturePath         = texPathStr;
-    const std::filesystem::path absoluteTexturePath = texturePath.is_absolute( ) ? texturePath : absolute( modelPath.parent_path( ) / texturePath );
-
     if ( !exists( absoluteTexturePath ) )
     {
         spdlog::error( "External texture file not found: {} (referenced by material '{}')", absoluteTexturePath.string( ), material->GetName( ).C_Str( ) );
         return false;
     }
 
+    context.InputFiles.push_back( absoluteTexturePath.string( ) );
     WriteTextureAsset( context, nullptr, absoluteTexturePath.string( ), semanticName, outAssetUri );
     return true;
 }
 
+void AssimpMaterialProcessor::CollectExternalTextures( const aiScene *scene, const InteropString &sourceFilePath, std::vector<std::string> &outPaths ) const
+{
+    for ( uint32_t i = 0; i < scene->mNumMaterials; ++i )
+    {
+        const aiMaterial *material = scene->mMaterials[ i ];
+        auto              collect  = [ & ]( const aiTextureType textureType )
+        {
+            aiString aiPath;
+            if ( material->GetTexture( textureType, 0, &aiPath ) != AI_SUCCESS || aiPath.length == 0 )
+            {
+                return false;
+            }
+            if ( aiPath.C_Str( )[ 0 ] == '*' )
+            {
+                return true;
+            }
+
+            const std::filesystem::path path = ResolveExternalTexturePath( sourceFilePath, aiPath.C_Str( ) );
+            if ( !exists( path ) )
+            {
+                return false;
+            }
+            if ( std::ranges::find( outPaths, path.string( ) ) == outPaths.end( ) )
+            {
+                outPaths.push_back( path.string( ) );
+            }
+            return true;
+        };
+
+        // Same textures as ProcessMaterialTextures
+        collect( aiTextureType_DIFFUSE );
+        if ( !collect( aiTextureType_NORMALS ) )
+        {
+            collect( aiTextureType_HEIGHT );
+        }
+        collect( aiTextureType_METALNESS );
+        collect( aiTextureType_EMISSIVE );
+        collect( aiTextureType_AMBIENT_OCCLUSION );
+    }
+}
+
+std::filesystem::path AssimpMaterialProcessor::ResolveExternalTexturePath( const InteropString &sourceFilePath, const std::string &texturePath )
+{
+    const std::filesystem::path modelPath = FileIO::GetResourcePath( sourceFilePath ).Get( );
+    const std::filesystem::path path      = texturePath;
+    return path.is_absolute( ) ? path : absolute( modelPath.parent_path( ) / path );
+}
+
 ImporterResultCode AssimpMaterialProcessor::WriteTextureAsset( AssimpImportContext &context, const aiTexture *texture, const std::string &path, const InteropString &semanticName,
                                                                AssetUri &outAssetUri ) const
 {
@@ -18,8 +18,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphicsInternal/Assets/Import/AssimpSceneLoader.h"
 
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/cimport.h>
 #include <assimp/postprocess.h>
+#include <algorithm>
 #include <ranges>
 #include <set>
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
@@ -31,8 +33,28 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 using namespace DenOfIz;
 
-AssimpSceneLoader::AssimpSceneLoader( ) : m_importer( std::make_unique<Assimp::Importer>( ) ), m_desc( { } )
+namespace DenOfIz
 {
+    class AssimpRecordingIOSystem final : public Assimp::DefaultIOSystem
+    {
+    public:
+        std::vector<std::string> OpenedFiles;
+
+        Assimp::IOStream *Open( const char *file, const char *mode ) override
+        {
+            Assimp::IOStream *stream = DefaultIOSystem::Open( file, mode );
+            if ( stream != nullptr && std::ranges::find( OpenedFiles, file ) == OpenedFiles.end( ) )
+            {
+                OpenedFiles.emplace_back( file );
+            }
+            return stream;
+        }
+    };
+} // namespace DenOfIz
+
+AssimpSceneLoader::AssimpSceneLoader( ) : m_importer( std::make_unique<Assimp::Importer>( ) ), m_ioSystem( new AssimpRecordingIOSystem( ) ), m_desc( { } )
+{
+    m_importer->SetIOHandler( m_ioSystem );
 }
 
 AssimpSceneLoader::~AssimpSceneLoader( ) = default;
@@ -40,6 +62,7 @@ AssimpSceneLoader::~AssimpSceneLoader( ) = default;
 bool AssimpSceneLoader::LoadScene( const InteropString &filePath, const AssimpImportDesc &desc )
 {
     m_desc = desc;
+    m_ioSystem->OpenedFiles.clear( );
     ConfigureImportFlags( desc );
     spdlog::info( "Loading scene from: {}", filePath.Get( ) );
     m_scene = m_importer->ReadFile( FileIO::GetResourcePath( filePath ).Get( ), m_importFlags );
@@ -71,6 +94,11 @@ unsigned int AssimpSceneLoader::GetImportFlags( ) const
     return m_importFlags;
 }
 
+const std::vector<std::string> &AssimpSceneLoader::GetOpenedFiles( ) const
+{
+    return m_ioSystem->OpenedFiles;
+}
+
 void AssimpSceneLoader::ConfigureImportFlags( const AssimpImportDesc &desc )
 {
     m_importFlags = 0;
@@ -0,0 +1,498 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Assets/Import/BatchImporter.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Import/AssetPathUtilities.h"
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    enum class SourceKind
+    {
+        Model,
+        Texture,
+        Font,
+        VectorGraphics
+    };
+
+    struct TextureReference
+    {
+        std::string Path;   // As the model resolves it, see AssimpImporter::GetExternalTextures
+        uint32_t    Source; // Index of the texture in the source list
+    };
+
+    struct SourceFile
+    {
+        std::string                   Path;
+        SourceKind                    Kind;
+        std::vector<TextureReference> Textures; // Only for models
+    };
+
+    // Written only by the job importing the source, read by its dependents and once every job is done
+    struct SourceResult
+    {
+        ImporterResultCode    ResultCode = ImporterResultCode::Success;
+        InteropString         ErrorMessage;
+        std::vector<AssetUri> CreatedAssets;
+    };
+
+    std::string CanonicalKey( const std::string &path )
+    {
+        std::error_code error;
+        const std::filesystem::path canonical = std::filesystem::weakly_canonical( path, error );
+        return error ? path : canonical.string( );
+    }
+
+    // Every source is written to TargetDirectory under its file name, two sources that map to the same asset file would be imported by
+    // concurrent jobs writing the same path. Lower case since the target might be on a case insensitive file system.
+    bool FindOutputCollision( const std::vector<SourceFile> &sources, std::string &outMessage )
+    {
+        std::unordered_map<std::string, const SourceFile *> outputs;
+        for ( const SourceFile &source : sources )
+        {
+            // Vector graphics are rasterized into texture assets
+            const SourceKind outputKind = source.Kind == SourceKind::VectorGraphics ? SourceKind::Texture : source.Kind;
+            std::string      key        = AssetPathUtilities::SanitizeAssetName( AssetPathUtilities::GetAssetNameFromFilePath( source.Path.c_str( ) ) ).Get( );
+            std::ranges::transform( key, key.begin( ), [ ]( const unsigned char c ) { return static_cast<char>( std::tolower( c ) ); } );
+            key += '/' + std::to_string( static_cast<int>( outputKind ) );
+
+            const auto [ it, inserted ] = outputs.emplace( key, &source );
+            if ( !inserted )
+            {
+                outMessage = "Batch import sources " + it->second->Path + " and " + source.Path + " would be written to the same asset";
+                return true;
+            }
+        }
+        return false;
+    }
+} // namespace
+
+class BatchImporter::Impl
+{
+public:
+    // Only used to classify and scan sources, every import job creates its own importer since results are owned by the importer
+    AssimpImporter        m_modelImporter;
+    TextureImporter       m_textureImporter;
+    FontImporter          m_fontImporter;
+    VGImporter            m_vgImporter;
+    std::vector<AssetUri> m_createdAssets;
+
+    ImporterResult Import( const BatchImportDesc &desc );
+
+private:
+    bool               CollectSources( const BatchImportDesc &desc, std::vector<SourceFile> &outSources ) const;
+    bool               Classify( const std::string &path, SourceKind &outKind ) const;
+    void               ScanModelTextures( std::vector<SourceFile> &sources ) const;
+    static void        ImportSource( const BatchImportDesc &desc, const SourceFile &source, const std::vector<SourceResult> &results, SourceResult &outResult );
+    static AssetUri    RelativeToTarget( const BatchImportDesc &desc, const AssetUri &uri );
+    static void        AddToBundle( const BatchImportDesc &desc, const AssetUri &uri );
+};
+
+BatchImporter::BatchImporter( ) : m_pImpl( std::make_unique<Impl>( ) )
+{
+}
+
+BatchImporter::~BatchImporter( ) = default;
+
+ImporterResult BatchImporter::Import( const BatchImportDesc &desc ) const
+{
+    return m_pImpl->Import( desc );
+}
+
+ImporterResult BatchImporter::Impl::Import( const BatchImportDesc &desc )
+{
+    m_createdAssets.clear( );
+
+    ImporterResult result{ };
+    if ( desc.TargetDirectory.IsEmpty( ) || ( desc.SourceDirectory.IsEmpty( ) && desc.ManifestPath.IsEmpty( ) ) )
+    {
+        result.ResultCode   = ImporterResultCode::InvalidParameters;
+        result.ErrorMessage = "Batch import requires a TargetDirectory and either a SourceDirectory or a ManifestPath";
+        spdlog::error( "{}", result.ErrorMessage.Get( ) );
+        return result;
+    }
+
+    std::vector<SourceFile> sources;
+    if ( !CollectSources( desc, sources ) )
+    {
+        result.ResultCode   = ImporterResultCode::FileNotFound;
+        result.ErrorMessage = InteropString( "Failed to read batch import sources from: " )
+                                  .Append( desc.ManifestPath.IsEmpty( ) ? desc.SourceDirectory.Get( ) : desc.ManifestPath.Get( ) );
+        spdlog::error( "{}", result.ErrorMessage.Get( ) );
+        return result;
+    }
+
+    if ( desc.ModelDesc.ImportMaterials && desc.ModelDesc.ImportTextures )
+    {
+        ScanModelTextures( sources );
+    }
+
+    if ( std::string collision; FindOutputCollision( sources, collision ) )
+    {
+        result.ResultCode   = ImporterResultCode::InvalidParameters;
+        result.ErrorMessage = collision.c_str( );
+        spdlog::error( "{}", result.ErrorMessage.Get( ) );
+        return result;
+    }
+
+    const size_t numModels = std::ranges::count_if( sources, [ ]( const SourceFile &source ) { return source.Kind == SourceKind::Model; } );
+    spdlog::info( "Batch importing {} source files ({} models)", sources.size( ), numModels );
+
+    std::vector<SourceResult> results( sources.size( ) );
+    JobGraph                  graph;
+    for ( uint32_t i = 0; i < sources.size( ); ++i )
+    {
+        graph.Add( [ &, i ] { ImportSource( desc, sources[ i ], results, results[ i ] ); } );
+    }
+    for ( uint32_t i = 0; i < sources.size( ); ++i )
+    {
+        for ( const TextureReference &texture : sources[ i ].Textures )
+        {
+            graph.Precede( texture.Source, i );
+        }
+    }
+
+    JobCounter counter;
+    JobSystem::Get( ).Run( graph, &counter );
+    JobSystem::Get( ).Wait( counter );
+
+    // Collected in source order so the result doesn't depend on which job finished first
+    uint32_t numFailed = 0;
+    for ( uint32_t i = 0; i < sources.size( ); ++i )
+    {
+        const SourceResult &sourceResult = results[ i ];
+        m_createdAssets.insert( m_createdAssets.end( ), sourceResult.CreatedAssets.begin( ), sourceResult.CreatedAssets.end( ) );
+        if ( sourceResult.ResultCode != ImporterResultCode::Success )
+        {
+            if ( numFailed++ == 0 )
+            {
+                result.ResultCode   = sourceResult.ResultCode;
+                result.ErrorMessage = sourceResult.ErrorMessage;
+            }
+        }
+    }
+
+    if ( desc.TargetBundle != nullptr && !desc.TargetBundle->Save( ) )
+    {
+        result.ResultCode   = ImporterResultCode::WriteFailed;
+        result.ErrorMessage = InteropString( "Failed to save bundle: " ).Append( desc.TargetBundle->GetPath( ).Get( ) );
+        spdlog::error( "{}", result.ErrorMessage.Get( ) );
+    }
+
+    result.CreatedAssets.Elements    = m_createdAssets.data( );
+    result.CreatedAssets.NumElements = static_cast<uint32_t>( m_createdAssets.size( ) );
+    spdlog::info( "Batch import finished, created {} assets, {} of {} source files failed", m_createdAssets.size( ), numFailed, sources.size( ) );
+    return result;
+}
+
+bool BatchImporter::Impl::CollectSources( const BatchImportDesc &desc, std::vector<SourceFile> &outSources ) const
+{
+    std::vector<std::string> paths;
+    bool                     fromManifest = false;
+    if ( !desc.ManifestPath.IsEmpty( ) )
+    {
+        const std::filesystem::path manifestPath = FileIO::GetResourcePath( desc.ManifestPath ).Get( );
+        std::ifstream               manifest( manifestPath );
+        if ( !manifest.is_open( ) )
+        {
+            return false;
+        }
+
+        fromManifest = true;
+        std::string line;
+        while ( std::getline( manifest, line ) )
+        {
+            const size_t begin = line.find_first_not_of( " \t\r" );
+            if ( begin == std::string::npos || line[ begin ] == '#' )
+            {
+                continue;
+            }
+            const size_t                end  = line.find_last_not_of( " \t\r" );
+            const std::filesystem::path path = line.substr( begin, end - begin + 1 );
+            paths.push_back( path.is_absolute( ) ? path.string( ) : ( manifestPath.parent_path( ) / path ).string( ) );
+        }
+    }
+    else
+    {
+        const std::filesystem::path directory = FileIO::GetResourcePath( desc.SourceDirectory ).Get( );
+        std::error_code             error;
+        if ( !std::filesystem::is_directory( directory, error ) )
+        {
+            return false;
+        }
+
+        auto visit = [ & ]( const std::filesystem::directory_entry &entry )
+        {
+            if ( entry.is_regular_file( ) )
+            {
+                paths.push_back( entry.path( ).string( ) );
+            }
+        };
+        if ( desc.Recursive )
+        {
+            for ( const auto &entry : std::filesystem::recursive_directory_iterator( directory ) )
+            {
+                visit( entry );
+            }
+        }
+        else
+        {
+            for ( const auto &entry : std::filesystem::directory_iterator( directory ) )
+            {
+                visit( entry );
+            }
+        }
+        // Iteration order is unspecified, keeps asset names and the result order reproducible
+        std::ranges::sort( paths );
+    }
+
+    std::unordered_map<std::string, uint32_t> knownSources;
+    for ( const std::string &path : paths )
+    {
+        SourceKind kind;
+        if ( !Classify( path, kind ) )
+        {
+            if ( fromManifest )
+            {
+                spdlog::warn( "Skipping {}: no importer supports this file", path );
+            }
+            continue;
+        }
+        if ( knownSources.emplace( CanonicalKey( path ), static_cast<uint32_t>( outSources.size( ) ) ).second )
+        {
+            outSources.push_back( { path, kind, { } } );
+        }
+    }
+    return true;
+}
+
+bool BatchImporter::Impl::Classify( const std::string &path, SourceKind &outKind ) const
+{
+    const InteropString extension = AssetPathUtilities::GetFileExtension( path.c_str( ) );
+    if ( extension.IsEmpty( ) )
+    {
+        return false;
+    }
+
+    if ( m_modelImporter.CanProcessFileExtension( extension ) )
+    {
+        outKind = SourceKind::Model;
+        return true;
+    }
+    if ( m_textureImporter.CanProcessFileExtension( extension ) )
+    {
+        outKind = SourceKind::Texture;
+        return true;
+    }
+    if ( m_vgImporter.CanProcessFileExtension( extension ) )
+    {
+        outKind = SourceKind::VectorGraphics;
+        return true;
+    }
+    // FontImporter lists its extensions without the dot
+    if ( m_fontImporter.CanProcessFileExtension( extension.Get( ) + 1 ) )
+    {
+        outKind = SourceKind::Font;
+        return true;
+    }
+    return false;
+}
+
+void BatchImporter::Impl::ScanModelTextures( std::vector<SourceFile> &sources ) const
+{
+    std::vector<uint32_t> models;
+    for ( uint32_t i = 0; i < sources.size( ); ++i )
+    {
+        if ( sources[ i ].Kind == SourceKind::Model )
+        {
+            models.push_back( i );
+        }
+    }
+
+    // Reading a model is most of the cost of scanning it, so models are scanned in parallel
+    std::vector<std::vector<std::string>> modelTextures( models.size( ) );
+    JobSystem::Get( ).ParallelFor( static_cast<uint32_t>( models.size( ) ),
+                                   [ & ]( const uint32_t begin, const uint32_t end )
+                                   {
+                                       const AssimpImporter importer;
+                                       for ( uint32_t i = begin; i < end; ++i )
+                                       {
+                                           const InteropStringArray textures = importer.GetExternalTextures( sources[ models[ i ] ].Path.c_str( ) );
+                                           for ( uint32_t j = 0; j < textures.NumElements; ++j )
+                                           {
+                                               modelTextures[ i ].emplace_back( textures.Elements[ j ].Get( ) );
+                                           }
+                                       }
+                                   } );
+
+    std::unordered_map<std::string, uint32_t> textureSources;
+    for ( uint32_t i = 0; i < sources.size( ); ++i )
+    {
+        if ( sources[ i ].Kind == SourceKind::Texture )
+        {
+            textureSources.emplace( CanonicalKey( sources[ i ].Path ), i );
+        }
+    }
+
+    // Textures shared by several models, or also listed as sources themselves, become a single texture source
+    for ( uint32_t i = 0; i < models.size( ); ++i )
+    {
+        for ( const std::string &texturePath : modelTextures[ i ] )
+        {
+            const auto [ it, inserted ] = textureSources.emplace( CanonicalKey( texturePath ), static_cast<uint32_t>( sources.size( ) ) );
+            if ( inserted )
+            {
+                sources.push_back( { texturePath, SourceKind::Texture, { } } );
+            }
+            sources[ models[ i ] ].Textures.push_back( { texturePath, it->second } );
+        }
+    }
+}
+
+void BatchImporter::Impl::ImportSource( const BatchImportDesc &desc, const SourceFile &source, const std::vector<SourceResult> &results, SourceResult &outResult )
+{
+    const InteropString sourcePath( source.Path.c_str( ) );
+
+    ImporterResult result;
+    switch ( source.Kind )
+    {
+    case SourceKind::Model:
+        {
+            std::vector<ImportedAsset> importedTextures;
+            for ( const TextureReference &texture : source.Textures )
+            {
+                const SourceResult &textureResult = results[ texture.Source ];
+                if ( textureResult.ResultCode == ImporterResultCode::Success && !textureResult.CreatedAssets.empty( ) )
+                {
+                    importedTextures.push_back( { texture.Path.c_str( ), textureResult.CreatedAssets.front( ) } );
+                }
+            }
+
+            AssimpImportDesc modelDesc             = desc.ModelDesc;
+            modelDesc.SourceFilePath               = sourcePath;
+            modelDesc.TargetDirectory              = desc.TargetDirectory;
+            modelDesc.AssetNamePrefix              = desc.AssetNamePrefix;
+            modelDesc.ImportedTextures.Elements    = importedTextures.data( );
+            modelDesc.ImportedTextures.NumElements = static_cast<uint32_t>( importedTextures.size( ) );
+            modelDesc.Cache                        = desc.Cache;
+
+            const AssimpImporter importer;
+            result = importer.Import( modelDesc );
+            outResult.CreatedAssets.assign( result.CreatedAssets.Elements, result.CreatedAssets.Elements + result.CreatedAssets.NumElements );
+            break;
+        }
+    case SourceKind::Texture:
+        {
+            TextureImportDesc textureDesc = desc.TextureDesc;
+            textureDesc.SourceFilePath    = sourcePath;
+            textureDesc.TargetDirectory   = desc.TargetDirectory;
+            textureDesc.AssetNamePrefix   = desc.AssetNamePrefix;
+            textureDesc.Cache             = desc.Cache;
+
+            const TextureImporter importer;
+            result = importer.Import( textureDesc );
+            outResult.CreatedAssets.assign( result.CreatedAssets.Elements, result.CreatedAssets.Elements + result.CreatedAssets.NumElements );
+            break;
+        }
+    case SourceKind::Font:
+        {
+            FontImportDesc fontDesc  = desc.FontDesc;
+            fontDesc.SourceFilePath  = sourcePath;
+            fontDesc.TargetDirectory = desc.TargetDirectory;
+            fontDesc.AssetNamePrefix = desc.AssetNamePrefix;
+            fontDesc.TargetContainer = nullptr; // Would be shared between jobs
+
+            const FontImporter importer;
+            result = importer.Import( fontDesc );
+            outResult.CreatedAssets.assign( result.CreatedAssets.Elements, result.CreatedAssets.Elements + result.CreatedAssets.NumElements );
+            break;
+        }
+    case SourceKind::VectorGraphics:
+        {
+            VGImportDesc vgDesc    = desc.VGDesc;
+            vgDesc.SourceFilePath  = sourcePath;
+            vgDesc.TargetDirectory = desc.TargetDirectory;
+            vgDesc.AssetNamePrefix = desc.AssetNamePrefix;
+            vgDesc.Canvas          = nullptr; // Would be shared between jobs
+
+            const VGImporter importer;
+            result = importer.Import( vgDesc );
+            outResult.CreatedAssets.assign( result.CreatedAssets.Elements, result.CreatedAssets.Elements + result.CreatedAssets.NumElements );
+            break;
+        }
+    }
+
+    outResult.ResultCode = result.ResultCode;
+    if ( result.ResultCode != ImporterResultCode::Success )
+    {
+        outResult.ErrorMessage = InteropString( source.Path.c_str( ) ).Append( ": " ).Append( result.ErrorMessage.Get( ) );
+        spdlog::error( "Batch import of {} failed: {}", source.Path, result.ErrorMessage.Get( ) );
+    }
+
+    for ( AssetUri &uri : outResult.CreatedAssets )
+    {
+        uri = RelativeToTarget( desc, uri );
+        if ( desc.TargetBundle != nullptr )
+        {
+            AddToBundle( desc, uri );
+        }
+    }
+}
+
+AssetUri BatchImporter::Impl::RelativeToTarget( const BatchImportDesc &desc, const AssetUri &uri )
+{
+    // TextureImporter reports the path including TargetDirectory, the other importers report it relative to TargetDirectory
+    const std::filesystem::path path     = uri.Path.Get( );
+    const std::filesystem::path relative = path.lexically_relative( desc.TargetDirectory.Get( ) );
+    if ( relative.empty( ) || *relative.begin( ) == ".." )
+    {
+        return uri;
+    }
+    return AssetUri::Create( relative.generic_string( ).c_str( ) );
+}
+
+void BatchImporter::Impl::AddToBundle( const BatchImportDesc &desc, const AssetUri &uri )
+{
+    const std::filesystem::path path     = std::filesystem::path( desc.TargetDirectory.Get( ) ) / uri.Path.Get( );
+    const InteropString         filePath = path.string( ).c_str( );
+    if ( !FileIO::FileExists( filePath ) )
+    {
+        spdlog::error( "Failed to add asset to bundle: file does not exist: {}", filePath.Get( ) );
+        return;
+    }
+
+    std::string extension = path.extension( ).string( );
+    if ( !extension.empty( ) && extension[ 0 ] == '.' )
+    {
+        extension = extension.substr( 1 );
+    }
+
+    std::vector<Byte> fileData( FileIO::GetFileNumBytes( filePath ) );
+    FileIO::ReadFile( filePath, { fileData.data( ), fileData.size( ) } );
+    desc.TargetBundle->AddAsset( uri, Bundle::DetermineAssetTypeFromExtension( extension.c_str( ) ), ByteArrayView( fileData.data( ), fileData.size( ) ) );
+}
@@ -26,7 +26,6 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "msdf-atlas-gen/TightAtlasPacker.h"
 #include "msdf-atlas-gen/glyph-generators.h"
 
-#include <thread>
 #include <unordered_set>
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
 #include "DenOfIzGraphics/Assets/FileSystem/PathResolver.h"
@@ -34,6 +33,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphics/Assets/Import/AssetPathUtilities.h"
 #include "DenOfIzGraphics/Assets/Import/FontImporter.h"
 #include "DenOfIzGraphics/Assets/Serde/Font/FontAssetWriter.h"
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
 #include "DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
@@ -65,6 +65,7 @@ namespace DenOfIz
             InteropString  ErrorMessage;
 
             FontAsset        *FontAsset;
+            size_t            EstimatedArenaSize = 0; // Also presizes the container the asset is serialized into
             std::vector<Byte> AtlasDataStorage; // Could potentially grow afterwards so not using Arena
 
             uint32_t CurrentAtlasX = 0;
@@ -149,12 +150,13 @@ ImporterResult FontImporter::Import( const FontImportDesc &desc ) const
     const FontImporterImpl::FontStats stats = CalculateFontStats( *m_impl, desc );
 
     FontImporterImpl::ImportContext context;
-    context.SourceFilePath    = desc.SourceFilePath;
-    context.TargetDirectory   = desc.TargetDirectory;
-    context.AssetNamePrefix   = desc.AssetNamePrefix;
-    context.Desc              = desc;
-    context.Result.ResultCode = ImporterResultCode::Success;
-    context.FontAsset         = new FontAsset( );
+    context.SourceFilePath     = desc.SourceFilePath;
+    context.TargetDirectory    = desc.TargetDirectory;
+    context.AssetNamePrefix    = desc.AssetNamePrefix;
+    context.Desc               = desc;
+    context.Result.ResultCode  = ImporterResultCode::Success;
+    context.FontAsset          = new FontAsset( );
+    context.EstimatedArenaSize = stats.EstimatedArenaSize;
     context.FontAsset->_Arena.EnsureCapacity( stats.EstimatedArenaSize );
 
     const size_t atlasSize = stats.AtlasWidth * stats.AtlasHeight * FontAsset::NumChannels;
@@ -363,7 +365,7 @@ namespace
         msdf_atlas::ImmediateAtlasGenerator<float, 4, msdf_atlas::mtsdfGenerator, msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, 4>> generator( width, height );
 
         generator.setAttributes( attributes );
-        generator.setThreadCount( std::thread::hardware_concurrency( ) );
+        generator.setThreadCount( JobSystem::Get( ).NumWorkers( ) );
 
         // Generate Atlas:
         generator.generate( glyphs.data( ), glyphs.size( ) );
@@ -479,7 +481,10 @@ namespace
         {
             container = new BinaryContainer( );
         }
+        container->Reserve( container->NumBytes( ) + context.EstimatedArenaSize );
         BinaryWriter writer( *container );
+        // Container writers start at the beginning, the font is appended after whatever TargetContainer already holds
+        writer.Seek( container->NumBytes( ) );
 
         FontAssetWriterDesc writerDesc{ };
         writerDesc.Writer = &writer;
@@ -0,0 +1,311 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Assets/Import/ImportCache.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryReader.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryWriter.h"
+#include "DenOfIzGraphicsInternal/Utilities/ContentHash.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr size_t HashChunkNumBytes = 1024 * 1024;
+
+    void WriteStamps( const BinaryWriter &writer, const auto &stamps )
+    {
+        writer.WriteUInt32( static_cast<uint32_t>( stamps.size( ) ) );
+        for ( const auto &stamp : stamps )
+        {
+            writer.WriteString( stamp.Path.c_str( ) );
+            writer.WriteUInt64( stamp.NumBytes );
+            writer.WriteInt64( stamp.WriteTime );
+            writer.WriteUInt64( stamp.ContentHash );
+        }
+    }
+
+    void ReadStamps( BinaryReader &reader, auto &stamps )
+    {
+        stamps.resize( reader.ReadUInt32( ) );
+        for ( auto &stamp : stamps )
+        {
+            stamp.Path        = reader.ReadString( ).Get( );
+            stamp.NumBytes    = reader.ReadUInt64( );
+            stamp.WriteTime   = reader.ReadInt64( );
+            stamp.ContentHash = reader.ReadUInt64( );
+        }
+    }
+
+    bool HashFile( const std::string &path, uint64_t &outHash )
+    {
+        std::ifstream file( path, std::ios::binary );
+        if ( !file.is_open( ) )
+        {
+            return false;
+        }
+
+        ContentHash       hash;
+        std::vector<Byte> chunk( HashChunkNumBytes );
+        while ( file )
+        {
+            file.read( reinterpret_cast<char *>( chunk.data( ) ), static_cast<std::streamsize>( chunk.size( ) ) );
+            hash.Append( chunk.data( ), static_cast<size_t>( file.gcount( ) ) );
+        }
+        outHash = hash.Value( );
+        return !file.bad( );
+    }
+} // namespace
+
+std::string ImportCache::Key( const std::string &sourceFilePath )
+{
+    std::error_code             error;
+    const std::filesystem::path path = std::filesystem::weakly_canonical( FileIO::GetResourcePath( sourceFilePath.c_str( ) ).Get( ), error );
+    return error ? sourceFilePath : path.string( );
+}
+
+bool ImportCache::Stamp( const std::string &path, FileStamp &outStamp )
+{
+    std::error_code error;
+    outStamp.Path     = Key( path );
+    outStamp.NumBytes = std::filesystem::file_size( outStamp.Path, error );
+    if ( error )
+    {
+        return false;
+    }
+    outStamp.WriteTime = std::filesystem::last_write_time( outStamp.Path, error ).time_since_epoch( ).count( );
+    return !error && HashFile( outStamp.Path, outStamp.ContentHash );
+}
+
+bool ImportCache::IsUnchanged( FileStamp &stamp )
+{
+    std::error_code error;
+    if ( std::filesystem::file_size( stamp.Path, error ) != stamp.NumBytes || error )
+    {
+        return false;
+    }
+    const int64_t writeTime = std::filesystem::last_write_time( stamp.Path, error ).time_since_epoch( ).count( );
+    if ( error )
+    {
+        return false;
+    }
+    if ( writeTime == stamp.WriteTime )
+    {
+        return true;
+    }
+
+    // Touched, for example by a fresh checkout, only a different content counts as a change
+    uint64_t contentHash = 0;
+    if ( !HashFile( stamp.Path, contentHash ) || contentHash != stamp.ContentHash )
+    {
+        return false;
+    }
+    stamp.WriteTime = writeTime;
+    return true;
+}
+
+bool ImportCache::Find( const std::string &sourceFilePath, const uint64_t importerHash, const uint64_t optionsHash, std::vector<AssetUri> &outCreatedAssets )
+{
+    const std::string key = Key( sourceFilePath );
+    Entry             entry;
+    {
+        std::lock_guard lock( m_mutex );
+        const auto      it = m_entries.find( key );
+        if ( it == m_entries.end( ) || it->second.ImporterHash != importerHash || it->second.OptionsHash != optionsHash )
+        {
+            return false;
+        }
+        entry = it->second;
+    }
+
+    // Checked without holding the lock, hashing a changed file can take a while
+    for ( FileStamp &stamp : entry.Inputs )
+    {
+        if ( !IsUnchanged( stamp ) )
+        {
+            spdlog::info( "Import cache miss for {}: {} changed", sourceFilePath, stamp.Path );
+            return false;
+        }
+    }
+    for ( FileStamp &stamp : entry.Outputs )
+    {
+        if ( !IsUnchanged( stamp ) )
+        {
+            spdlog::info( "Import cache miss for {}: output {} is missing or was modified", sourceFilePath, stamp.Path );
+            return false;
+        }
+    }
+
+    outCreatedAssets = entry.CreatedAssets;
+    {
+        // Keeps the refreshed modification times so the next check doesn't hash the files again
+        std::lock_guard lock( m_mutex );
+        if ( const auto it = m_entries.find( key ); it != m_entries.end( ) && it->second.ImporterHash == importerHash && it->second.OptionsHash == optionsHash )
+        {
+            it->second = std::move( entry );
+        }
+    }
+    spdlog::info( "Import cache hit for {}, reusing {} assets", sourceFilePath, outCreatedAssets.size( ) );
+    return true;
+}
+
+void ImportCache::Store( const ImportCacheRecord &record )
+{
+    Entry entry;
+    entry.ImporterHash  = record.ImporterHash;
+    entry.OptionsHash   = record.OptionsHash;
+    entry.CreatedAssets = record.CreatedAssets;
+
+    auto stampAll = [ & ]( const std::vector<std::string> &paths, std::vector<FileStamp> &stamps )
+    {
+        for ( const std::string &path : paths )
+        {
+            // Importers may report the same file under different spellings, stamps hold the canonical path
+            const std::string key = Key( path );
+            if ( std::ranges::any_of( stamps, [ & ]( const FileStamp &stamp ) { return stamp.Path == key; } ) )
+            {
+                continue;
+            }
+            if ( FileStamp stamp; Stamp( key, stamp ) )
+            {
+                stamps.push_back( std::move( stamp ) );
+                continue;
+            }
+            spdlog::warn( "Not caching the import of {}: failed to read {}", record.SourceFilePath, path );
+            return false;
+        }
+        return true;
+    };
+    if ( !stampAll( record.InputFiles, entry.Inputs ) || !stampAll( record.OutputFiles, entry.Outputs ) )
+    {
+        return;
+    }
+
+    std::lock_guard lock( m_mutex );
+    m_entries[ Key( record.SourceFilePath ) ] = std::move( entry );
+}
+
+uint32_t ImportCache::NumEntries( )
+{
+    std::lock_guard lock( m_mutex );
+    return static_cast<uint32_t>( m_entries.size( ) );
+}
+
+void ImportCache::Clear( )
+{
+    std::lock_guard lock( m_mutex );
+    m_entries.clear( );
+}
+
+bool ImportCache::Save( const InteropString &path )
+{
+    std::lock_guard lock( m_mutex );
+
+    // Written next to the cache and renamed over it, an interrupted save leaves the previous cache intact
+    const std::filesystem::path cachePath = FileIO::GetResourcePath( path ).Get( );
+    std::filesystem::path       tempPath  = cachePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file( tempPath, std::ios::binary | std::ios::trunc );
+        if ( !file.is_open( ) )
+        {
+            spdlog::error( "Failed to open import cache for writing: {}", path.Get( ) );
+            return false;
+        }
+
+        const BinaryWriter writer( &file );
+        writer.WriteUInt64( Magic );
+        writer.WriteUInt32( Version );
+        writer.WriteUInt32( static_cast<uint32_t>( m_entries.size( ) ) );
+        for ( const auto &[ sourcePath, entry ] : m_entries )
+        {
+            writer.WriteString( sourcePath.c_str( ) );
+            writer.WriteUInt64( entry.ImporterHash );
+            writer.WriteUInt64( entry.OptionsHash );
+            WriteStamps( writer, entry.Inputs );
+            WriteStamps( writer, entry.Outputs );
+            writer.WriteUInt32( static_cast<uint32_t>( entry.CreatedAssets.size( ) ) );
+            for ( const AssetUri &uri : entry.CreatedAssets )
+            {
+                writer.WriteString( uri.ToInteropString( ) );
+            }
+        }
+        writer.Flush( );
+        if ( !file.good( ) )
+        {
+            spdlog::error( "Failed to write import cache: {}", path.Get( ) );
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename( tempPath, cachePath, error );
+    if ( error )
+    {
+        spdlog::error( "Failed to replace import cache {}: {}", path.Get( ), error.message( ) );
+        return false;
+    }
+    return true;
+}
+
+bool ImportCache::Load( const InteropString &path )
+{
+    if ( !FileIO::FileExists( path ) )
+    {
+        spdlog::error( "Import cache does not exist: {}", path.Get( ) );
+        return false;
+    }
+
+    BinaryReader reader( path );
+    if ( reader.ReadUInt64( ) != Magic )
+    {
+        spdlog::error( "Invalid import cache: incorrect magic number in {}", path.Get( ) );
+        return false;
+    }
+    if ( const uint32_t version = reader.ReadUInt32( ); version != Version )
+    {
+        // Entries of other versions might describe outputs of an older format, starting over is always safe
+        spdlog::warn( "Ignoring import cache {} of version {}", path.Get( ), version );
+        return false;
+    }
+
+    std::lock_guard lock( m_mutex );
+    m_entries.clear( );
+    const uint32_t numEntries = reader.ReadUInt32( );
+    for ( uint32_t i = 0; i < numEntries; ++i )
+    {
+        const std::string sourcePath = reader.ReadString( ).Get( );
+        Entry             entry;
+        entry.ImporterHash = reader.ReadUInt64( );
+        entry.OptionsHash  = reader.ReadUInt64( );
+        ReadStamps( reader, entry.Inputs );
+        ReadStamps( reader, entry.Outputs );
+        entry.CreatedAssets.resize( reader.ReadUInt32( ) );
+        for ( AssetUri &uri : entry.CreatedAssets )
+        {
+            uri = AssetUri::Parse( reader.ReadString( ) );
+        }
+        m_entries[ sourcePath ] = std::move( entry );
+    }
+    return true;
+}
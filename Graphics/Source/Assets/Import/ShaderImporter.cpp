@@ -37,7 +37,8 @@ public:
     struct ImportContext
     {
         ShaderImportDesc Desc;
-        ShaderAsset     *ShaderAsset = nullptr;
+        ShaderAsset     *ShaderAsset        = nullptr;
+        size_t           EstimatedArenaSize = 0;
         InteropString    ErrorMessage;
         ImporterResult   Result;
     };
@@ -121,8 +122,9 @@ ImporterResult ShaderImporter::Impl::Import( const ShaderImportDesc &desc )
     const ShaderStats stats = CalculateShaderStats( desc );
 
     ImportContext context;
-    context.Result.ResultCode = ImporterResultCode::Success;
-    context.Desc              = desc;
+    context.Result.ResultCode  = ImporterResultCode::Success;
+    context.Desc               = desc;
+    context.EstimatedArenaSize = stats.EstimatedArenaSize;
     if ( context.Desc.ProgramDesc.ShaderStages.NumElements == 0 )
     {
         spdlog::warn( "No Shader Stages provided." );
@@ -178,7 +180,7 @@ void ShaderImporter::Impl::WriteShaderAsset( const ImportContext &context, Asset
     }
     outputPath += shaderAssetFileName.Get( );
 
-    BinaryContainer container{ };
+    BinaryContainer container( context.EstimatedArenaSize );
     BinaryWriter    writer( container );
 
     ShaderAssetWriterDesc writerDesc{ };
@@ -0,0 +1,612 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphicsInternal/Assets/Import/TextureBlockCompressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+#include "DenOfIzGraphicsInternal/Utilities/ParallelFor.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr uint32_t BlockDim          = 4;
+    constexpr uint32_t NumBlockTexels    = BlockDim * BlockDim;
+    constexpr uint32_t NumChannels       = 4;
+    constexpr uint32_t PowerIterations   = 8;
+    constexpr uint32_t RefineIterations  = 2;
+    constexpr uint32_t BlockRowGrainSize = 2;
+    // Interpolation weights out of 64 of BC7 4 bit indices
+    constexpr uint32_t Bc7Weights[ 16 ]{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    using BlockTexels = float[ NumBlockTexels ][ NumChannels ]; // Row major, 0 to 255
+
+    // Little endian bit stream of a 128 bit BC7 block
+    class BlockBits
+    {
+        uint64_t m_words[ 2 ]{ };
+        uint32_t m_position = 0;
+
+    public:
+        void Write( const uint32_t value, const uint32_t numBits )
+        {
+            if ( m_position < 64 )
+            {
+                m_words[ 0 ] |= static_cast<uint64_t>( value ) << m_position;
+                if ( m_position + numBits > 64 )
+                {
+                    m_words[ 1 ] |= static_cast<uint64_t>( value ) >> ( 64 - m_position );
+                }
+            }
+            else
+            {
+                m_words[ 1 ] |= static_cast<uint64_t>( value ) << ( m_position - 64 );
+            }
+            m_position += numBits;
+        }
+
+        void Store( Byte *destination ) const
+        {
+            for ( uint32_t i = 0; i < 16; ++i )
+            {
+                destination[ i ] = static_cast<Byte>( m_words[ i / 8 ] >> ( i % 8 * 8 ) );
+            }
+        }
+    };
+
+    // Texels past the edge of the mip repeat the last row or column
+    void FetchBlock( const Byte *mip, const TextureMip &mipInfo, const uint32_t blockX, const uint32_t blockY, BlockTexels &texels )
+    {
+        for ( uint32_t y = 0; y < BlockDim; ++y )
+        {
+            const uint32_t sourceY = std::min( blockY * BlockDim + y, mipInfo.Height - 1 );
+            for ( uint32_t x = 0; x < BlockDim; ++x )
+            {
+                const uint32_t sourceX = std::min( blockX * BlockDim + x, mipInfo.Width - 1 );
+                const Byte    *texel   = mip + static_cast<size_t>( sourceY ) * mipInfo.RowPitch + sourceX * NumChannels;
+                for ( uint32_t c = 0; c < NumChannels; ++c )
+                {
+                    texels[ y * BlockDim + x ][ c ] = texel[ c ];
+                }
+            }
+        }
+    }
+
+    template <uint32_t N>
+    float Dot( const float *a, const float *b )
+    {
+        float sum = 0.0f;
+        for ( uint32_t c = 0; c < N; ++c )
+        {
+            sum += a[ c ] * b[ c ];
+        }
+        return sum;
+    }
+
+    // Endpoints at the extremes of the texels projected on the principal axis of their first N channels
+    template <uint32_t N>
+    void FitLine( const BlockTexels &texels, float ( &e0 )[ N ], float ( &e1 )[ N ] )
+    {
+        float mean[ N ]{ };
+        for ( const auto &texel : texels )
+        {
+            for ( uint32_t c = 0; c < N; ++c )
+            {
+                mean[ c ] += texel[ c ] / NumBlockTexels;
+            }
+        }
+
+        float covariance[ N ][ N ]{ };
+        for ( const auto &texel : texels )
+        {
+            for ( uint32_t i = 0; i < N; ++i )
+            {
+                for ( uint32_t j = 0; j < N; ++j )
+                {
+                    covariance[ i ][ j ] += ( texel[ i ] - mean[ i ] ) * ( texel[ j ] - mean[ j ] );
+                }
+            }
+        }
+
+        // Power iteration from the row of the channel varying the most
+        uint32_t largest = 0;
+        for ( uint32_t c = 1; c < N; ++c )
+        {
+            largest = covariance[ c ][ c ] > covariance[ largest ][ largest ] ? c : largest;
+        }
+        float axis[ N ];
+        std::copy_n( covariance[ largest ], N, axis );
+        for ( uint32_t iteration = 0; iteration < PowerIterations; ++iteration )
+        {
+            float next[ N ]{ };
+            for ( uint32_t i = 0; i < N; ++i )
+            {
+                next[ i ] = Dot<N>( covariance[ i ], axis );
+            }
+            const float length = std::sqrt( Dot<N>( next, next ) );
+            if ( length < 1e-6f )
+            {
+                std::fill_n( axis, N, 0.0f ); // Single color
+                break;
+            }
+            for ( uint32_t c = 0; c < N; ++c )
+            {
+                axis[ c ] = next[ c ] / length;
+            }
+        }
+
+        float low  = 0.0f;
+        float high = 0.0f;
+        for ( const auto &texel : texels )
+        {
+            float offset[ N ];
+            for ( uint32_t c = 0; c < N; ++c )
+            {
+                offset[ c ] = texel[ c ] - mean[ c ];
+            }
+            const float t = Dot<N>( offset, axis );
+            low           = std::min( low, t );
+            high          = std::max( high, t );
+        }
+        for ( uint32_t c = 0; c < N; ++c )
+        {
+            e0[ c ] = std::clamp( mean[ c ] + low * axis[ c ], 0.0f, 255.0f );
+            e1[ c ] = std::clamp( mean[ c ] + high * axis[ c ], 0.0f, 255.0f );
+        }
+    }
+
+    // Least squares endpoints for texels reconstructed as ( 1 - t ) * e0 + t * e1, false when every t is the same
+    template <uint32_t N>
+    bool FitEndpoints( const BlockTexels &texels, const float ( &t )[ NumBlockTexels ], float ( &e0 )[ N ], float ( &e1 )[ N ] )
+    {
+        float a = 0.0f;
+        float b = 0.0f;
+        float c = 0.0f;
+        float x0[ N ]{ };
+        float x1[ N ]{ };
+        for ( uint32_t i = 0; i < NumBlockTexels; ++i )
+        {
+            const float s = 1.0f - t[ i ];
+            a += s * s;
+            b += s * t[ i ];
+            c += t[ i ] * t[ i ];
+            for ( uint32_t ch = 0; ch < N; ++ch )
+            {
+                x0[ ch ] += s * texels[ i ][ ch ];
+                x1[ ch ] += t[ i ] * texels[ i ][ ch ];
+            }
+        }
+
+        const float determinant = a * c - b * b;
+        if ( std::abs( determinant ) < 1e-6f )
+        {
+            return false;
+        }
+        for ( uint32_t ch = 0; ch < N; ++ch )
+        {
+            e0[ ch ] = std::clamp( ( c * x0[ ch ] - b * x1[ ch ] ) / determinant, 0.0f, 255.0f );
+            e1[ ch ] = std::clamp( ( a * x1[ ch ] - b * x0[ ch ] ) / determinant, 0.0f, 255.0f );
+        }
+        return true;
+    }
+
+    uint16_t To565( const float ( &color )[ 3 ] )
+    {
+        const auto r = static_cast<uint32_t>( std::lrintf( color[ 0 ] * 31.0f / 255.0f ) );
+        const auto g = static_cast<uint32_t>( std::lrintf( color[ 1 ] * 63.0f / 255.0f ) );
+        const auto b = static_cast<uint32_t>( std::lrintf( color[ 2 ] * 31.0f / 255.0f ) );
+        return static_cast<uint16_t>( r << 11 | g << 5 | b );
+    }
+
+    void From565( const uint16_t value, float ( &color )[ 3 ] )
+    {
+        const uint32_t r = value >> 11 & 31;
+        const uint32_t g = value >> 5 & 63;
+        const uint32_t b = value & 31;
+        color[ 0 ]       = static_cast<float>( r << 3 | r >> 2 );
+        color[ 1 ]       = static_cast<float>( g << 2 | g >> 4 );
+        color[ 2 ]       = static_cast<float>( b << 3 | b >> 2 );
+    }
+
+    struct Bc1Block
+    {
+        uint16_t Color0  = 0;
+        uint16_t Color1  = 0;
+        uint32_t Indices = 0;
+        float    Error   = std::numeric_limits<float>::max( );
+    };
+
+    // BC1 decodes four colors when Color0 > Color1, BC3 always does. Three color blocks never use index 3, it is transparent black.
+    Bc1Block EvaluateBc1( const BlockTexels &texels, const float ( &e0 )[ 3 ], const float ( &e1 )[ 3 ], const bool forceFourColor )
+    {
+        Bc1Block block;
+        block.Color0 = To565( e0 );
+        block.Color1 = To565( e1 );
+        if ( block.Color0 < block.Color1 )
+        {
+            std::swap( block.Color0, block.Color1 );
+        }
+
+        float palette[ 4 ][ 3 ];
+        From565( block.Color0, palette[ 0 ] );
+        From565( block.Color1, palette[ 1 ] );
+        const bool fourColor = forceFourColor || block.Color0 > block.Color1;
+        for ( uint32_t c = 0; c < 3; ++c )
+        {
+            palette[ 2 ][ c ] = fourColor ? ( 2.0f * palette[ 0 ][ c ] + palette[ 1 ][ c ] ) / 3.0f : ( palette[ 0 ][ c ] + palette[ 1 ][ c ] ) * 0.5f;
+            palette[ 3 ][ c ] = ( palette[ 0 ][ c ] + 2.0f * palette[ 1 ][ c ] ) / 3.0f;
+        }
+
+        block.Error                = 0.0f;
+        const uint32_t numColors   = fourColor ? 4 : 3;
+        for ( uint32_t i = 0; i < NumBlockTexels; ++i )
+        {
+            uint32_t bestIndex = 0;
+            float    bestError = std::numeric_limits<float>::max( );
+            for ( uint32_t p = 0; p < numColors; ++p )
+            {
+                float error = 0.0f;
+                for ( uint32_t c = 0; c < 3; ++c )
+                {
+                    const float difference = texels[ i ][ c ] - palette[ p ][ c ];
+                    error += difference * difference;
+                }
+                if ( error < bestError )
+                {
+                    bestError = error;
+                    bestIndex = p;
+                }
+            }
+            block.Indices |= bestIndex << i * 2;
+            block.Error += bestError;
+        }
+        return block;
+    }
+
+    void EncodeBc1( const BlockTexels &texels, const bool forceFourColor, Byte *destination )
+    {
+        float e0[ 3 ];
+        float e1[ 3 ];
+        FitLine<3>( texels, e0, e1 );
+        Bc1Block best = EvaluateBc1( texels, e0, e1, forceFourColor );
+
+        const bool fourColor = forceFourColor || best.Color0 > best.Color1;
+        for ( uint32_t iteration = 0; iteration < RefineIterations; ++iteration )
+        {
+            // Position of each palette entry between Color0 and Color1
+            constexpr float fourColorWeights[ 4 ]{ 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+            constexpr float threeColorWeights[ 4 ]{ 0.0f, 1.0f, 0.5f, 0.0f };
+            float           t[ NumBlockTexels ];
+            for ( uint32_t i = 0; i < NumBlockTexels; ++i )
+            {
+                const uint32_t index = best.Indices >> i * 2 & 3;
+                t[ i ]               = fourColor ? fourColorWeights[ index ] : threeColorWeights[ index ];
+            }
+            if ( !FitEndpoints<3>( texels, t, e0, e1 ) )
+            {
+                break;
+            }
+            const Bc1Block candidate = EvaluateBc1( texels, e0, e1, forceFourColor );
+            if ( candidate.Error >= best.Error )
+            {
+                break;
+            }
+            best = candidate;
+        }
+
+        destination[ 0 ] = static_cast<Byte>( best.Color0 );
+        destination[ 1 ] = static_cast<Byte>( best.Color0 >> 8 );
+        destination[ 2 ] = static_cast<Byte>( best.Color1 );
+        destination[ 3 ] = static_cast<Byte>( best.Color1 >> 8 );
+        for ( uint32_t i = 0; i < 4; ++i )
+        {
+            destination[ 4 + i ] = static_cast<Byte>( best.Indices >> i * 8 );
+        }
+    }
+
+    // Min and max as endpoints with the 8 value palette, covers the range of the block evenly
+    void EncodeBc4( const BlockTexels &texels, const uint32_t channel, Byte *destination )
+    {
+        float low  = 255.0f;
+        float high = 0.0f;
+        for ( const auto &texel : texels )
+        {
+            low  = std::min( low, texel[ channel ] );
+            high = std::max( high, texel[ channel ] );
+        }
+
+        const auto red0  = static_cast<uint32_t>( std::lrintf( high ) );
+        const auto red1  = static_cast<uint32_t>( std::lrintf( low ) );
+        destination[ 0 ] = static_cast<Byte>( red0 );
+        destination[ 1 ] = static_cast<Byte>( red1 );
+
+        uint64_t indices = 0; // A single value block keeps index 0 for every texel which decodes to red0 in either palette
+        if ( red0 > red1 )
+        {
+            float palette[ 8 ]{ static_cast<float>( red0 ), static_cast<float>( red1 ) };
+            for ( uint32_t p = 2; p < 8; ++p )
+            {
+                palette[ p ] = ( static_cast<float>( 8 - p ) * red0 + static_cast<float>( p - 1 ) * red1 ) / 7.0f;
+            }
+            for ( uint32_t i = 0; i < NumBlockTexels; ++i )
+            {
+                uint64_t bestIndex = 0;
+                for ( uint32_t p = 1; p < 8; ++p )
+                {
+                    bestIndex = std::abs( texels[ i ][ channel ] - palette[ p ] ) < std::abs( texels[ i ][ channel ] - palette[ bestIndex ] ) ? p : bestIndex;
+                }
+                indices |= bestIndex << i * 3;
+            }
+        }
+        for ( uint32_t i = 0; i < 6; ++i )
+        {
+            destination[ 2 + i ] = static_cast<Byte>( indices >> i * 8 );
+        }
+    }
+
+    struct Bc7Block
+    {
+        uint32_t Endpoints[ 2 ][ NumChannels ]{ }; // 7 bits, the p bit is the lowest bit of the 8 bit value
+        uint32_t PBits[ 2 ]{ };
+        uint32_t Indices[ NumBlockTexels ]{ };
+        float    Error = std::numeric_limits<float>::max( );
+    };
+
+    Bc7Block EvaluateBc7( const BlockTexels &texels, const float ( &e0 )[ NumChannels ], const float ( &e1 )[ NumChannels ], const uint32_t p0, const uint32_t p1 )
+    {
+        Bc7Block block;
+        block.PBits[ 0 ] = p0;
+        block.PBits[ 1 ] = p1;
+
+        int q0[ NumChannels ];
+        int q1[ NumChannels ];
+        for ( uint32_t c = 0; c < NumChannels; ++c )
+        {
+            block.Endpoints[ 0 ][ c ] = static_cast<uint32_t>( std::clamp( std::lrintf( ( e0[ c ] - static_cast<float>( p0 ) ) * 0.5f ), 0l, 127l ) );
+            block.Endpoints[ 1 ][ c ] = static_cast<uint32_t>( std::clamp( std::lrintf( ( e1[ c ] - static_cast<float>( p1 ) ) * 0.5f ), 0l, 127l ) );
+            q0[ c ]                   = static_cast<int>( block.Endpoints[ 0 ][ c ] << 1 | p0 );
+            q1[ c ]                   = static_cast<int>( block.Endpoints[ 1 ][ c ] << 1 | p1 );
+        }
+
+        float palette[ 16 ][ NumChannels ];
+        for ( uint32_t p = 0; p < 16; ++p )
+        {
+            for ( uint32_t c = 0; c < NumChannels; ++c )
+            {
+                palette[ p ][ c ] = static_cast<float>( ( ( 64 - Bc7Weights[ p ] ) * q0[ c ] + Bc7Weights[ p ] * q1[ c ] + 32 ) >> 6 );
+            }
+        }
+
+        float direction[ NumChannels ];
+        for ( uint32_t c = 0; c < NumChannels; ++c )
+        {
+            direction[ c ] = static_cast<float>( q1[ c ] - q0[ c ] );
+        }
+        const float lengthSquared = Dot<NumChannels>( direction, direction );
+
+        block.Error = 0.0f;
+        for ( uint32_t i = 0; i < NumBlockTexels; ++i )
+        {
+            // The palette lies on a line, projecting finds the nearest entry up to rounding which the neighbors cover
+            float offset[ NumChannels ];
+            for ( uint32_t c = 0; c < NumChannels; ++c )
+            {
+                offset[ c ] = texels[ i ][ c ] - static_cast<float>( q0[ c ] );
+            }
+            const float t       = lengthSquared > 0.0f ? std::clamp( Dot<NumChannels>( offset, direction ) / lengthSquared, 0.0f, 1.0f ) : 0.0f;
+            const int   nearest = static_cast<int>( std::lrintf( t * 15.0f ) );
+
+            float bestError = std::numeric_limits<float>::max( );
+            for ( int p = std::max( 0, nearest - 1 ); p <= std::min( 15, nearest + 1 ); ++p )
+            {
+                float error = 0.0f;
+                for ( uint32_t c = 0; c < NumChannels; ++c )
+                {
+                    const float difference = texels[ i ][ c ] - palette[ p ][ c ];
+                    error += difference * difference;
+                }
+                if ( error < bestError )
+                {
+                    bestError          = error;
+                    block.Indices[ i ] = static_cast<uint32_t>( p );
+                }
+            }
+            block.Error += bestError;
+        }
+        return block;
+    }
+
+    // Mode 6, one subset of RGBA endpoints with a p bit each and 4 bit indices
+    void EncodeBc7( const BlockTexels &texels, Byte *destination )
+    {
+        float e0[ NumChannels ];
+        float e1[ NumChannels ];
+        FitLine<NumChannels>( texels, e0, e1 );
+
+        Bc7Block   best;
+        const auto evaluatePBits = [ & ]
+        {
+            for ( uint32_t p = 0; p < 4; ++p )
+            {
+                if ( const Bc7Block candidate = EvaluateBc7( texels, e0, e1, p & 1, p >> 1 ); candidate.Error < best.Error )
+                {
+                    best = candidate;
+                }
+            }
+        };
+        evaluatePBits( );
+
+        for ( uint32_t iteration = 0; iteration < RefineIterations && best.Error > 0.0f; ++iteration )
+        {
+            float t[ NumBlockTexels ];
+            for ( uint32_t i = 0; i < NumBlockTexels; ++i )
+            {
+                t[ i ] = static_cast<float>( Bc7Weights[ best.Indices[ i ] ] ) / 64.0f;
+            }
+            const float previousError = best.Error;
+            if ( !FitEndpoints<NumChannels>( texels, t, e0, e1 ) )
+            {
+                break;
+            }
+            evaluatePBits( );
+            if ( best.Error >= previousError )
+            {
+                break;
+            }
+        }
+
+        // The first index is stored without its top bit, which must be zero
+        if ( best.Indices[ 0 ] >= 8 )
+        {
+            std::swap( best.Endpoints[ 0 ], best.Endpoints[ 1 ] );
+            std::swap( best.PBits[ 0 ], best.PBits[ 1 ] );
+            for ( uint32_t &index : best.Indices )
+            {
+                index = 15 - index;
+            }
+        }
+
+        BlockBits bits;
+        bits.Write( 1 << 6, 7 );
+        for ( uint32_t c = 0; c < NumChannels; ++c )
+        {
+            bits.Write( best.Endpoints[ 0 ][ c ], 7 );
+            bits.Write( best.Endpoints[ 1 ][ c ], 7 );
+        }
+        bits.Write( best.PBits[ 0 ], 1 );
+        bits.Write( best.PBits[ 1 ], 1 );
+        bits.Write( best.Indices[ 0 ], 3 );
+        for ( uint32_t i = 1; i < NumBlockTexels; ++i )
+        {
+            bits.Write( best.Indices[ i ], 4 );
+        }
+        bits.Store( destination );
+    }
+
+    void EncodeBlock( const TextureCompression compression, const BlockTexels &texels, Byte *destination )
+    {
+        switch ( compression )
+        {
+        case TextureCompression::BC1:
+            EncodeBc1( texels, false, destination );
+            break;
+        case TextureCompression::BC3:
+            EncodeBc4( texels, 3, destination );
+            EncodeBc1( texels, true, destination + 8 );
+            break;
+        case TextureCompression::BC4:
+            EncodeBc4( texels, 0, destination );
+            break;
+        case TextureCompression::BC5:
+            EncodeBc4( texels, 0, destination );
+            EncodeBc4( texels, 1, destination + 8 );
+            break;
+        case TextureCompression::BC7:
+            EncodeBc7( texels, destination );
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace
+
+Format TextureBlockCompressor::CompressedFormat( const TextureCompression compression )
+{
+    switch ( compression )
+    {
+    case TextureCompression::BC1:
+        return Format::BC1Unorm;
+    case TextureCompression::BC3:
+        return Format::BC3Unorm;
+    case TextureCompression::BC4:
+        return Format::BC4Unorm;
+    case TextureCompression::BC5:
+        return Format::BC5Unorm;
+    case TextureCompression::BC7:
+        return Format::BC7Unorm;
+    default:
+        return Format::Undefined;
+    }
+}
+
+uint32_t TextureBlockCompressor::NumBlockBytes( const TextureCompression compression )
+{
+    switch ( compression )
+    {
+    case TextureCompression::BC1:
+    case TextureCompression::BC4:
+        return 8;
+    case TextureCompression::BC3:
+    case TextureCompression::BC5:
+    case TextureCompression::BC7:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+bool TextureBlockCompressor::Compress( const BlockCompressionDesc &desc, MipChain &chain )
+{
+    chain                        = { };
+    const uint32_t numBlockBytes = NumBlockBytes( desc.Compression );
+    if ( numBlockBytes == 0 || desc.Source == nullptr || desc.Mips == nullptr || desc.NumMips == 0 )
+    {
+        spdlog::error( "TextureBlockCompressor: Invalid compression format or empty source" );
+        return false;
+    }
+
+    chain.Mips.assign( desc.Mips, desc.Mips + desc.NumMips );
+    std::vector<uint32_t> firstBlockRows( desc.NumMips + 1, 0 ); // Block rows of every mip numbered consecutively
+    size_t                numBytes = 0;
+    for ( uint32_t i = 0; i < desc.NumMips; ++i )
+    {
+        TextureMip &mip = chain.Mips[ i ];
+        mip.RowPitch    = std::max( 1u, ( mip.Width + BlockDim - 1 ) / BlockDim ) * numBlockBytes;
+        mip.NumRows     = std::max( 1u, ( mip.Height + BlockDim - 1 ) / BlockDim );
+        mip.SlicePitch  = mip.RowPitch * mip.NumRows;
+        mip.DataOffset  = static_cast<uint32_t>( numBytes );
+        numBytes += mip.SlicePitch;
+        firstBlockRows[ i + 1 ] = firstBlockRows[ i ] + mip.NumRows;
+        chain.MipLevels         = std::max( chain.MipLevels, mip.MipIndex + 1 );
+    }
+    chain.Data.resize( numBytes );
+
+    ParallelFor(
+        firstBlockRows.back( ),
+        [ & ]( const uint32_t blockRow )
+        {
+            const auto        mipIndex    = static_cast<uint32_t>( std::upper_bound( firstBlockRows.begin( ), firstBlockRows.end( ), blockRow ) - firstBlockRows.begin( ) - 1 );
+            const TextureMip &source      = desc.Mips[ mipIndex ];
+            const TextureMip &target      = chain.Mips[ mipIndex ];
+            const uint32_t    blockY      = blockRow - firstBlockRows[ mipIndex ];
+            Byte             *destination = chain.Data.data( ) + target.DataOffset + static_cast<size_t>( blockY ) * target.RowPitch;
+
+            BlockTexels texels;
+            for ( uint32_t blockX = 0; blockX < target.RowPitch / numBlockBytes; ++blockX )
+            {
+                FetchBlock( desc.Source + source.DataOffset, source, blockX, blockY, texels );
+                EncodeBlock( desc.Compression, texels, destination + blockX * numBlockBytes );
+            }
+        },
+        BlockRowGrainSize );
+    return true;
+}
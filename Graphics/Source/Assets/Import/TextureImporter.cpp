@@ -23,14 +23,72 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphics/Assets/Bundle/BundleManager.h"
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Import/ImportCache.h"
 #include "DenOfIzGraphics/Assets/Serde/Texture/TextureAsset.h"
 #include "DenOfIzGraphics/Assets/Serde/Texture/TextureAssetWriter.h"
 #include "DenOfIzGraphics/Data/Texture.h"
+#include "DenOfIzGraphicsInternal/Assets/Import/TextureBlockCompressor.h"
+#include "DenOfIzGraphicsInternal/Assets/Import/TextureMipGenerator.h"
 #include "DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
 using namespace DenOfIz;
 
+namespace
+{
+    constexpr uint32_t ImporterVersion = 3; // Bump when the written assets change so cached imports are redone
+
+    uint64_t HashImporter( const InteropString &name )
+    {
+        return Fnv1a( ).Append( name.Get( ), name.NumChars( ) ).Append( reinterpret_cast<const char *>( &ImporterVersion ), sizeof( ImporterVersion ) ).Value( );
+    }
+
+    // Every field except SourceFilePath and Cache, strings include the terminator so adjacent strings can't alias
+    uint64_t HashImportOptions( const TextureImportDesc &desc )
+    {
+        const uint8_t flags[ 8 ]{ desc.GenerateMips, static_cast<uint8_t>( desc.MipFilter ), desc.IsSrgb, desc.PreserveAlphaCoverage,
+                                  static_cast<uint8_t>( desc.Role ), static_cast<uint8_t>( desc.Compression ), desc.NormalizeNormalMaps, desc.FlipY };
+        return Fnv1a( )
+            .Append( desc.TargetDirectory.Get( ), desc.TargetDirectory.NumChars( ) + 1 )
+            .Append( desc.AssetNamePrefix.Get( ), desc.AssetNamePrefix.NumChars( ) + 1 )
+            .Append( reinterpret_cast<const char *>( flags ), sizeof( flags ) )
+            .Append( reinterpret_cast<const char *>( &desc.AlphaCoverageReference ), sizeof( desc.AlphaCoverageReference ) )
+            .Value( );
+    }
+
+    // DDS files are usually block compressed and carry their own mips, only single mip images decoded by stb get a chain
+    bool ShouldGenerateMips( const TextureImportDesc &desc, const Texture &texture )
+    {
+        return desc.GenerateMips && texture.GetExtension( ) != TextureExtension::DDS && texture.GetFormat( ) == Format::R8G8B8A8Unorm && texture.GetMipLevels( ) == 1 &&
+               texture.GetWidth( ) > 0 && texture.GetHeight( ) > 0;
+    }
+
+    TextureCompression ResolveCompression( const TextureImportDesc &desc )
+    {
+        if ( desc.Compression != TextureCompression::Auto )
+        {
+            return desc.Compression;
+        }
+        switch ( desc.Role )
+        {
+        case TextureRole::Normal:
+            return TextureCompression::BC5;
+        case TextureRole::Mask:
+            return TextureCompression::BC4;
+        default:
+            return TextureCompression::BC7;
+        }
+    }
+
+    // Smaller mips may end up with partial blocks, the top mip must not since the GPU expects its size to be a multiple of the block
+    bool CanCompress( const Texture &texture )
+    {
+        return texture.GetExtension( ) != TextureExtension::DDS && texture.GetFormat( ) == Format::R8G8B8A8Unorm && texture.GetWidth( ) > 0 && texture.GetHeight( ) > 0 &&
+               texture.GetWidth( ) % 4 == 0 && texture.GetHeight( ) % 4 == 0;
+    }
+} // namespace
+
 class TextureImporter::Impl
 {
 public:
@@ -45,6 +103,7 @@ public:
         ImporterResult    Result;
         InteropString     ErrorMessage;
         TextureAsset     *TextureAsset = nullptr;
+        MipChain          ProcessedMips; // Empty unless mips were generated or compressed, pixel data then comes from here instead of the texture
     };
 
     struct TextureStats
@@ -76,6 +135,7 @@ public:
 
 private:
     ImporterResultCode ImportTextureInternal( ImportContext &context ) const;
+    ImporterResultCode CompressTexture( ImportContext &context ) const;
     TextureStats       CalculateTextureStats( const TextureImportDesc &desc );
     void               WriteTextureAsset( const ImportContext &context, AssetUri &outAssetUri ) const;
 };
@@ -132,7 +192,7 @@ TextureImporter::Impl::TextureStats TextureImporter::Impl::CalculateTextureStats
     m_texture       = std::make_unique<Texture>( desc.SourceFilePath );
     stats.Width     = m_texture->GetWidth( );
     stats.Height    = m_texture->GetHeight( );
-    stats.MipCount  = m_texture->GetMipLevels( );
+    stats.MipCount  = ShouldGenerateMips( desc, *m_texture ) ? TextureMipGenerator::NumMipLevels( stats.Width, stats.Height ) : m_texture->GetMipLevels( );
     stats.ArraySize = m_texture->GetArraySize( );
 
     stats.EstimatedArenaSize = sizeof( TextureMip ) * stats.MipCount * stats.ArraySize;
@@ -146,6 +206,18 @@ ImporterResult TextureImporter::Impl::Import( const TextureImportDesc &desc )
 {
     spdlog::info( "Starting texture import for file: {}", desc.SourceFilePath.Get( ) );
 
+    const uint64_t importerHash = HashImporter( m_name );
+    const uint64_t optionsHash  = HashImportOptions( desc );
+    if ( std::vector<AssetUri> cachedAssets; desc.Cache != nullptr && desc.Cache->Find( desc.SourceFilePath.Get( ), importerHash, optionsHash, cachedAssets ) )
+    {
+        m_createdAssets.insert( m_createdAssets.end( ), cachedAssets.begin( ), cachedAssets.end( ) );
+
+        ImporterResult result;
+        result.CreatedAssets.NumElements = static_cast<uint32_t>( m_createdAssets.size( ) );
+        result.CreatedAssets.Elements    = m_createdAssets.data( );
+        return result;
+    }
+
     const TextureStats stats = CalculateTextureStats( desc );
 
     ImportContext context;
@@ -185,6 +257,18 @@ ImporterResult TextureImporter::Impl::Import( const TextureImportDesc &desc )
     WriteTextureAsset( context, assetUri );
     m_createdAssets.push_back( assetUri );
 
+    if ( desc.Cache != nullptr )
+    {
+        ImportCacheRecord record;
+        record.SourceFilePath = desc.SourceFilePath.Get( );
+        record.ImporterHash   = importerHash;
+        record.OptionsHash    = optionsHash;
+        record.InputFiles     = { record.SourceFilePath };
+        record.OutputFiles    = { assetUri.Path.Get( ) };
+        record.CreatedAssets  = { assetUri };
+        desc.Cache->Store( record );
+    }
+
     context.Result.CreatedAssets.NumElements = static_cast<uint32_t>( m_createdAssets.size( ) );
     context.Result.CreatedAssets.Elements    = m_createdAssets.data( );
 
@@ -204,9 +288,75 @@ ImporterResultCode TextureImporter::Impl::ImportTextureInternal( ImportContext &
     context.TextureAsset->Dimension = m_texture->GetDimension( );
     context.TextureAsset->Uri.Path  = context.Desc.SourceFilePath;
 
-    const auto sourceMips = m_texture->ReadMipData( );
-    DZArenaArrayHelper<TextureMipArray, TextureMip>::AllocateAndCopyArray( context.TextureAsset->_Arena, context.TextureAsset->Mips, sourceMips.Elements, sourceMips.NumElements );
+    if ( ShouldGenerateMips( context.Desc, *m_texture ) )
+    {
+        MipChainDesc mipChainDesc{ };
+        mipChainDesc.Source                 = m_texture->GetData( ).Elements;
+        mipChainDesc.Width                  = m_texture->GetWidth( );
+        mipChainDesc.Height                 = m_texture->GetHeight( );
+        mipChainDesc.ArraySize              = m_texture->GetArraySize( );
+        mipChainDesc.Filter                 = context.Desc.MipFilter;
+        mipChainDesc.IsSrgb                 = context.Desc.IsSrgb;
+        mipChainDesc.PreserveAlphaCoverage  = context.Desc.PreserveAlphaCoverage;
+        mipChainDesc.AlphaCoverageReference = context.Desc.AlphaCoverageReference;
+        if ( !TextureMipGenerator::Generate( mipChainDesc, context.ProcessedMips ) )
+        {
+            context.Result.ErrorMessage = InteropString( "Failed to generate mips for: " ).Append( context.Desc.SourceFilePath.Get( ) );
+            return ImporterResultCode::ImportFailed;
+        }
+        context.TextureAsset->MipLevels = context.ProcessedMips.MipLevels;
+    }
+    else
+    {
+        const auto sourceMips      = m_texture->ReadMipData( );
+        context.ProcessedMips.Mips = { sourceMips.Elements, sourceMips.Elements + sourceMips.NumElements };
+    }
 
+    if ( context.Desc.Compression != TextureCompression::None )
+    {
+        if ( const ImporterResultCode result = CompressTexture( context ); result != ImporterResultCode::Success )
+        {
+            return result;
+        }
+    }
+
+    const std::vector<TextureMip> &mips = context.ProcessedMips.Mips;
+    DZArenaArrayHelper<TextureMipArray, TextureMip>::AllocateAndCopyArray( context.TextureAsset->_Arena, context.TextureAsset->Mips, mips.data( ), mips.size( ) );
+    return ImporterResultCode::Success;
+}
+
+ImporterResultCode TextureImporter::Impl::CompressTexture( ImportContext &context ) const
+{
+    if ( !CanCompress( *m_texture ) )
+    {
+        spdlog::warn( "TextureImporter: {} is not an RGBA8 image with sides that are a multiple of 4, writing it uncompressed", context.Desc.SourceFilePath.Get( ) );
+        return ImporterResultCode::Success;
+    }
+
+    const TextureCompression compression = ResolveCompression( context.Desc );
+    const std::vector<Byte> &sourceData  = context.ProcessedMips.Data;
+
+    BlockCompressionDesc compressionDesc{ };
+    compressionDesc.Compression = compression;
+    compressionDesc.Source      = sourceData.empty( ) ? m_texture->GetData( ).Elements : sourceData.data( );
+    compressionDesc.Mips        = context.ProcessedMips.Mips.data( );
+    compressionDesc.NumMips     = static_cast<uint32_t>( context.ProcessedMips.Mips.size( ) );
+
+    MipChain compressedMips;
+    if ( !TextureBlockCompressor::Compress( compressionDesc, compressedMips ) )
+    {
+        context.Result.ErrorMessage = InteropString( "Failed to compress: " ).Append( context.Desc.SourceFilePath.Get( ) );
+        return ImporterResultCode::ImportFailed;
+    }
+    context.ProcessedMips = std::move( compressedMips );
+
+    const TextureMip &topMip           = context.ProcessedMips.Mips.front( );
+    context.TextureAsset->Format       = TextureBlockCompressor::CompressedFormat( compression );
+    context.TextureAsset->BitsPerPixel = TextureBlockCompressor::NumBlockBytes( compression ) * 8 / 16; // 16 texels per block
+    context.TextureAsset->BlockSize    = 4;
+    context.TextureAsset->RowPitch     = topMip.RowPitch;
+    context.TextureAsset->NumRows      = topMip.NumRows;
+    context.TextureAsset->SlicePitch   = topMip.SlicePitch;
     return ImporterResultCode::Success;
 }
 
@@ -225,7 +375,9 @@ void TextureImporter::Impl::WriteTextureAsset( const ImportContext &context, Ass
     TextureAssetWriter textureWriter( writerDesc );
     textureWriter.Write( *context.TextureAsset );
 
-    const auto mipDataArray = m_texture->ReadMipData( );
+    const std::vector<Byte> &processedData = context.ProcessedMips.Data;
+    const ByteArrayView      pixelData     = processedData.empty( ) ? m_texture->GetData( ) : ByteArrayView{ processedData.data( ), processedData.size( ) };
+    const TextureMipArray   &mipDataArray  = context.TextureAsset->Mips;
     for ( uint32_t i = 0; i < mipDataArray.NumElements; ++i )
     {
         const TextureMip &mipData   = mipDataArray.Elements[ i ];
@@ -233,7 +385,7 @@ void TextureImporter::Impl::WriteTextureAsset( const ImportContext &context, Ass
         const size_t      mipOffset = mipData.DataOffset;
 
         ByteArrayView pixelDataArray{ };
-        pixelDataArray.Elements    = m_texture->GetData( ).Elements + mipOffset;
+        pixelDataArray.Elements    = pixelData.Elements + mipOffset;
         pixelDataArray.NumElements = mipSize;
         textureWriter.AddPixelData( pixelDataArray, mipData.MipIndex, mipData.ArrayIndex );
     }
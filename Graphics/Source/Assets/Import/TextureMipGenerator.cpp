@@ -0,0 +1,489 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphicsInternal/Assets/Import/TextureMipGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+#include "DenOfIzGraphicsInternal/Utilities/ParallelFor.h"
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define DZ_MIP_GENERATOR_SSE2
+#include <emmintrin.h>
+#elif defined( __aarch64__ ) || defined( _M_ARM64 )
+#define DZ_MIP_GENERATOR_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr uint32_t NumChannels  = 4;
+    constexpr uint32_t RowGrainSize = 8;
+    constexpr float    KaiserWidth  = 3.0f; // Destination texels on either side of the center
+    constexpr float    KaiserAlpha  = 4.0f;
+    // Searching the alpha scale stops after this many halvings of the range, finer than 8 bit alpha can express
+    constexpr uint32_t AlphaScaleIterations = 16;
+    constexpr float    MaxAlphaScale        = 16.0f;
+
+    struct FilterTap
+    {
+        uint32_t Index;
+        float    Weight;
+    };
+
+    // Taps of destination texel i are Taps[ Offsets[ i ] ] up to Taps[ Offsets[ i + 1 ] ], weights sum to 1
+    struct FilterKernel
+    {
+        std::vector<uint32_t>  Offsets;
+        std::vector<FilterTap> Taps;
+    };
+
+    struct Level
+    {
+        uint32_t           Width  = 0;
+        uint32_t           Height = 0;
+        std::vector<float> Texels; // RGBA, the rows of every slice one after another
+
+        [[nodiscard]] size_t RowNumFloats( ) const
+        {
+            return static_cast<size_t>( Width ) * NumChannels;
+        }
+
+        float *Row( const uint32_t row )
+        {
+            return Texels.data( ) + row * RowNumFloats( );
+        }
+    };
+
+    struct SrgbTables
+    {
+        std::array<float, 256> ToLinear{ };
+        // Linear values half way between consecutive sRGB codes, searching them rounds exactly like encoding and rounding would
+        std::array<float, 255> Thresholds{ };
+
+        SrgbTables( )
+        {
+            for ( uint32_t i = 0; i < ToLinear.size( ); ++i )
+            {
+                ToLinear[ i ] = ToLinearValue( static_cast<float>( i ) / 255.0f );
+            }
+            for ( uint32_t i = 0; i < Thresholds.size( ); ++i )
+            {
+                Thresholds[ i ] = ToLinearValue( ( static_cast<float>( i ) + 0.5f ) / 255.0f );
+            }
+        }
+
+        [[nodiscard]] uint8_t Encode( const float linear ) const
+        {
+            return static_cast<uint8_t>( std::upper_bound( Thresholds.begin( ), Thresholds.end( ), linear ) - Thresholds.begin( ) );
+        }
+
+        static float ToLinearValue( const float srgb )
+        {
+            return srgb <= 0.04045f ? srgb / 12.92f : std::pow( ( srgb + 0.055f ) / 1.055f, 2.4f );
+        }
+    };
+
+    const SrgbTables &GetSrgbTables( )
+    {
+        static const SrgbTables tables;
+        return tables;
+    }
+
+    float BesselI0( const float x )
+    {
+        // Power series, converges within a few terms for the arguments a Kaiser window uses
+        const float halfX = x * 0.5f;
+        float       sum   = 1.0f;
+        float       term  = 1.0f;
+        for ( uint32_t k = 1; k < 32 && term * term > sum * 1e-8f; ++k )
+        {
+            term *= halfX / static_cast<float>( k );
+            sum += term * term;
+        }
+        return sum;
+    }
+
+    float Sinc( const float x )
+    {
+        if ( std::abs( x ) < 1e-4f )
+        {
+            return 1.0f;
+        }
+        const float pix = std::numbers::pi_v<float> * x;
+        return std::sin( pix ) / pix;
+    }
+
+    // x is the distance to the center in destination texels
+    float Kaiser( const float x )
+    {
+        const float t = x / KaiserWidth;
+        if ( t * t >= 1.0f )
+        {
+            return 0.0f;
+        }
+        return Sinc( x ) * BesselI0( KaiserAlpha * std::sqrt( 1.0f - t * t ) ) / BesselI0( KaiserAlpha );
+    }
+
+    // Works for any ratio, odd sizes are filtered over the 1.5 or more source texels each destination texel covers instead of dropping
+    // the last row or column. Taps outside the image are clamped to the edge.
+    FilterKernel BuildKernel( const TextureMipFilter filter, const uint32_t sourceSize, const uint32_t destinationSize )
+    {
+        FilterKernel kernel;
+        kernel.Offsets.reserve( destinationSize + 1 );
+
+        const float scale  = static_cast<float>( sourceSize ) / static_cast<float>( destinationSize );
+        const float radius = filter == TextureMipFilter::Box ? 0.0f : KaiserWidth * scale;
+        for ( uint32_t i = 0; i < destinationSize; ++i )
+        {
+            kernel.Offsets.push_back( static_cast<uint32_t>( kernel.Taps.size( ) ) );
+
+            const float  begin    = static_cast<float>( i ) * scale;
+            const float  end      = static_cast<float>( i + 1 ) * scale;
+            const float  center   = ( begin + end ) * 0.5f;
+            const int    first    = static_cast<int>( std::floor( begin - radius ) );
+            const int    last     = static_cast<int>( std::ceil( end + radius ) ) - 1;
+            const size_t firstTap = kernel.Taps.size( );
+            float        total    = 0.0f;
+            for ( int j = first; j <= last; ++j )
+            {
+                const float weight = filter == TextureMipFilter::Box ? std::min( end, static_cast<float>( j + 1 ) ) - std::max( begin, static_cast<float>( j ) )
+                                                                     : Kaiser( ( static_cast<float>( j ) + 0.5f - center ) / scale );
+                if ( weight == 0.0f )
+                {
+                    continue;
+                }
+
+                const auto index = static_cast<uint32_t>( std::clamp( j, 0, static_cast<int>( sourceSize ) - 1 ) );
+                if ( kernel.Taps.size( ) > firstTap && kernel.Taps.back( ).Index == index )
+                {
+                    kernel.Taps.back( ).Weight += weight;
+                }
+                else
+                {
+                    kernel.Taps.push_back( { index, weight } );
+                }
+                total += weight;
+            }
+            for ( size_t t = firstTap; t < kernel.Taps.size( ); ++t )
+            {
+                kernel.Taps[ t ].Weight /= total;
+            }
+        }
+        kernel.Offsets.push_back( static_cast<uint32_t>( kernel.Taps.size( ) ) );
+        return kernel;
+    }
+
+    // destination = sum of taps weight * texel, one RGBA texel
+    void FilterTexel( const float *row, const FilterTap *taps, const uint32_t numTaps, float *destination )
+    {
+#if defined( DZ_MIP_GENERATOR_SSE2 )
+        __m128 sum = _mm_setzero_ps( );
+        for ( uint32_t t = 0; t < numTaps; ++t )
+        {
+            sum = _mm_add_ps( sum, _mm_mul_ps( _mm_loadu_ps( row + taps[ t ].Index * NumChannels ), _mm_set1_ps( taps[ t ].Weight ) ) );
+        }
+        _mm_storeu_ps( destination, sum );
+#elif defined( DZ_MIP_GENERATOR_NEON )
+        float32x4_t sum = vdupq_n_f32( 0.0f );
+        for ( uint32_t t = 0; t < numTaps; ++t )
+        {
+            sum = vmlaq_n_f32( sum, vld1q_f32( row + taps[ t ].Index * NumChannels ), taps[ t ].Weight );
+        }
+        vst1q_f32( destination, sum );
+#else
+        float sum[ NumChannels ]{ };
+        for ( uint32_t t = 0; t < numTaps; ++t )
+        {
+            for ( uint32_t c = 0; c < NumChannels; ++c )
+            {
+                sum[ c ] += row[ taps[ t ].Index * NumChannels + c ] * taps[ t ].Weight;
+            }
+        }
+        std::memcpy( destination, sum, sizeof( sum ) );
+#endif
+    }
+
+    // destination += weight * source over whole rows, numFloats is a multiple of 4
+    void MultiplyAdd( float *destination, const float *source, const float weight, const size_t numFloats )
+    {
+#if defined( DZ_MIP_GENERATOR_SSE2 )
+        const __m128 w = _mm_set1_ps( weight );
+        for ( size_t i = 0; i < numFloats; i += NumChannels )
+        {
+            _mm_storeu_ps( destination + i, _mm_add_ps( _mm_loadu_ps( destination + i ), _mm_mul_ps( _mm_loadu_ps( source + i ), w ) ) );
+        }
+#elif defined( DZ_MIP_GENERATOR_NEON )
+        for ( size_t i = 0; i < numFloats; i += NumChannels )
+        {
+            vst1q_f32( destination + i, vmlaq_n_f32( vld1q_f32( destination + i ), vld1q_f32( source + i ), weight ) );
+        }
+#else
+        for ( size_t i = 0; i < numFloats; ++i )
+        {
+            destination[ i ] += source[ i ] * weight;
+        }
+#endif
+    }
+
+    void DecodeRow( const Byte *source, float *destination, const uint32_t numTexels, const bool isSrgb )
+    {
+        const SrgbTables &tables = GetSrgbTables( );
+        for ( uint32_t i = 0; i < numTexels * NumChannels; i += NumChannels )
+        {
+            for ( uint32_t c = 0; c < 3; ++c )
+            {
+                destination[ i + c ] = isSrgb ? tables.ToLinear[ source[ i + c ] ] : static_cast<float>( source[ i + c ] ) / 255.0f;
+            }
+            destination[ i + 3 ] = static_cast<float>( source[ i + 3 ] ) / 255.0f;
+        }
+    }
+
+    uint8_t EncodeUNorm( const float value )
+    {
+        return static_cast<uint8_t>( std::lrintf( std::clamp( value, 0.0f, 1.0f ) * 255.0f ) );
+    }
+
+    void EncodeRow( const float *source, Byte *destination, const uint32_t numTexels, const bool isSrgb, const float alphaScale )
+    {
+        if ( isSrgb )
+        {
+            const SrgbTables &tables = GetSrgbTables( );
+            for ( uint32_t i = 0; i < numTexels * NumChannels; i += NumChannels )
+            {
+                for ( uint32_t c = 0; c < 3; ++c )
+                {
+                    destination[ i + c ] = tables.Encode( source[ i + c ] );
+                }
+                destination[ i + 3 ] = EncodeUNorm( source[ i + 3 ] * alphaScale );
+            }
+            return;
+        }
+
+#if defined( DZ_MIP_GENERATOR_SSE2 )
+        const __m128 scale = _mm_setr_ps( 255.0f, 255.0f, 255.0f, 255.0f * alphaScale );
+        for ( uint32_t i = 0; i < numTexels * NumChannels; i += NumChannels )
+        {
+            const __m128 clamped = _mm_min_ps( _mm_max_ps( _mm_mul_ps( _mm_loadu_ps( source + i ), scale ), _mm_setzero_ps( ) ), _mm_set1_ps( 255.0f ) );
+            __m128i      lanes   = _mm_cvtps_epi32( clamped );
+            lanes                = _mm_packs_epi32( lanes, lanes );
+            lanes                = _mm_packus_epi16( lanes, lanes );
+            const int packed     = _mm_cvtsi128_si32( lanes );
+            std::memcpy( destination + i, &packed, NumChannels );
+        }
+#elif defined( DZ_MIP_GENERATOR_NEON )
+        const float       scaleValues[ NumChannels ]{ 255.0f, 255.0f, 255.0f, 255.0f * alphaScale };
+        const float32x4_t scale = vld1q_f32( scaleValues );
+        for ( uint32_t i = 0; i < numTexels * NumChannels; i += NumChannels )
+        {
+            const float32x4_t clamped = vminq_f32( vmaxq_f32( vmulq_f32( vld1q_f32( source + i ), scale ), vdupq_n_f32( 0.0f ) ), vdupq_n_f32( 255.0f ) );
+            const uint16x4_t  narrow  = vmovn_u32( vcvtnq_u32_f32( clamped ) );
+            const uint32_t    packed  = vget_lane_u32( vreinterpret_u32_u8( vmovn_u16( vcombine_u16( narrow, narrow ) ) ), 0 );
+            std::memcpy( destination + i, &packed, NumChannels );
+        }
+#else
+        for ( uint32_t i = 0; i < numTexels * NumChannels; i += NumChannels )
+        {
+            for ( uint32_t c = 0; c < 3; ++c )
+            {
+                destination[ i + c ] = EncodeUNorm( source[ i + c ] );
+            }
+            destination[ i + 3 ] = EncodeUNorm( source[ i + 3 ] * alphaScale );
+        }
+#endif
+    }
+
+    // Fraction of texels passing an alpha test against reference once alpha is multiplied by scale
+    float AlphaCoverage( const float *texels, const size_t numTexels, const float reference, const float scale )
+    {
+        size_t numCovered = 0;
+        for ( size_t i = 0; i < numTexels; ++i )
+        {
+            numCovered += texels[ i * NumChannels + 3 ] * scale > reference ? 1 : 0;
+        }
+        return static_cast<float>( numCovered ) / static_cast<float>( numTexels );
+    }
+
+    // Coverage only grows with the scale, so the scale matching the source coverage is binary searched
+    float FindAlphaScale( const float *texels, const size_t numTexels, const float reference, const float targetCoverage )
+    {
+        float low       = 0.0f;
+        float high      = MaxAlphaScale;
+        float bestScale = 1.0f;
+        float bestError = std::abs( AlphaCoverage( texels, numTexels, reference, 1.0f ) - targetCoverage );
+        for ( uint32_t i = 0; i < AlphaScaleIterations && bestError > 0.0f; ++i )
+        {
+            const float scale    = ( low + high ) * 0.5f;
+            const float coverage = AlphaCoverage( texels, numTexels, reference, scale );
+            if ( const float error = std::abs( coverage - targetCoverage ); error < bestError )
+            {
+                bestError = error;
+                bestScale = scale;
+            }
+            if ( coverage < targetCoverage )
+            {
+                low = scale;
+            }
+            else
+            {
+                high = scale;
+            }
+        }
+        return bestScale;
+    }
+} // namespace
+
+uint32_t TextureMipGenerator::NumMipLevels( const uint32_t width, const uint32_t height )
+{
+    return static_cast<uint32_t>( std::bit_width( std::max( { width, height, 1u } ) ) );
+}
+
+bool TextureMipGenerator::Generate( const MipChainDesc &desc, MipChain &chain )
+{
+    chain = { };
+    if ( desc.Source == nullptr || desc.Width == 0 || desc.Height == 0 || desc.ArraySize == 0 )
+    {
+        spdlog::error( "TextureMipGenerator: Source image is empty" );
+        return false;
+    }
+
+    chain.MipLevels = NumMipLevels( desc.Width, desc.Height );
+    chain.Mips.resize( static_cast<size_t>( desc.ArraySize ) * chain.MipLevels );
+
+    size_t numBytes = 0;
+    for ( uint32_t slice = 0; slice < desc.ArraySize; ++slice )
+    {
+        for ( uint32_t mip = 0; mip < chain.MipLevels; ++mip )
+        {
+            TextureMip &mipInfo = chain.Mips[ slice * chain.MipLevels + mip ];
+            mipInfo.Width       = std::max( 1u, desc.Width >> mip );
+            mipInfo.Height      = std::max( 1u, desc.Height >> mip );
+            mipInfo.MipIndex    = mip;
+            mipInfo.ArrayIndex  = slice;
+            mipInfo.RowPitch    = mipInfo.Width * NumChannels;
+            mipInfo.NumRows     = mipInfo.Height;
+            mipInfo.SlicePitch  = mipInfo.RowPitch * mipInfo.NumRows;
+            mipInfo.DataOffset  = static_cast<uint32_t>( numBytes );
+            numBytes += mipInfo.SlicePitch;
+        }
+    }
+    chain.Data.resize( numBytes );
+
+    const size_t sourceSliceNumBytes = static_cast<size_t>( desc.Width ) * desc.Height * NumChannels;
+    for ( uint32_t slice = 0; slice < desc.ArraySize; ++slice )
+    {
+        std::memcpy( chain.Data.data( ) + chain.Mips[ slice * chain.MipLevels ].DataOffset, desc.Source + slice * sourceSliceNumBytes, sourceSliceNumBytes );
+    }
+
+    Level current;
+    current.Width  = desc.Width;
+    current.Height = desc.Height;
+    current.Texels.resize( desc.ArraySize * sourceSliceNumBytes );
+    ParallelFor(
+        desc.ArraySize * desc.Height,
+        [ & ]( const uint32_t row ) { DecodeRow( desc.Source + static_cast<size_t>( row ) * desc.Width * NumChannels, current.Row( row ), current.Width, desc.IsSrgb ); }, RowGrainSize );
+
+    std::vector<float> targetCoverages( desc.ArraySize, 0.0f );
+    std::vector<float> alphaScales( desc.ArraySize, 1.0f );
+    const size_t       sourceSliceNumTexels = static_cast<size_t>( desc.Width ) * desc.Height;
+    if ( desc.PreserveAlphaCoverage )
+    {
+        for ( uint32_t slice = 0; slice < desc.ArraySize; ++slice )
+        {
+            const float *texels      = current.Texels.data( ) + slice * sourceSliceNumTexels * NumChannels;
+            targetCoverages[ slice ] = AlphaCoverage( texels, sourceSliceNumTexels, desc.AlphaCoverageReference, 1.0f );
+        }
+    }
+
+    std::vector<float> horizontal; // Source rows filtered to the destination width
+    for ( uint32_t mip = 1; mip < chain.MipLevels; ++mip )
+    {
+        Level next;
+        next.Width  = std::max( 1u, current.Width >> 1 );
+        next.Height = std::max( 1u, current.Height >> 1 );
+
+        const FilterKernel horizontalKernel = BuildKernel( desc.Filter, current.Width, next.Width );
+        const FilterKernel verticalKernel   = BuildKernel( desc.Filter, current.Height, next.Height );
+
+        horizontal.resize( desc.ArraySize * current.Height * next.RowNumFloats( ) );
+        ParallelFor(
+            desc.ArraySize * current.Height,
+            [ & ]( const uint32_t row )
+            {
+                const float *source      = current.Row( row );
+                float       *destination = horizontal.data( ) + row * next.RowNumFloats( );
+                for ( uint32_t x = 0; x < next.Width; ++x )
+                {
+                    const uint32_t firstTap = horizontalKernel.Offsets[ x ];
+                    FilterTexel( source, horizontalKernel.Taps.data( ) + firstTap, horizontalKernel.Offsets[ x + 1 ] - firstTap, destination + x * NumChannels );
+                }
+            },
+            RowGrainSize );
+
+        next.Texels.assign( desc.ArraySize * next.Height * next.RowNumFloats( ), 0.0f );
+        ParallelFor(
+            desc.ArraySize * next.Height,
+            [ & ]( const uint32_t row )
+            {
+                const uint32_t slice = row / next.Height;
+                const uint32_t y     = row % next.Height;
+                for ( uint32_t t = verticalKernel.Offsets[ y ]; t < verticalKernel.Offsets[ y + 1 ]; ++t )
+                {
+                    const FilterTap &tap    = verticalKernel.Taps[ t ];
+                    const float     *source = horizontal.data( ) + ( static_cast<size_t>( slice ) * current.Height + tap.Index ) * next.RowNumFloats( );
+                    MultiplyAdd( next.Row( row ), source, tap.Weight, next.RowNumFloats( ) );
+                }
+            },
+            RowGrainSize );
+
+        // Scaled only when encoding, the next level is filtered from the unscaled alpha
+        if ( desc.PreserveAlphaCoverage )
+        {
+            const size_t sliceNumTexels = static_cast<size_t>( next.Width ) * next.Height;
+            ParallelFor( desc.ArraySize,
+                         [ & ]( const uint32_t slice )
+                         {
+                             const float *texels  = next.Texels.data( ) + slice * sliceNumTexels * NumChannels;
+                             alphaScales[ slice ] = FindAlphaScale( texels, sliceNumTexels, desc.AlphaCoverageReference, targetCoverages[ slice ] );
+                         } );
+        }
+
+        ParallelFor(
+            desc.ArraySize * next.Height,
+            [ & ]( const uint32_t row )
+            {
+                const uint32_t    slice   = row / next.Height;
+                const TextureMip &mipInfo = chain.Mips[ slice * chain.MipLevels + mip ];
+                Byte             *target  = chain.Data.data( ) + mipInfo.DataOffset + static_cast<size_t>( row % next.Height ) * mipInfo.RowPitch;
+                EncodeRow( next.Row( row ), target, next.Width, desc.IsSrgb, alphaScales[ slice ] );
+            },
+            RowGrainSize );
+
+        current = std::move( next );
+    }
+    return true;
+}
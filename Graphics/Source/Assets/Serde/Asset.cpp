@@ -17,6 +17,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Assets/Serde/Asset.h"
+#include <cstring>
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
 
 using namespace DenOfIz;
 
@@ -49,7 +51,18 @@ InteropString AssetUri::ToInteropString( ) const
 
 bool AssetUri::Equals( const AssetUri &other ) const
 {
-    return ToInteropString( ).Equals( other.ToInteropString( ) );
+    return Path.Equals( other.Path ) && Scheme.Equals( other.Scheme );
+}
+
+uint64_t AssetUri::Hash( ) const
+{
+    constexpr char separator[] = "://";
+    return Fnv1a( ).Append( Scheme.Get( ), Scheme.NumChars( ) ).Append( separator, sizeof( separator ) - 1 ).Append( Path.Get( ), Path.NumChars( ) ).Value( );
+}
+
+InternedString AssetUri::Intern( ) const
+{
+    return InternedString( ToInteropString( ) );
 }
 
 AssetUri AssetUri::Create( const InteropString &path )
@@ -18,12 +18,43 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphics/Assets/Serde/Mesh/MeshAssetReader.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "DenOfIzGraphics/Assets/Serde/Physics/PhysicsAsset.h"
 #include "DenOfIzGraphicsInternal/Assets/Serde/Common/AssetReaderHelpers.h"
+#include "DenOfIzGraphicsInternal/Assets/Serde/Mesh/VertexFormatConverter.h"
 #include "DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
 using namespace DenOfIz;
+
+namespace
+{
+    uint32_t NumColorComponents( const ColorFormat format )
+    {
+        switch ( format )
+        {
+        case ColorFormat::RGBA:
+            return 4;
+        case ColorFormat::RGB:
+            return 3;
+        case ColorFormat::RG:
+            return 2;
+        case ColorFormat::R:
+            return 1;
+        }
+        return 0;
+    }
+
+    struct AttributeDecode
+    {
+        VertexConversionDesc Conversion{ };
+        uint32_t             SourceOffset = 0;
+        bool                 IsUInt       = false;
+    };
+} // namespace
+
 MeshAssetReader::MeshAssetReader( const MeshAssetReaderDesc &desc ) : m_reader( desc.Reader ), m_desc( desc ), m_metadataRead( false )
 {
     if ( !m_reader )
@@ -246,6 +277,67 @@ MeshVertex MeshAssetReader::ReadSingleVertex( ) const
     return vertex;
 }
 
+bool MeshAssetReader::FindVertexAttribute( const VertexAttributeSemantic semantic, const uint32_t semanticIndex, VertexAttributeSource &source ) const
+{
+    const auto &attributes = m_meshAsset->EnabledAttributes;
+    const auto &config     = m_meshAsset->AttributeConfig;
+
+    // Walks the attributes in the same order ReadSingleVertex reads them
+    uint32_t   offset = 0;
+    const auto found  = [ & ]( const uint32_t numComponents, const bool isUInt )
+    {
+        source.Offset        = offset;
+        source.NumComponents = numComponents;
+        source.IsUInt        = isUInt;
+        return true;
+    };
+    const auto fixedAttribute = [ & ]( const bool enabled, const VertexAttributeSemantic attributeSemantic, const uint32_t numComponents, const bool isUInt )
+    {
+        if ( !enabled )
+        {
+            return false;
+        }
+        if ( semantic == attributeSemantic && semanticIndex == 0 )
+        {
+            return found( numComponents, isUInt );
+        }
+        offset += numComponents * sizeof( float );
+        return false;
+    };
+
+    source = { };
+    if ( fixedAttribute( attributes.Position, VertexAttributeSemantic::Position, 4, false ) || fixedAttribute( attributes.Normal, VertexAttributeSemantic::Normal, 4, false ) )
+    {
+        return true;
+    }
+    if ( attributes.UV )
+    {
+        if ( semantic == VertexAttributeSemantic::UV && semanticIndex < config.NumUVAttributes )
+        {
+            offset += semanticIndex * 2 * sizeof( float );
+            return found( 2, false );
+        }
+        offset += config.NumUVAttributes * 2 * sizeof( float );
+    }
+    if ( attributes.Color )
+    {
+        for ( uint32_t i = 0; i < config.ColorFormats.NumElements; ++i )
+        {
+            const uint32_t numComponents = NumColorComponents( config.ColorFormats.Elements[ i ] );
+            if ( semantic == VertexAttributeSemantic::Color && semanticIndex == i )
+            {
+                source.Defaults.W = 1.0f;
+                return found( numComponents, false );
+            }
+            offset += numComponents * sizeof( float );
+        }
+    }
+    return fixedAttribute( attributes.Tangent, VertexAttributeSemantic::Tangent, 4, false ) ||
+           fixedAttribute( attributes.Bitangent, VertexAttributeSemantic::Bitangent, 4, false ) ||
+           fixedAttribute( attributes.BlendIndices, VertexAttributeSemantic::BlendIndices, config.MaxBoneInfluences, true ) ||
+           fixedAttribute( attributes.BlendWeights, VertexAttributeSemantic::BlendWeights, config.MaxBoneInfluences, false );
+}
+
 MorphTargetDelta MeshAssetReader::ReadSingleMorphTargetDelta( ) const
 {
     MorphTargetDelta delta{ };
@@ -438,6 +530,104 @@ void MeshAssetReader::ReadVertices( const AssetDataStream &stream, const MeshVer
     }
 }
 
+uint64_t MeshAssetReader::DecodeVertices( const DecodeVerticesDesc &desc ) const
+{
+    if ( !m_metadataRead )
+    {
+        spdlog::critical( "ReadMetadata must be called first." );
+        return 0;
+    }
+    const uint32_t vertexSize = VertexEntryNumBytes( );
+    if ( vertexSize == 0 || desc.Stream.NumBytes == 0 )
+    {
+        return 0;
+    }
+    const uint64_t numVertices = NumVertices( desc.Stream );
+    if ( numVertices == 0 )
+    {
+        return 0;
+    }
+
+    std::vector<AttributeDecode> decodes( desc.Attributes.NumElements );
+    for ( size_t i = 0; i < desc.Attributes.NumElements; ++i )
+    {
+        const VertexAttributeLayoutDesc &attribute = desc.Attributes.Elements[ i ];
+        VertexAttributeSource            source;
+        if ( !FindVertexAttribute( attribute.Semantic, attribute.SemanticIndex, source ) )
+        {
+            spdlog::error( "Vertex attribute {}[{}] is not present in mesh {}", static_cast<uint32_t>( attribute.Semantic ), attribute.SemanticIndex, m_meshAsset->Name.Get( ) );
+            return 0;
+        }
+        const bool formatSupported =
+            source.IsUInt ? VertexFormatConverter::IsUIntFormatSupported( attribute.Format ) : VertexFormatConverter::IsFloatFormatSupported( attribute.Format );
+        if ( !formatSupported )
+        {
+            spdlog::error( "Format {} is not supported for vertex attribute {}[{}]", static_cast<uint32_t>( attribute.Format ), static_cast<uint32_t>( attribute.Semantic ),
+                           attribute.SemanticIndex );
+            return 0;
+        }
+        if ( attribute.TargetIndex >= desc.Targets.NumElements )
+        {
+            spdlog::error( "Vertex attribute {}[{}] refers to missing target {}", static_cast<uint32_t>( attribute.Semantic ), attribute.SemanticIndex, attribute.TargetIndex );
+            return 0;
+        }
+        const VertexDecodeTarget &target    = desc.Targets.Elements[ attribute.TargetIndex ];
+        const uint32_t            numBytes  = FormatNumBytes( attribute.Format );
+        const uint64_t            lastBytes = ( numVertices - 1 ) * target.Stride + attribute.Offset + numBytes;
+        if ( target.Memory.Elements == nullptr || target.Stride < numBytes || target.Memory.NumElements < lastBytes )
+        {
+            spdlog::error( "Vertex decode target {} is too small, it needs a stride of at least {} and {} bytes", attribute.TargetIndex, numBytes, lastBytes );
+            return 0;
+        }
+
+        AttributeDecode &decode               = decodes[ i ];
+        decode.Conversion.SourceStride        = vertexSize;
+        decode.Conversion.NumSourceComponents = source.NumComponents;
+        decode.Conversion.Defaults            = source.Defaults;
+        decode.Conversion.Destination         = target.Memory.Elements + attribute.Offset;
+        decode.Conversion.DestinationStride   = target.Stride;
+        decode.Conversion.Format              = attribute.Format;
+        decode.SourceOffset                   = source.Offset;
+        decode.IsUInt                         = source.IsUInt;
+    }
+
+    // Read the stream in blocks so the raw vertices stay in cache while every attribute is converted out of them
+    constexpr uint64_t blockNumVertices = 256;
+    std::vector<Byte>  block( std::min( blockNumVertices, numVertices ) * vertexSize );
+    m_reader->Seek( desc.Stream.Offset );
+    for ( uint64_t first = 0; first < numVertices; first += blockNumVertices )
+    {
+        const uint64_t count = std::min( blockNumVertices, numVertices - first );
+        if ( !m_reader->ReadArray( block.data( ), count * vertexSize ) )
+        {
+            spdlog::error( "Failed to read vertex stream at offset {}", desc.Stream.Offset );
+            return first;
+        }
+        for ( const AttributeDecode &decode : decodes )
+        {
+            VertexConversionDesc conversion = decode.Conversion;
+            conversion.Source               = block.data( ) + decode.SourceOffset;
+            conversion.Destination          = decode.Conversion.Destination + first * conversion.DestinationStride;
+            conversion.NumVertices          = count;
+            if ( decode.IsUInt )
+            {
+                // Bone indices past the format's range would silently skin to the wrong bone
+                if ( !VertexFormatConverter::ConvertUInt( conversion ) )
+                {
+                    spdlog::error( "Blend indices of mesh {} don't fit format {}, use a wider index format", m_meshAsset->Name.Get( ),
+                                   static_cast<uint32_t>( conversion.Format ) );
+                    return first;
+                }
+            }
+            else
+            {
+                VertexFormatConverter::ConvertFloat( conversion );
+            }
+        }
+    }
+    return numVertices;
+}
+
 void MeshAssetReader::ReadIndices16( const AssetDataStream &stream, const UInt16Array &result ) const
 {
     if ( !m_metadataRead )
@@ -453,11 +643,12 @@ void MeshAssetReader::ReadIndices16( const AssetDataStream &stream, const UInt16
     if ( result.NumElements < numIndices )
     {
         spdlog::critical( "Destination memory array is too small, allocate at least NumIndices16( ) amount of elements" );
+        return;
     }
     m_reader->Seek( stream.Offset );
-    for ( uint64_t i = 0; i < numIndices; ++i )
+    if ( !m_reader->ReadArray( result.Elements, numIndices ) )
     {
-        result.Elements[ i ] = m_reader->ReadUInt16( );
+        spdlog::error( "Failed to read index stream at offset {}", stream.Offset );
     }
 }
 
@@ -483,9 +674,9 @@ void MeshAssetReader::ReadIndices32( const AssetDataStream &stream, const UInt32
         return;
     }
     m_reader->Seek( stream.Offset );
-    for ( uint64_t i = 0; i < numIndices; ++i )
+    if ( !m_reader->ReadArray( result.Elements, numIndices ) )
     {
-        result.Elements[ i ] = m_reader->ReadUInt32( );
+        spdlog::error( "Failed to read index stream at offset {}", stream.Offset );
     }
 }
 
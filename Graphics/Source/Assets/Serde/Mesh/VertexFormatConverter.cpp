@@ -0,0 +1,377 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphicsInternal/Assets/Serde/Mesh/VertexFormatConverter.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define DZ_VERTEX_CONVERT_SSE2
+#include <emmintrin.h>
+#if defined( __F16C__ ) || defined( __AVX2__ )
+#define DZ_VERTEX_CONVERT_F16C
+#include <immintrin.h>
+#endif
+#elif defined( __aarch64__ ) || defined( _M_ARM64 )
+#define DZ_VERTEX_CONVERT_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace DenOfIz;
+
+namespace
+{
+    enum class PackKind
+    {
+        Float32,
+        Float16,
+        UNorm8,
+        SNorm8,
+        UNorm16,
+        SNorm16
+    };
+
+    struct PackInfo
+    {
+        PackKind Kind          = PackKind::Float32;
+        uint32_t NumComponents = 0;
+    };
+
+    bool GetPackInfo( const Format format, PackInfo &info )
+    {
+        switch ( format )
+        {
+        case Format::R32G32B32A32Float:
+            info = { PackKind::Float32, 4 };
+            return true;
+        case Format::R32G32B32Float:
+            info = { PackKind::Float32, 3 };
+            return true;
+        case Format::R32G32Float:
+            info = { PackKind::Float32, 2 };
+            return true;
+        case Format::R32Float:
+            info = { PackKind::Float32, 1 };
+            return true;
+        case Format::R16G16B16A16Float:
+            info = { PackKind::Float16, 4 };
+            return true;
+        case Format::R16G16Float:
+            info = { PackKind::Float16, 2 };
+            return true;
+        case Format::R16G16B16A16Unorm:
+            info = { PackKind::UNorm16, 4 };
+            return true;
+        case Format::R16G16Unorm:
+            info = { PackKind::UNorm16, 2 };
+            return true;
+        case Format::R16G16B16A16Snorm:
+            info = { PackKind::SNorm16, 4 };
+            return true;
+        case Format::R16G16Snorm:
+            info = { PackKind::SNorm16, 2 };
+            return true;
+        case Format::R8G8B8A8Unorm:
+            info = { PackKind::UNorm8, 4 };
+            return true;
+        case Format::R8G8Unorm:
+            info = { PackKind::UNorm8, 2 };
+            return true;
+        case Format::R8G8B8A8Snorm:
+            info = { PackKind::SNorm8, 4 };
+            return true;
+        case Format::R8G8Snorm:
+            info = { PackKind::SNorm8, 2 };
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Round to nearest even, handles denormals, infinities and NaN
+    uint16_t FloatToHalf( const float value )
+    {
+        constexpr uint32_t f32Infinity   = 255u << 23;
+        constexpr uint32_t f16Max        = ( 127u + 16u ) << 23;
+        constexpr uint32_t denormMagic   = ( ( 127u - 15u ) + ( 23u - 10u ) + 1u ) << 23;
+        constexpr uint32_t minNormalHalf = 113u << 23;
+        uint32_t           bits          = std::bit_cast<uint32_t>( value );
+        const uint32_t     sign          = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint32_t result;
+        if ( bits >= f16Max )
+        {
+            result = bits > f32Infinity ? 0x7E00u : 0x7C00u;
+        }
+        else if ( bits < minNormalHalf )
+        {
+            const float denormal = std::bit_cast<float>( bits ) + std::bit_cast<float>( denormMagic );
+            result               = std::bit_cast<uint32_t>( denormal ) - denormMagic;
+        }
+        else
+        {
+            const uint32_t mantissaOdd = bits >> 13 & 1u;
+            bits -= ( 127u - 15u ) << 23;
+            bits += 0xFFFu + mantissaOdd;
+            result = bits >> 13;
+        }
+        return static_cast<uint16_t>( result | sign >> 16 );
+    }
+
+#if !defined( DZ_VERTEX_CONVERT_SSE2 ) && !defined( DZ_VERTEX_CONVERT_NEON )
+    int32_t RoundScaled( const float value, const float low, const float high, const float scale )
+    {
+        return static_cast<int32_t>( std::lrintf( std::clamp( value, low, high ) * scale ) );
+    }
+#endif
+
+    template <PackKind Kind>
+    uint64_t PackVector( const float *v )
+    {
+        uint64_t packed = 0;
+#if defined( DZ_VERTEX_CONVERT_SSE2 )
+        const __m128 value = _mm_loadu_ps( v );
+        __m128i      lanes{ };
+        if constexpr ( Kind == PackKind::Float16 )
+        {
+#if defined( DZ_VERTEX_CONVERT_F16C )
+            lanes = _mm_cvtps_ph( value, _MM_FROUND_TO_NEAREST_INT );
+#else
+            for ( uint32_t i = 0; i < 4; ++i )
+            {
+                packed |= static_cast<uint64_t>( FloatToHalf( v[ i ] ) ) << i * 16;
+            }
+            return packed;
+#endif
+        }
+        else if constexpr ( Kind == PackKind::UNorm8 || Kind == PackKind::UNorm16 )
+        {
+            constexpr float scale   = Kind == PackKind::UNorm8 ? 255.0f : 65535.0f;
+            const __m128    clamped = _mm_min_ps( _mm_max_ps( value, _mm_setzero_ps( ) ), _mm_set1_ps( 1.0f ) );
+            lanes                   = _mm_cvtps_epi32( _mm_mul_ps( clamped, _mm_set1_ps( scale ) ) );
+            if constexpr ( Kind == PackKind::UNorm8 )
+            {
+                lanes = _mm_packs_epi32( lanes, lanes );
+                lanes = _mm_packus_epi16( lanes, lanes );
+            }
+            else
+            {
+                // SSE2 has no unsigned 32 -> 16 bit pack, bias into the signed range and flip the top bit back
+                lanes = _mm_packs_epi32( _mm_sub_epi32( lanes, _mm_set1_epi32( 32768 ) ), _mm_setzero_si128( ) );
+                lanes = _mm_xor_si128( lanes, _mm_set1_epi16( static_cast<short>( 0x8000 ) ) );
+            }
+        }
+        else if constexpr ( Kind == PackKind::SNorm8 || Kind == PackKind::SNorm16 )
+        {
+            constexpr float scale   = Kind == PackKind::SNorm8 ? 127.0f : 32767.0f;
+            const __m128    clamped = _mm_min_ps( _mm_max_ps( value, _mm_set1_ps( -1.0f ) ), _mm_set1_ps( 1.0f ) );
+            lanes                   = _mm_packs_epi32( _mm_cvtps_epi32( _mm_mul_ps( clamped, _mm_set1_ps( scale ) ) ), _mm_setzero_si128( ) );
+            if constexpr ( Kind == PackKind::SNorm8 )
+            {
+                lanes = _mm_packs_epi16( lanes, lanes );
+            }
+        }
+        _mm_storel_epi64( reinterpret_cast<__m128i *>( &packed ), lanes );
+#elif defined( DZ_VERTEX_CONVERT_NEON )
+        const float32x4_t value = vld1q_f32( v );
+        if constexpr ( Kind == PackKind::Float16 )
+        {
+            packed = vget_lane_u64( vreinterpret_u64_f16( vcvt_f16_f32( value ) ), 0 );
+        }
+        else if constexpr ( Kind == PackKind::UNorm8 || Kind == PackKind::UNorm16 )
+        {
+            constexpr float   scale   = Kind == PackKind::UNorm8 ? 255.0f : 65535.0f;
+            const float32x4_t clamped = vminq_f32( vmaxq_f32( value, vdupq_n_f32( 0.0f ) ), vdupq_n_f32( 1.0f ) );
+            const int32x4_t   lanes   = vcvtnq_s32_f32( vmulq_n_f32( clamped, scale ) );
+            if constexpr ( Kind == PackKind::UNorm8 )
+            {
+                const int16x4_t narrow = vqmovn_s32( lanes );
+                packed                 = vget_lane_u32( vreinterpret_u32_u8( vqmovun_s16( vcombine_s16( narrow, narrow ) ) ), 0 );
+            }
+            else
+            {
+                packed = vget_lane_u64( vreinterpret_u64_u16( vqmovun_s32( lanes ) ), 0 );
+            }
+        }
+        else if constexpr ( Kind == PackKind::SNorm8 || Kind == PackKind::SNorm16 )
+        {
+            constexpr float   scale   = Kind == PackKind::SNorm8 ? 127.0f : 32767.0f;
+            const float32x4_t clamped = vminq_f32( vmaxq_f32( value, vdupq_n_f32( -1.0f ) ), vdupq_n_f32( 1.0f ) );
+            const int16x4_t   narrow  = vqmovn_s32( vcvtnq_s32_f32( vmulq_n_f32( clamped, scale ) ) );
+            if constexpr ( Kind == PackKind::SNorm8 )
+            {
+                packed = vget_lane_u32( vreinterpret_u32_s8( vqmovn_s16( vcombine_s16( narrow, narrow ) ) ), 0 );
+            }
+            else
+            {
+                packed = vget_lane_u64( vreinterpret_u64_s16( narrow ), 0 );
+            }
+        }
+#else
+        for ( uint32_t i = 0; i < 4; ++i )
+        {
+            switch ( Kind )
+            {
+            case PackKind::Float16:
+                packed |= static_cast<uint64_t>( FloatToHalf( v[ i ] ) ) << i * 16;
+                break;
+            case PackKind::UNorm8:
+                packed |= static_cast<uint64_t>( RoundScaled( v[ i ], 0.0f, 1.0f, 255.0f ) ) << i * 8;
+                break;
+            case PackKind::SNorm8:
+                packed |= static_cast<uint64_t>( static_cast<uint8_t>( RoundScaled( v[ i ], -1.0f, 1.0f, 127.0f ) ) ) << i * 8;
+                break;
+            case PackKind::UNorm16:
+                packed |= static_cast<uint64_t>( RoundScaled( v[ i ], 0.0f, 1.0f, 65535.0f ) ) << i * 16;
+                break;
+            case PackKind::SNorm16:
+                packed |= static_cast<uint64_t>( static_cast<uint16_t>( RoundScaled( v[ i ], -1.0f, 1.0f, 32767.0f ) ) ) << i * 16;
+                break;
+            default:
+                break;
+            }
+        }
+#endif
+        return packed;
+    }
+
+    template <PackKind Kind>
+    void PackRows( const float *rows, const size_t count, Byte *destination, const uint32_t stride, const uint32_t numBytes )
+    {
+        for ( size_t i = 0; i < count; ++i )
+        {
+            const uint64_t packed = PackVector<Kind>( rows + i * 4 );
+            std::memcpy( destination + i * stride, &packed, numBytes );
+        }
+    }
+} // namespace
+
+bool VertexFormatConverter::IsFloatFormatSupported( const Format format )
+{
+    PackInfo info;
+    return GetPackInfo( format, info );
+}
+
+bool VertexFormatConverter::IsUIntFormatSupported( const Format format )
+{
+    return format == Format::R32G32B32A32Uint || format == Format::R16G16B16A16Uint || format == Format::R8G8B8A8Uint;
+}
+
+void VertexFormatConverter::ConvertFloat( const VertexConversionDesc &desc )
+{
+    PackInfo info;
+    if ( !GetPackInfo( desc.Format, info ) )
+    {
+        return;
+    }
+
+    const uint32_t numBytes = FormatNumBytes( desc.Format );
+    if ( info.Kind == PackKind::Float32 && desc.NumSourceComponents >= info.NumComponents )
+    {
+        for ( size_t i = 0; i < desc.NumVertices; ++i )
+        {
+            std::memcpy( desc.Destination + i * desc.DestinationStride, desc.Source + i * desc.SourceStride, numBytes );
+        }
+        return;
+    }
+
+    constexpr size_t    blockSize = 64;
+    alignas( 16 ) float rows[ blockSize * 4 ];
+    const uint32_t      numSourceBytes = std::min( desc.NumSourceComponents, 4u ) * sizeof( float );
+    for ( size_t first = 0; first < desc.NumVertices; first += blockSize )
+    {
+        const size_t count = std::min( blockSize, desc.NumVertices - first );
+        for ( size_t i = 0; i < count; ++i )
+        {
+            float *row = rows + i * 4;
+            std::memcpy( row, &desc.Defaults, sizeof( Float_4 ) );
+            std::memcpy( row, desc.Source + ( first + i ) * desc.SourceStride, numSourceBytes );
+        }
+
+        Byte *destination = desc.Destination + first * desc.DestinationStride;
+        switch ( info.Kind )
+        {
+        case PackKind::Float32:
+            for ( size_t i = 0; i < count; ++i )
+            {
+                std::memcpy( destination + i * desc.DestinationStride, rows + i * 4, numBytes );
+            }
+            break;
+        case PackKind::Float16:
+            PackRows<PackKind::Float16>( rows, count, destination, desc.DestinationStride, numBytes );
+            break;
+        case PackKind::UNorm8:
+            PackRows<PackKind::UNorm8>( rows, count, destination, desc.DestinationStride, numBytes );
+            break;
+        case PackKind::SNorm8:
+            PackRows<PackKind::SNorm8>( rows, count, destination, desc.DestinationStride, numBytes );
+            break;
+        case PackKind::UNorm16:
+            PackRows<PackKind::UNorm16>( rows, count, destination, desc.DestinationStride, numBytes );
+            break;
+        case PackKind::SNorm16:
+            PackRows<PackKind::SNorm16>( rows, count, destination, desc.DestinationStride, numBytes );
+            break;
+        }
+    }
+}
+
+bool VertexFormatConverter::ConvertUInt( const VertexConversionDesc &desc )
+{
+    if ( !IsUIntFormatSupported( desc.Format ) )
+    {
+        return false;
+    }
+
+    const uint32_t numComponents  = std::min( desc.NumSourceComponents, 4u );
+    const uint32_t formatMaxValue = desc.Format == Format::R16G16B16A16Uint ? UINT16_MAX : desc.Format == Format::R8G8B8A8Uint ? UINT8_MAX : UINT32_MAX;
+    uint32_t       maxValue       = 0;
+    for ( size_t i = 0; i < desc.NumVertices; ++i )
+    {
+        uint32_t values[ 4 ] = { };
+        std::memcpy( values, desc.Source + i * desc.SourceStride, numComponents * sizeof( uint32_t ) );
+
+        Byte *destination = desc.Destination + i * desc.DestinationStride;
+        switch ( desc.Format )
+        {
+        case Format::R32G32B32A32Uint:
+            std::memcpy( destination, values, sizeof( values ) );
+            break;
+        case Format::R16G16B16A16Uint:
+            for ( uint32_t c = 0; c < 4; ++c )
+            {
+                maxValue             = std::max( maxValue, values[ c ] );
+                const uint16_t value = static_cast<uint16_t>( std::min<uint32_t>( values[ c ], UINT16_MAX ) );
+                std::memcpy( destination + c * sizeof( uint16_t ), &value, sizeof( uint16_t ) );
+            }
+            break;
+        default:
+            for ( uint32_t c = 0; c < 4; ++c )
+            {
+                maxValue         = std::max( maxValue, values[ c ] );
+                destination[ c ] = static_cast<Byte>( std::min<uint32_t>( values[ c ], UINT8_MAX ) );
+            }
+            break;
+        }
+    }
+    return maxValue <= formatMaxValue;
+}
@@ -21,18 +21,24 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
-#ifdef _WIN32
-#include <wrl/client.h>
-#include "DenOfIzGraphics/Utilities/Common_Windows.h"
-#else
-#define __EMULATE_UUID
-#include "WinAdapter.h"
-#endif
-
-#include "dxcapi.h"
-
 using namespace DenOfIz;
 
+namespace
+{
+    // Compiled shaders own their blobs and free them, the asset keeps its own copy
+    ByteArray CopyBlob( const ByteArray &blob )
+    {
+        ByteArray copy{ nullptr, 0 };
+        if ( blob.NumElements > 0 )
+        {
+            copy.Elements    = static_cast<Byte *>( std::malloc( blob.NumElements ) );
+            copy.NumElements = blob.NumElements;
+            std::memcpy( copy.Elements, blob.Elements, blob.NumElements );
+        }
+        return copy;
+    }
+} // namespace
+
 ShaderAssetReader::ShaderAssetReader( const ShaderAssetReaderDesc &desc ) : m_reader( desc.Reader )
 {
     DZ_NOT_NULL( m_reader );
@@ -283,14 +289,6 @@ CompiledShader ShaderAssetReader::ConvertToCompiledShader( const ShaderAsset &sh
     compiledShader.Stages.NumElements = numStages;
     compiledShader.Stages.Elements    = static_cast<CompiledShaderStage **>( std::malloc( numStages * sizeof( CompiledShaderStage * ) ) );
 
-    IDxcLibrary  *dxcLibrary = nullptr;
-    const HRESULT result     = DxcCreateInstance( CLSID_DxcLibrary, IID_PPV_ARGS( &dxcLibrary ) );
-    if ( FAILED( result ) || !dxcLibrary )
-    {
-        spdlog::error( "Failed to create DXC library for blob conversion" );
-        return compiledShader;
-    }
-
     for ( uint32_t i = 0; i < numStages; ++i )
     {
         const ShaderStageAsset &stageAsset = shaderAsset.Stages.Elements[ i ];
@@ -302,58 +300,10 @@ CompiledShader ShaderAssetReader::ConvertToCompiledShader( const ShaderAsset &sh
         compiledStage->EntryPoint = stageAsset.EntryPoint;
         compiledStage->RayTracing = stageAsset.RayTracing;
 
-        if ( stageAsset.DXIL.NumElements > 0 )
-        {
-            IDxcBlobEncoding *blob = nullptr;
-            if ( SUCCEEDED( dxcLibrary->CreateBlobWithEncodingOnHeapCopy( stageAsset.DXIL.Elements, stageAsset.DXIL.NumElements, DXC_CP_ACP, &blob ) ) )
-            {
-                compiledStage->DXIL.Elements    = static_cast<Byte *>( std::malloc( blob->GetBufferSize( ) ) );
-                compiledStage->DXIL.NumElements = blob->GetBufferSize( );
-                std::memcpy( compiledStage->DXIL.Elements, blob->GetBufferPointer( ), blob->GetBufferSize( ) );
-                blob->Release( );
-            }
-        }
-
-        if ( stageAsset.MSL.NumElements > 0 )
-        {
-            IDxcBlobEncoding *blob = nullptr;
-            if ( SUCCEEDED( dxcLibrary->CreateBlobWithEncodingOnHeapCopy( stageAsset.MSL.Elements, stageAsset.MSL.NumElements, DXC_CP_ACP, &blob ) ) )
-            {
-                compiledStage->MSL.Elements    = static_cast<Byte *>( std::malloc( blob->GetBufferSize( ) ) );
-                compiledStage->MSL.NumElements = blob->GetBufferSize( );
-                std::memcpy( compiledStage->MSL.Elements, blob->GetBufferPointer( ), blob->GetBufferSize( ) );
-                blob->Release( );
-            }
-        }
-
-        if ( stageAsset.SPIRV.NumElements > 0 )
-        {
-            IDxcBlobEncoding *blob = nullptr;
-            if ( SUCCEEDED( dxcLibrary->CreateBlobWithEncodingOnHeapCopy( stageAsset.SPIRV.Elements, stageAsset.SPIRV.NumElements, DXC_CP_ACP, &blob ) ) )
-            {
-                compiledStage->SPIRV.Elements    = static_cast<Byte *>( std::malloc( blob->GetBufferSize( ) ) );
-                compiledStage->SPIRV.NumElements = blob->GetBufferSize( );
-                std::memcpy( compiledStage->SPIRV.Elements, blob->GetBufferPointer( ), blob->GetBufferSize( ) );
-                blob->Release( );
-            }
-        }
-
-        if ( stageAsset.Reflection.NumElements > 0 )
-        {
-            IDxcBlobEncoding *blob = nullptr;
-            if ( SUCCEEDED( dxcLibrary->CreateBlobWithEncodingOnHeapCopy( stageAsset.Reflection.Elements, stageAsset.Reflection.NumElements, DXC_CP_ACP, &blob ) ) )
-            {
-                compiledStage->Reflection.Elements    = static_cast<Byte *>( std::malloc( blob->GetBufferSize( ) ) );
-                compiledStage->Reflection.NumElements = blob->GetBufferSize( );
-                std::memcpy( compiledStage->Reflection.Elements, blob->GetBufferPointer( ), blob->GetBufferSize( ) );
-                blob->Release( );
-            }
-        }
-    }
-
-    if ( dxcLibrary )
-    {
-        dxcLibrary->Release( );
+        compiledStage->DXIL       = CopyBlob( stageAsset.DXIL );
+        compiledStage->MSL        = CopyBlob( stageAsset.MSL );
+        compiledStage->SPIRV      = CopyBlob( stageAsset.SPIRV );
+        compiledStage->Reflection = CopyBlob( stageAsset.Reflection );
     }
 
     return compiledShader;
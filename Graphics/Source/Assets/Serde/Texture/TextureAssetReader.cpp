@@ -134,63 +134,112 @@ void TextureAssetReader::LoadIntoGpuTexture( const LoadIntoGpuTextureDesc &desc
         spdlog::critical( "CommandList and Texture are required for LoadIntoGpuTexture" );
         return;
     }
+    LoadMips( desc, true, true );
+}
 
-    constexpr uint32_t batchSize = 1024;
-    std::vector<Byte>  buffer( batchSize );
-    const ByteArray    bufferArray{ buffer.data( ), buffer.size( ) };
+void TextureAssetReader::ReadIntoStagingBuffer( const LoadIntoGpuTextureDesc &desc ) const
+{
+    if ( !desc.StagingBuffer )
+    {
+        spdlog::critical( "StagingBuffer is required for ReadIntoStagingBuffer" );
+        return;
+    }
+    LoadMips( desc, true, false );
+}
 
-    const auto stagingBuffer  = desc.StagingBuffer;
-    uint64_t   remainingBytes = std::min<uint64_t>( desc.StagingBuffer->NumBytes( ), m_textureAsset->Data.NumBytes );
-    auto       mappedMemory   = static_cast<Byte *>( stagingBuffer->MapMemory( ) );
+void TextureAssetReader::RecordGpuTextureCopies( const LoadIntoGpuTextureDesc &desc ) const
+{
+    if ( !desc.CommandList || !desc.Texture )
+    {
+        spdlog::critical( "CommandList and Texture are required for RecordGpuTextureCopies" );
+        return;
+    }
+    LoadMips( desc, false, true );
+}
+
+void TextureAssetReader::LoadMips( const LoadIntoGpuTextureDesc &desc, const bool readMips, const bool recordCopies ) const
+{
+    // Zero alignments keep the mips packed like they are stored
+    const uint32_t rowAlignment   = std::max( 1u, desc.Constants.BufferTextureRowAlignment );
+    const uint32_t sliceAlignment = std::max( 1u, desc.Constants.BufferTextureAlignment );
 
-    m_reader->Seek( m_textureAsset->Data.Offset );
-    while ( remainingBytes > 0 )
+    const auto stagingBuffer = desc.StagingBuffer;
+    Byte      *mappedMemory  = desc.MappedStagingBuffer;
+    if ( readMips && mappedMemory == nullptr )
+    {
+        mappedMemory = static_cast<Byte *>( stagingBuffer->MapMemory( ) );
+    }
+    uint64_t stagingOffset = desc.StagingBufferOffset;
+    for ( uint32_t i = 0; i < m_textureAsset->Mips.NumElements; ++i )
     {
-        const uint32_t bytesToRead = static_cast<uint32_t>( std::min( static_cast<uint64_t>( batchSize ), remainingBytes ) );
-        const uint32_t bytesRead   = m_reader->Read( bufferArray, 0, bytesToRead );
+        const TextureMip mip = m_textureAsset->Mips.Elements[ i ];
+        if ( mip.MipIndex < desc.FirstMip )
+        {
+            continue;
+        }
 
-        if ( bytesRead != bytesToRead )
+        const uint32_t alignedRowPitch   = Utilities::Align( mip.RowPitch, rowAlignment );
+        const uint32_t alignedSlicePitch = Utilities::Align( alignedRowPitch * mip.NumRows, sliceAlignment );
+        if ( stagingOffset + alignedSlicePitch > stagingBuffer->NumBytes( ) )
         {
-            spdlog::error( "Failed to read expected number of bytes. Expected: {} , Read: {}", bytesToRead, bytesRead );
+            spdlog::error( "Staging buffer is too small for mip {} array layer {}, use AlignedTotalNumBytes to size it", mip.MipIndex, mip.ArrayIndex );
             break;
         }
 
-        memcpy( mappedMemory, buffer.data( ), bytesRead );
-        mappedMemory += bytesRead;
-        remainingBytes -= bytesRead;
-    }
+        // Rows are read straight into the staging buffer at the pitch the copy expects
+        const uint32_t numRowsPerRead = alignedRowPitch == mip.RowPitch ? mip.NumRows : 1;
+        if ( readMips )
+        {
+            m_reader->Seek( m_textureAsset->Data.Offset + mip.DataOffset );
+        }
+        for ( uint32_t row = 0; readMips && row < mip.NumRows; row += numRowsPerRead )
+        {
+            const uint32_t  numBytes = mip.RowPitch * numRowsPerRead;
+            const ByteArray rows{ mappedMemory + stagingOffset + static_cast<uint64_t>( row ) * alignedRowPitch, numBytes };
+            if ( const int bytesRead = m_reader->Read( rows, 0, numBytes ); bytesRead != static_cast<int>( numBytes ) )
+            {
+                spdlog::error( "Failed to read expected number of bytes. Expected: {} , Read: {}", numBytes, bytesRead );
+                break;
+            }
+        }
 
-    stagingBuffer->UnmapMemory( );
+        if ( recordCopies )
+        {
+            CopyBufferToTextureDesc copyDesc{ };
+            copyDesc.DstTexture = desc.Texture;
+            copyDesc.SrcBuffer  = stagingBuffer;
+            copyDesc.SrcOffset  = stagingOffset;
+            copyDesc.DstX       = 0;
+            copyDesc.DstY       = 0;
+            copyDesc.DstZ       = 0;
+            copyDesc.Format     = desc.Texture->GetFormat( );
+            copyDesc.MipLevel   = mip.MipIndex - desc.FirstMip;
+            copyDesc.ArrayLayer = mip.ArrayIndex;
+            copyDesc.RowPitch   = mip.RowPitch;
+            copyDesc.NumRows    = mip.NumRows;
+            desc.CommandList->CopyBufferToTexture( copyDesc );
+        }
+        stagingOffset += alignedSlicePitch;
+    }
 
-    for ( uint32_t i = 0; i < m_textureAsset->Mips.NumElements; ++i )
+    if ( readMips && desc.MappedStagingBuffer == nullptr )
     {
-        const TextureMip mip = m_textureAsset->Mips.Elements[ i ];
-
-        CopyBufferToTextureDesc copyDesc{ };
-        copyDesc.DstTexture = desc.Texture;
-        copyDesc.SrcBuffer  = stagingBuffer;
-        copyDesc.SrcOffset  = mip.DataOffset;
-        copyDesc.DstX       = 0;
-        copyDesc.DstY       = 0;
-        copyDesc.DstZ       = 0;
-        copyDesc.Format     = desc.Texture->GetFormat( );
-        copyDesc.MipLevel   = mip.MipIndex;
-        copyDesc.ArrayLayer = mip.ArrayIndex;
-        copyDesc.RowPitch   = mip.RowPitch;
-        copyDesc.NumRows    = mip.NumRows;
-
-        desc.CommandList->CopyBufferToTexture( copyDesc );
+        stagingBuffer->UnmapMemory( );
     }
 }
 
-uint64_t TextureAssetReader::AlignedTotalNumBytes( const DeviceConstants &constants ) const
+uint64_t TextureAssetReader::AlignedTotalNumBytes( const DeviceConstants &constants, const uint32_t firstMip ) const
 {
     uint64_t totalNumBytes = 0;
     for ( uint32_t i = 0; i < m_textureAsset->Mips.NumElements; ++i )
     {
-        const TextureMip &mip               = m_textureAsset->Mips.Elements[ i ];
-        const uint32_t    alignedRowPitch   = Utilities::Align( mip.RowPitch, constants.BufferTextureRowAlignment );
-        const uint32_t    alignedSlicePitch = Utilities::Align( alignedRowPitch * mip.NumRows, constants.BufferTextureAlignment );
+        const TextureMip &mip = m_textureAsset->Mips.Elements[ i ];
+        if ( mip.MipIndex < firstMip )
+        {
+            continue;
+        }
+        const uint32_t alignedRowPitch   = Utilities::Align( mip.RowPitch, constants.BufferTextureRowAlignment );
+        const uint32_t alignedSlicePitch = Utilities::Align( alignedRowPitch * mip.NumRows, constants.BufferTextureAlignment );
         totalNumBytes += alignedSlicePitch;
     }
     return totalNumBytes;
@@ -0,0 +1,302 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
+#include <array>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Serde/Shader/ShaderAssetReader.h"
+#include "DenOfIzGraphics/Assets/Serde/Shader/ShaderAssetWriter.h"
+#include "DenOfIzGraphics/Assets/Shaders/ShaderCache.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryContainer.h"
+#include "DenOfIzGraphics/Assets/Vector2d/QuadRenderer.h"
+#include "DenOfIzGraphics/Backends/Common/ShaderProgram.h"
+#include "DenOfIzGraphicsInternal/Assets/Font/EmbeddedTextRendererShaders.h"
+#include "DenOfIzGraphicsInternal/Assets/Vector2d/QuadRendererShaders.h"
+#include "DenOfIzGraphicsInternal/UI/ClayRenderer.h"
+#include "DenOfIzGraphicsInternal/UI/FullscreenQuadShaders.h"
+#include "DenOfIzGraphicsInternal/UI/UIShaders.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    std::mutex             g_mutex;
+    EngineShaderSourceDesc g_source{ };
+    // Keyed by the source an asset was loaded from and its name. Assets of a previous source stay loaded after SetSource, programs
+    // created from them still reference their reflection.
+    std::unordered_map<std::string, std::unique_ptr<ShaderAsset>> g_loadedAssets;
+
+    const char *ShaderName( const EngineShader shader )
+    {
+        switch ( shader )
+        {
+        case EngineShader::Text:
+            return "Text";
+        case EngineShader::UI:
+            return "UI";
+        case EngineShader::FullscreenQuad:
+            return "FullscreenQuad";
+        case EngineShader::Quad:
+            return "Quad";
+        }
+        return "Unknown";
+    }
+
+    uint32_t MaxNumTextures( const EngineShaderVariant &variant )
+    {
+        switch ( variant.Shader )
+        {
+        case EngineShader::UI:
+            return variant.MaxNumTextures != 0 ? variant.MaxNumTextures : ClayRendererDesc{ }.MaxTextures;
+        case EngineShader::Quad:
+            return variant.MaxNumTextures != 0 ? variant.MaxNumTextures : QuadRendererDesc{ }.MaxNumTextures;
+        default:
+            return 0;
+        }
+    }
+
+    // Embedded HLSL of a shader and the program desc pointing into it
+    class ProgramSource : public NonCopyable
+    {
+        std::vector<Byte>              m_vertexShader;
+        std::vector<Byte>              m_pixelShader;
+        std::array<ShaderStageDesc, 2> m_stages{ };
+        BindlessSlot                   m_bindlessTextures{ };
+
+    public:
+        ShaderProgramDesc Desc{ };
+
+        explicit ProgramSource( const EngineShaderVariant &variant )
+        {
+            switch ( variant.Shader )
+            {
+            case EngineShader::Text:
+                m_vertexShader = EmbeddedTextRendererShaders::GetFontVertexShaderBytes( );
+                m_pixelShader  = EmbeddedTextRendererShaders::GetFontPixelShaderBytes( );
+                break;
+            case EngineShader::UI:
+                m_vertexShader                   = EmbeddedUIShaders::GetUIVertexShaderBytes( );
+                m_pixelShader                    = EmbeddedUIShaders::GetUIPixelShaderBytes( );
+                m_bindlessTextures.RegisterSpace = 0;
+                break;
+            case EngineShader::FullscreenQuad:
+                m_vertexShader = EmbeddedFullscreenQuadShaders::GetFullscreenQuadVertexShaderBytes( );
+                m_pixelShader  = EmbeddedFullscreenQuadShaders::GetFullscreenQuadPixelShaderBytes( );
+                break;
+            case EngineShader::Quad:
+                m_vertexShader                   = EmbeddedQuadRendererShaders::GetQuadVertexShaderBytes( );
+                m_pixelShader                    = EmbeddedQuadRendererShaders::GetRasterPixelShaderBytes( );
+                m_bindlessTextures.RegisterSpace = 1;
+                break;
+            }
+
+            ShaderStageDesc &vsDesc = m_stages[ 0 ];
+            vsDesc.Stage            = ShaderStage::Vertex;
+            vsDesc.EntryPoint       = "main";
+            vsDesc.Data.Elements    = m_vertexShader.data( );
+            vsDesc.Data.NumElements = m_vertexShader.size( );
+
+            ShaderStageDesc &psDesc = m_stages[ 1 ];
+            psDesc.Stage            = ShaderStage::Pixel;
+            psDesc.EntryPoint       = "main";
+            psDesc.Data.Elements    = m_pixelShader.data( );
+            psDesc.Data.NumElements = m_pixelShader.size( );
+
+            if ( const uint32_t maxNumTextures = MaxNumTextures( variant ); maxNumTextures > 0 )
+            {
+                m_bindlessTextures.Binding                 = 0;
+                m_bindlessTextures.MaxArraySize            = maxNumTextures;
+                m_bindlessTextures.Type                    = ResourceBindingType::ShaderResource;
+                psDesc.Bindless.BindlessArrays.Elements    = &m_bindlessTextures;
+                psDesc.Bindless.BindlessArrays.NumElements = 1;
+            }
+
+            Desc.ShaderStages.Elements    = m_stages.data( );
+            Desc.ShaderStages.NumElements = m_stages.size( );
+        }
+
+        // Hash of everything the asset is compiled from, an asset built from other HLSL or bindless settings has a different name
+        [[nodiscard]] ShaderCacheKey SourceKey( ) const
+        {
+            std::vector<Byte> keyData;
+            const auto        append = [ &keyData ]( const void *data, const size_t numBytes )
+            {
+                const auto *bytes = static_cast<const Byte *>( data );
+                keyData.insert( keyData.end( ), bytes, bytes + numBytes );
+            };
+            for ( const std::vector<Byte> *stage : { &m_vertexShader, &m_pixelShader } )
+            {
+                const uint64_t numBytes = stage->size( );
+                append( &numBytes, sizeof( numBytes ) );
+                append( stage->data( ), stage->size( ) );
+            }
+            append( &m_bindlessTextures.RegisterSpace, sizeof( m_bindlessTextures.RegisterSpace ) );
+            append( &m_bindlessTextures.MaxArraySize, sizeof( m_bindlessTextures.MaxArraySize ) );
+            return ShaderCache::Key( { keyData.data( ), keyData.size( ) } );
+        }
+    };
+
+    InteropString VariantAssetName( const EngineShaderVariant &variant, const ProgramSource &source )
+    {
+        std::string name = ShaderName( variant.Shader );
+        if ( const uint32_t maxNumTextures = MaxNumTextures( variant ); maxNumTextures > 0 )
+        {
+            name += "_" + std::to_string( maxNumTextures );
+        }
+
+        const ShaderCacheKey key = source.SourceKey( );
+        char                 hash[ 40 ];
+        std::snprintf( hash, sizeof( hash ), "_%016" PRIx64 "%016" PRIx64 ".", key.High, key.Low );
+        name += hash;
+        name += ShaderAsset::Extension( ).Get( );
+        return name.c_str( );
+    }
+
+    // Returns nullptr if the asset is in neither the bundle nor the directory of the current source
+    const ShaderAsset *LoadAsset( const InteropString &name )
+    {
+        std::lock_guard   lock( g_mutex );
+        const std::string key = std::to_string( reinterpret_cast<uintptr_t>( g_source.ShaderBundle ) ) + "|" + g_source.Directory.Get( ) + "|" + name.Get( );
+        if ( const auto it = g_loadedAssets.find( key ); it != g_loadedAssets.end( ) )
+        {
+            return it->second.get( );
+        }
+
+        std::unique_ptr<BinaryReader> reader;
+        if ( const AssetUri uri = AssetUri::Create( name ); g_source.ShaderBundle != nullptr && g_source.ShaderBundle->Exists( uri ) )
+        {
+            reader = std::unique_ptr<BinaryReader>( g_source.ShaderBundle->OpenReader( uri ) );
+        }
+        else if ( !g_source.Directory.IsEmpty( ) )
+        {
+            const std::string path = std::string( g_source.Directory.Get( ) ) + "/" + name.Get( );
+            if ( FileIO::FileExists( path.c_str( ) ) )
+            {
+                reader = std::make_unique<BinaryReader>( InteropString( path.c_str( ) ) );
+            }
+        }
+        if ( reader == nullptr )
+        {
+            return nullptr;
+        }
+
+        ShaderAssetReader assetReader( { reader.get( ) } );
+        auto              asset = std::unique_ptr<ShaderAsset>( assetReader.Read( ) );
+        if ( asset == nullptr || asset->Stages.NumElements == 0 )
+        {
+            spdlog::error( "Failed to read precompiled engine shader {}", name.Get( ) );
+            return nullptr;
+        }
+        return ( g_loadedAssets[ key ] = std::move( asset ) ).get( );
+    }
+} // namespace
+
+bool EngineShaders::Build( const EngineShaderBuildDesc &desc )
+{
+    std::vector<EngineShaderVariant> variants( desc.Variants.Elements, desc.Variants.Elements + desc.Variants.NumElements );
+    if ( variants.empty( ) )
+    {
+        variants = { { EngineShader::Text }, { EngineShader::UI }, { EngineShader::FullscreenQuad }, { EngineShader::Quad } };
+    }
+
+    std::vector<std::unique_ptr<ProgramSource>> sources;
+    std::vector<ShaderProgramDesc>              programDescs;
+    for ( const EngineShaderVariant &variant : variants )
+    {
+        programDescs.push_back( sources.emplace_back( std::make_unique<ProgramSource>( variant ) )->Desc );
+    }
+
+    const auto                   numPrograms = static_cast<uint32_t>( variants.size( ) );
+    std::vector<ShaderProgram *> programs( numPrograms, nullptr );
+    try
+    {
+        ShaderProgram::CreatePrograms( { programDescs.data( ), numPrograms }, { programs.data( ), numPrograms } );
+    }
+    catch ( const std::exception &e )
+    {
+        spdlog::error( "Failed to compile engine shaders: {}", e.what( ) );
+        return false;
+    }
+
+    FileIO::CreateDirectories( desc.TargetDirectory );
+    for ( uint32_t i = 0; i < numPrograms; ++i )
+    {
+        const std::unique_ptr<ShaderProgram> program( programs[ i ] );
+        if ( program == nullptr )
+        {
+            spdlog::error( "Failed to compile engine shader {}", VariantAssetName( variants[ i ], *sources[ i ] ).Get( ) );
+            return false;
+        }
+
+        CompiledShader compiledShader;
+        compiledShader.RayTracing  = programDescs[ i ].RayTracing;
+        compiledShader.Stages      = program->CompiledShaders( );
+        compiledShader.ReflectDesc = program->Reflect( );
+        const auto asset           = std::unique_ptr<ShaderAsset>( ShaderAssetWriter::CreateFromCompiledShader( compiledShader ) );
+
+        BinaryContainer   container;
+        BinaryWriter      writer( container );
+        ShaderAssetWriter assetWriter( { &writer } );
+        assetWriter.Write( *asset );
+        assetWriter.End( );
+
+        const InteropString name = VariantAssetName( variants[ i ], *sources[ i ] );
+        const std::string   path = std::string( desc.TargetDirectory.Get( ) ) + "/" + name.Get( );
+        FileIO::WriteFile( path.c_str( ), container.GetData( ) );
+        if ( desc.TargetBundle != nullptr )
+        {
+            desc.TargetBundle->AddAsset( AssetUri::Create( name ), AssetType::Shader, container.GetData( ) );
+        }
+        spdlog::info( "Built engine shader {}", path );
+    }
+
+    return desc.TargetBundle == nullptr || desc.TargetBundle->Save( );
+}
+
+void EngineShaders::SetSource( const EngineShaderSourceDesc &desc )
+{
+    std::lock_guard lock( g_mutex );
+    g_source = desc;
+}
+
+ShaderProgram *EngineShaders::CreateProgram( const EngineShaderVariant &variant )
+{
+    // Assets built from older HLSL have another name and are never found, those shaders are compiled again
+    const ProgramSource source( variant );
+    const InteropString name = VariantAssetName( variant, source );
+    if ( const ShaderAsset *asset = LoadAsset( name ) )
+    {
+        return new ShaderProgram( *asset );
+    }
+
+    spdlog::info( "Engine shader {} is not precompiled, compiling it at runtime", name.Get( ) );
+    return new ShaderProgram( source.Desc );
+}
+
+InteropString EngineShaders::AssetName( const EngineShaderVariant &variant )
+{
+    return VariantAssetName( variant, ProgramSource( variant ) );
+}
@@ -0,0 +1,210 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Assets/Shaders/ShaderCache.h"
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryReader.h"
+#include "DenOfIzGraphics/Assets/Stream/BinaryWriter.h"
+#include "DenOfIzGraphicsInternal/Utilities/ContentHash.h"
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr const char *EntryExtension = ".dzshc";
+
+    uint64_t HashPayload( const CompileResult &result )
+    {
+        ContentHash hash;
+        hash.Append( result.Code.Elements, result.Code.NumElements );
+        if ( result.Reflection.NumElements > 0 )
+        {
+            hash.Append( result.Reflection.Elements, result.Reflection.NumElements );
+        }
+        return hash.Value( );
+    }
+
+    // Unique across threads and processes sharing the directory, concurrent stores of the same entry never write the same file
+    std::string TempSuffix( )
+    {
+        static const uint64_t        ProcessToken = ( static_cast<uint64_t>( std::random_device{ }( ) ) << 32 ) | std::random_device{ }( );
+        static std::atomic<uint64_t> Counter      = 0;
+        char                         suffix[ 64 ];
+        std::snprintf( suffix, sizeof( suffix ), ".%016" PRIx64 ".%" PRIu64 ".tmp", ProcessToken, Counter.fetch_add( 1, std::memory_order_relaxed ) );
+        return suffix;
+    }
+
+    bool ReadBlob( BinaryReader &reader, const uint64_t maxNumBytes, ByteArray &outBlob )
+    {
+        const uint64_t numBytes = reader.ReadUInt64( );
+        if ( numBytes > maxNumBytes )
+        {
+            return false;
+        }
+        outBlob.NumElements = numBytes;
+        outBlob.Elements    = numBytes > 0 ? static_cast<Byte *>( std::malloc( numBytes ) ) : nullptr;
+        return numBytes == 0 || reader.ReadArray( outBlob.Elements, numBytes );
+    }
+} // namespace
+
+ShaderCache::ShaderCache( const ShaderCacheDesc &desc ) : m_directory( FileIO::GetResourcePath( desc.Directory ) )
+{
+    std::error_code error;
+    std::filesystem::create_directories( m_directory.Get( ), error );
+    if ( error )
+    {
+        spdlog::error( "Failed to create shader cache directory {}: {}", m_directory.Get( ), error.message( ) );
+    }
+}
+
+ShaderCacheKey ShaderCache::Key( const ByteArrayView &keyData )
+{
+    ShaderCacheKey key{ };
+    key.High = Fnv1a::Hash( reinterpret_cast<const char *>( keyData.Elements ), keyData.NumElements );
+    key.Low  = ContentHash::Hash( keyData );
+    return key;
+}
+
+std::string ShaderCache::EntryPath( const ShaderCacheKey &key ) const
+{
+    char fileName[ 64 ];
+    std::snprintf( fileName, sizeof( fileName ), "%016" PRIx64 "%016" PRIx64 "%s", key.High, key.Low, EntryExtension );
+    return ( std::filesystem::path( m_directory.Get( ) ) / fileName ).string( );
+}
+
+bool ShaderCache::Load( const ShaderCacheKey &key, CompileResult &outResult ) const
+{
+    const std::string path = EntryPath( key );
+    std::ifstream     file( path, std::ios::binary );
+    if ( !file.is_open( ) )
+    {
+        return false;
+    }
+
+    std::error_code error;
+    const uint64_t  fileNumBytes = std::filesystem::file_size( path, error );
+    if ( error )
+    {
+        return false;
+    }
+
+    BinaryReader reader( &file );
+    if ( reader.ReadUInt64( ) != Magic || reader.ReadUInt32( ) != Version || reader.ReadUInt64( ) != key.High || reader.ReadUInt64( ) != key.Low )
+    {
+        spdlog::warn( "Ignoring invalid shader cache entry {}", path );
+        return false;
+    }
+
+    const uint64_t payloadHash = reader.ReadUInt64( );
+    CompileResult  result{ };
+    const bool     isRead = ReadBlob( reader, fileNumBytes, result.Code ) && ReadBlob( reader, fileNumBytes, result.Reflection );
+    if ( !isRead || result.Code.NumElements == 0 || HashPayload( result ) != payloadHash )
+    {
+        spdlog::warn( "Ignoring truncated or corrupted shader cache entry {}", path );
+        std::free( result.Code.Elements );
+        std::free( result.Reflection.Elements );
+        return false;
+    }
+
+    outResult = result;
+    return true;
+}
+
+bool ShaderCache::Store( const ShaderCacheKey &key, const CompileResult &result ) const
+{
+    if ( result.Code.NumElements == 0 )
+    {
+        return false;
+    }
+
+    const std::string path     = EntryPath( key );
+    const std::string tempPath = path + TempSuffix( );
+    {
+        std::ofstream file( tempPath, std::ios::binary | std::ios::trunc );
+        if ( !file.is_open( ) )
+        {
+            spdlog::warn( "Failed to open shader cache entry for writing: {}", tempPath );
+            return false;
+        }
+
+        const BinaryWriter writer( &file );
+        writer.WriteUInt64( Magic );
+        writer.WriteUInt32( Version );
+        writer.WriteUInt64( key.High );
+        writer.WriteUInt64( key.Low );
+        writer.WriteUInt64( HashPayload( result ) );
+        writer.WriteUInt64( result.Code.NumElements );
+        writer.WriteBytes( ByteArrayView( result.Code ) );
+        writer.WriteUInt64( result.Reflection.NumElements );
+        if ( result.Reflection.NumElements > 0 )
+        {
+            writer.WriteBytes( ByteArrayView( result.Reflection ) );
+        }
+        writer.Flush( );
+        if ( !file.good( ) )
+        {
+            spdlog::warn( "Failed to write shader cache entry: {}", tempPath );
+            file.close( );
+            std::filesystem::remove( tempPath );
+            return false;
+        }
+    }
+
+    // Another thread or process might have stored the same entry in the meantime, both have the same content so either one can win
+    std::error_code error;
+    std::filesystem::rename( tempPath, path, error );
+    if ( error )
+    {
+        spdlog::warn( "Failed to store shader cache entry {}: {}", path, error.message( ) );
+        std::filesystem::remove( tempPath, error );
+        return false;
+    }
+    return true;
+}
+
+bool ShaderCache::Contains( const ShaderCacheKey &key ) const
+{
+    std::error_code error;
+    return std::filesystem::exists( EntryPath( key ), error );
+}
+
+void ShaderCache::Clear( ) const
+{
+    std::error_code error;
+    for ( const auto &entry : std::filesystem::directory_iterator( m_directory.Get( ), error ) )
+    {
+        if ( entry.is_regular_file( ) && entry.path( ).extension( ) == EntryExtension )
+        {
+            std::filesystem::remove( entry.path( ), error );
+        }
+    }
+}
+
+const InteropString &ShaderCache::GetDirectory( ) const
+{
+    return m_directory;
+}
@@ -19,6 +19,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphics/Assets/Shaders/ShaderCompiler.h"
 #include <fstream>
 #include <ranges>
+#include "DenOfIzGraphics/Assets/Shaders/ShaderCache.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 #include "DenOfIzGraphicsInternal/Utilities/Utilities.h"
 
@@ -41,10 +42,14 @@ public:
     IDxcCompiler3      *m_dxcCompiler       = nullptr;
     IDxcUtils          *m_dxcUtils          = nullptr;
     IDxcIncludeHandler *m_dxcIncludeHandler = nullptr;
+    std::string         m_compilerVersion; // Part of every shader cache key, a different compiler never reuses cached code
 
     Impl( );
     ~Impl( );
     [[nodiscard]] CompileResult CompileHLSL( const CompileDesc &compileDesc ) const;
+
+private:
+    [[nodiscard]] bool CacheKey( const CompileDesc &compileDesc, const DxcBuffer &source, std::vector<LPCWSTR> arguments, ShaderCacheKey &outKey ) const;
 };
 
 ShaderCompiler::Impl::Impl( )
@@ -71,6 +76,30 @@ ShaderCompiler::Impl::Impl( )
     {
         spdlog::critical( "Failed to initialize DXC Include Handler" );
     }
+
+    IDxcVersionInfo *versionInfo = nullptr;
+    if ( m_dxcCompiler && SUCCEEDED( m_dxcCompiler->QueryInterface( IID_PPV_ARGS( &versionInfo ) ) ) )
+    {
+        UINT32 major = 0;
+        UINT32 minor = 0;
+        versionInfo->GetVersion( &major, &minor );
+        m_compilerVersion = std::to_string( major ) + "." + std::to_string( minor );
+
+        // Development builds share a version number, the commit tells them apart
+        IDxcVersionInfo2 *versionInfo2 = nullptr;
+        if ( SUCCEEDED( versionInfo->QueryInterface( IID_PPV_ARGS( &versionInfo2 ) ) ) )
+        {
+            UINT32 commitCount = 0;
+            char  *commitHash  = nullptr;
+            if ( SUCCEEDED( versionInfo2->GetCommitInfo( &commitCount, &commitHash ) ) )
+            {
+                m_compilerVersion += "." + std::to_string( commitCount ) + "-" + ( commitHash ? commitHash : "" );
+                CoTaskMemFree( commitHash );
+            }
+            versionInfo2->Release( );
+        }
+        versionInfo->Release( );
+    }
 }
 
 // ReSharper disable once CppMemberFunctionMayBeConst
@@ -246,13 +275,15 @@ CompileResult ShaderCompiler::Impl::CompileHLSL( const CompileDesc &compileDesc
         arguments.push_back( L"-fvk-support-nonzero-base-instance" );
     }
 
-    std::vector<std::string> defines( compileDesc.Defines.NumElements );
+    // Reserved up front, arguments point into these strings
+    std::vector<std::wstring> defines;
+    defines.reserve( compileDesc.Defines.NumElements );
     for ( auto i = 0; i < compileDesc.Defines.NumElements; ++i )
     {
-        auto               strView   = compileDesc.Defines.Elements[ i ];
-        const std::string &defineStr = defines.emplace_back( strView.Chars, strView.Length );
+        auto                strView   = compileDesc.Defines.Elements[ i ];
+        const std::wstring &defineStr = defines.emplace_back( strView.Chars, strView.Chars + strView.Length );
         arguments.push_back( L"-D" );
-        arguments.push_back( reinterpret_cast<LPCWSTR>( defineStr.c_str( ) ) );
+        arguments.push_back( defineStr.c_str( ) );
     }
     arguments.push_back( L"-HV" );
     arguments.push_back( L"2021" );
@@ -280,6 +311,17 @@ CompileResult ShaderCompiler::Impl::CompileHLSL( const CompileDesc &compileDesc
     buffer.Ptr      = sourceBlob->GetBufferPointer( );
     buffer.Size     = sourceBlob->GetBufferSize( );
 
+    ShaderCacheKey cacheKey{ };
+    const bool     useCache = compileDesc.Cache != nullptr && CacheKey( compileDesc, buffer, arguments, cacheKey );
+    if ( useCache )
+    {
+        if ( CompileResult cached{ }; compileDesc.Cache->Load( cacheKey, cached ) )
+        {
+            sourceBlob->Release( );
+            return cached;
+        }
+    }
+
     IDxcResult *dxcResult{ nullptr };
     result = m_dxcCompiler->Compile( &buffer, arguments.data( ), static_cast<uint32_t>( arguments.size( ) ), m_dxcIncludeHandler, IID_PPV_ARGS( &dxcResult ) );
 
@@ -334,7 +376,57 @@ CompileResult ShaderCompiler::Impl::CompileHLSL( const CompileDesc &compileDesc
         std::memcpy( resultReflection.Elements, reflection->GetBufferPointer( ), reflection->GetBufferSize( ) );
         reflection->Release( );
     }
-    return { .Code = resultCode, .Reflection = resultReflection };
+    const CompileResult compileResult{ .Code = resultCode, .Reflection = resultReflection };
+    if ( useCache )
+    {
+        compileDesc.Cache->Store( cacheKey, compileResult );
+    }
+    return compileResult;
+}
+
+bool ShaderCompiler::Impl::CacheKey( const CompileDesc &compileDesc, const DxcBuffer &source, std::vector<LPCWSTR> arguments, ShaderCacheKey &outKey ) const
+{
+    // The preprocessed source has every include resolved, so an edited include changes the key without tracking includes separately
+    arguments.push_back( L"-P" );
+    IDxcResult *dxcResult = nullptr;
+    HRESULT     result    = m_dxcCompiler->Compile( &source, arguments.data( ), static_cast<uint32_t>( arguments.size( ) ), m_dxcIncludeHandler, IID_PPV_ARGS( &dxcResult ) );
+    if ( SUCCEEDED( result ) && FAILED( dxcResult->GetStatus( &result ) ) )
+    {
+        result = E_FAIL;
+    }
+
+    IDxcBlobUtf8 *preprocessed = nullptr;
+    if ( SUCCEEDED( result ) )
+    {
+        result = dxcResult->GetOutput( DXC_OUT_HLSL, IID_PPV_ARGS( &preprocessed ), nullptr );
+    }
+    if ( dxcResult )
+    {
+        dxcResult->Release( );
+    }
+    if ( FAILED( result ) || preprocessed == nullptr )
+    {
+        // Compiling reports the actual error, the shader is just not cached
+        return false;
+    }
+
+    std::string keyData( preprocessed->GetStringPointer( ), preprocessed->GetStringLength( ) );
+    preprocessed->Release( );
+
+    keyData += '\0';
+    keyData += m_compilerVersion;
+    keyData += '\0';
+    keyData += std::to_string( static_cast<uint32_t>( compileDesc.TargetIL ) );
+    arguments.pop_back( );
+    // Entry point, target profile, defines and every other option
+    for ( const std::wstring_view argument : arguments )
+    {
+        keyData += '\0';
+        keyData.append( reinterpret_cast<const char *>( argument.data( ) ), argument.size( ) * sizeof( wchar_t ) );
+    }
+
+    outKey = ShaderCache::Key( ByteArrayView( reinterpret_cast<const Byte *>( keyData.data( ) ), keyData.size( ) ) );
+    return true;
 }
 
 ShaderCompiler::ShaderCompiler( ) : m_pImpl( std::make_unique<Impl>( ) )
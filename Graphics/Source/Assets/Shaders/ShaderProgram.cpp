@@ -17,6 +17,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Backends/Common/ShaderProgram.h"
+#include <algorithm>
+#include <exception>
 #include <ranges>
 #include <set>
 #include <utility>
@@ -24,6 +26,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "DenOfIzGraphics/Assets/Serde/Shader/ShaderAssetReader.h"
 #include "DenOfIzGraphics/Assets/Shaders/DxilToMsl.h"
 #include "DenOfIzGraphics/Assets/Shaders/ShaderCompiler.h"
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
 #include "DenOfIzGraphicsInternal/Assets/Shaders/DxcEnumConverter.h"
 #include "DenOfIzGraphicsInternal/Assets/Shaders/ReflectionDebugOutput.h"
 #include "DenOfIzGraphicsInternal/Assets/Shaders/ShaderReflectionHelper.h"
@@ -51,6 +54,16 @@ using namespace DenOfIz;
     }                                                                                                                                                                              \
     while ( false )
 
+namespace
+{
+    // DXC compiler instances must not be shared between threads, every thread compiling shaders creates its own once
+    ShaderCompiler &ThreadCompiler( )
+    {
+        thread_local ShaderCompiler compiler;
+        return compiler;
+    }
+} // namespace
+
 struct RootSignatureState
 {
     std::vector<StaticSamplerDesc>               StaticSamplers;
@@ -76,7 +89,6 @@ struct ReflectionState
 class ShaderProgram::Impl
 {
 public:
-    ShaderCompiler                                     m_compiler;
     std::vector<std::unique_ptr<CompiledShaderStage>>  m_compiledShaders;
     std::vector<CompiledShaderStage *>                 m_compiledShaderPtrs;
     std::vector<ShaderStageDesc>                       m_shaderDescs; // Index matched with m_compiledShaders
@@ -99,6 +111,17 @@ public:
     explicit Impl( const ShaderAsset & ) : m_desc( { } )
     {
     }
+    // Freed here rather than in ~ShaderProgram so blobs of stages that compiled are released when another stage throws
+    ~Impl( )
+    {
+        for ( const auto &data : m_dataToClean )
+        {
+            if ( data.Elements )
+            {
+                free( data.Elements );
+            }
+        }
+    }
 
     void Compile( );
     void CreateReflectionData( );
@@ -142,15 +165,47 @@ ShaderProgram::ShaderProgram( const ShaderAsset &asset ) : m_pImpl( std::make_un
     m_pImpl->m_desc.RayTracing = shader.RayTracing;
 }
 
-ShaderProgram::~ShaderProgram( )
+ShaderProgram::~ShaderProgram( ) = default;
+
+void ShaderProgram::CreatePrograms( const ShaderProgramDescArray &descs, const ShaderProgramArray &outPrograms )
 {
-    for ( const auto &data : m_pImpl->m_dataToClean )
+    if ( outPrograms.NumElements < descs.NumElements )
     {
-        if ( data.Elements )
+        spdlog::error( "outPrograms has room for {} programs, {} are required", outPrograms.NumElements, descs.NumElements );
+        return;
+    }
+
+    // Programs compile their stages in parallel as well, waiting workers pick up stages of other programs
+    std::vector<std::exception_ptr> errors( descs.NumElements );
+
+    const auto createRange = [ & ]( const uint32_t begin, const uint32_t end )
+    {
+        for ( uint32_t i = begin; i < end; ++i )
         {
-            free( data.Elements );
+            try
+            {
+                outPrograms.Elements[ i ] = new ShaderProgram( descs.Elements[ i ] );
+            }
+            catch ( ... )
+            {
+                outPrograms.Elements[ i ] = nullptr;
+                errors[ i ]               = std::current_exception( );
+            }
         }
+    };
+    JobSystem::Get( ).ParallelFor( descs.NumElements, createRange );
+
+    const auto error = std::ranges::find_if( errors, [ ]( const std::exception_ptr &e ) { return e != nullptr; } );
+    if ( error == errors.end( ) )
+    {
+        return;
+    }
+    for ( uint32_t i = 0; i < descs.NumElements; ++i )
+    {
+        delete outPrograms.Elements[ i ];
+        outPrograms.Elements[ i ] = nullptr;
     }
+    std::rethrow_exception( *error );
 }
 
 CompiledShaderStageArray ShaderProgram::CompiledShaders( ) const
@@ -176,8 +231,7 @@ ShaderProgramDesc ShaderProgram::Desc( ) const
  */
 void ShaderProgram::Impl::Compile( )
 {
-    std::vector<CompiledShaderStage *> dxilShaders;
-
+    std::vector<uint32_t> stageIndices;
     for ( uint32_t i = 0; i < m_desc.ShaderStages.NumElements; ++i )
     {
         const auto &stage = m_desc.ShaderStages.Elements[ i ];
@@ -187,23 +241,57 @@ void ShaderProgram::Impl::Compile( )
             spdlog::error( "Either stage.Path or stage.Data must be set for stage {} ", i );
             continue;
         }
+        stageIndices.push_back( i );
+    }
 
-        CompileDesc compileDesc = { };
-        compileDesc.Path        = stage.Path;
-        compileDesc.CodePage    = stage.CodePage;
-        compileDesc.Data        = stage.Data;
-        compileDesc.Defines     = stage.Defines;
-        compileDesc.EntryPoint  = stage.EntryPoint;
-        compileDesc.Stage       = stage.Stage;
-        compileDesc.TargetIL    = TargetIL::DXIL;
+    // Every stage is compiled to DXIL and SPIR-V, all of them run concurrently and results are collected in stage order afterwards
+    constexpr uint32_t              NumTargets = 2;
+    std::vector<CompileResult>      results( stageIndices.size( ) * NumTargets );
+    std::vector<std::exception_ptr> errors( results.size( ) );
+
+    const auto compileRange = [ & ]( const uint32_t begin, const uint32_t end )
+    {
+        for ( uint32_t i = begin; i < end; ++i )
+        {
+            const auto &stage       = m_desc.ShaderStages.Elements[ stageIndices[ i / NumTargets ] ];
+            CompileDesc compileDesc = { };
+            compileDesc.Path        = stage.Path;
+            compileDesc.CodePage    = stage.CodePage;
+            compileDesc.Data        = stage.Data;
+            compileDesc.Defines     = stage.Defines;
+            compileDesc.EntryPoint  = stage.EntryPoint;
+            compileDesc.Stage       = stage.Stage;
+            compileDesc.TargetIL    = i % NumTargets == 0 ? TargetIL::DXIL : TargetIL::SPIRV;
+            compileDesc.Cache       = m_desc.Cache;
+            try
+            {
+                results[ i ] = ThreadCompiler( ).CompileHLSL( compileDesc );
+            }
+            catch ( ... )
+            {
+                // Rethrown on the calling thread, jobs must not throw into the job system
+                errors[ i ] = std::current_exception( );
+            }
+        }
+    };
+    JobSystem::Get( ).ParallelFor( static_cast<uint32_t>( results.size( ) ), compileRange );
 
-        auto [ dxil, reflection ] = m_compiler.CompileHLSL( compileDesc );
-        m_dataToClean.push_back( dxil );
-        m_dataToClean.push_back( reflection );
+    for ( const CompileResult &result : results )
+    {
+        m_dataToClean.push_back( result.Code );
+        m_dataToClean.push_back( result.Reflection );
+    }
+    for ( const std::exception_ptr &error : errors )
+    {
+        if ( error )
+        {
+            std::rethrow_exception( error );
+        }
+    }
 
-        compileDesc.TargetIL = TargetIL::SPIRV;
-        auto [ spirv, _ ]    = m_compiler.CompileHLSL( compileDesc );
-        m_dataToClean.push_back( spirv );
+    for ( uint32_t i = 0; i < stageIndices.size( ); ++i )
+    {
+        const auto &stage = m_desc.ShaderStages.Elements[ stageIndices[ i ] ];
 
         const auto &compiledShader = m_compiledShaders.emplace_back( std::make_unique<CompiledShaderStage>( ) );
         m_compiledShaderPtrs.push_back( compiledShader.get( ) );
@@ -211,9 +299,9 @@ void ShaderProgram::Impl::Compile( )
         compiledShader->Stage      = stage.Stage;
         compiledShader->EntryPoint = stage.EntryPoint;
         compiledShader->RayTracing = stage.RayTracing;
-        compiledShader->Reflection = reflection;
-        compiledShader->DXIL       = dxil;
-        compiledShader->SPIRV      = spirv;
+        compiledShader->Reflection = results[ i * NumTargets ].Reflection;
+        compiledShader->DXIL       = results[ i * NumTargets ].Code;
+        compiledShader->SPIRV      = results[ i * NumTargets + 1 ].Code;
         compiledShader->MSL        = { }; // Set below
 
         m_shaderDescs.push_back( stage );
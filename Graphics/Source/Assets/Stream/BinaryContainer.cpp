@@ -17,14 +17,74 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Assets/Stream/BinaryContainer.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
 using namespace DenOfIz;
 
-BinaryContainer::BinaryContainer( )  = default;
-BinaryContainer::~BinaryContainer( ) = default;
+BinaryContainer::BinaryContainer( ) = default;
+
+BinaryContainer::BinaryContainer( const uint64_t reserveNumBytes )
+{
+    Reserve( reserveNumBytes );
+}
+
+BinaryContainer::~BinaryContainer( )
+{
+    std::free( m_data );
+    m_data = nullptr;
+}
+
+void BinaryContainer::Reserve( const uint64_t numBytes )
+{
+    if ( numBytes <= m_capacity )
+    {
+        return;
+    }
+
+    auto *newData = static_cast<Byte *>( std::realloc( m_data, numBytes ) );
+    if ( newData == nullptr )
+    {
+        spdlog::critical( "Failed to grow BinaryContainer to {} bytes", numBytes );
+        return;
+    }
+    m_data     = newData;
+    m_capacity = numBytes;
+}
+
+void BinaryContainer::Clear( )
+{
+    m_numBytes = 0;
+}
+
+uint64_t BinaryContainer::NumBytes( ) const
+{
+    return m_numBytes;
+}
 
 ByteArrayView BinaryContainer::GetData( ) const
 {
-    m_cachedData = m_stream.str( );
-    return ByteArrayView( reinterpret_cast<const Byte *>( m_cachedData.c_str( ) ), m_cachedData.size( ) );
+    return ByteArrayView( m_data, m_numBytes );
+}
+
+void BinaryContainer::WriteAt( const uint64_t position, const Byte *data, const uint64_t count )
+{
+    const uint64_t end = position + count;
+    if ( end > m_capacity )
+    {
+        Reserve( std::max<uint64_t>( end, m_capacity * 2 ) );
+        if ( end > m_capacity )
+        {
+            return;
+        }
+    }
+    // Seeking past the end and writing leaves a zero filled gap
+    if ( position > m_numBytes )
+    {
+        std::memset( m_data + m_numBytes, 0, position - m_numBytes );
+    }
+    std::memcpy( m_data + position, data, count );
+    m_numBytes = std::max( m_numBytes, end );
 }
@@ -17,6 +17,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Assets/Stream/BinaryReader.h"
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
@@ -35,11 +36,19 @@ BinaryReader::BinaryReader( std::istream *stream, const BinaryReaderDesc &desc )
     m_isStreamValid = true;
 }
 
+BinaryReader::BinaryReader( std::unique_ptr<std::istream> stream, const BinaryReaderDesc &desc ) : m_allowedNumBytes( desc.NumBytes )
+{
+    m_isStreamOwned = true;
+    m_isStreamValid = stream != nullptr;
+    m_stream        = stream.release( );
+}
+
 BinaryReader::BinaryReader( BinaryContainer &container, const BinaryReaderDesc &desc ) : m_allowedNumBytes( desc.NumBytes )
 {
-    m_stream        = &container.m_stream;
     m_isStreamOwned = false;
     m_isStreamValid = true;
+    m_container     = &container;
+    RefreshContainerView( );
 }
 
 BinaryReader::BinaryReader( const InteropString &filePath, const BinaryReaderDesc &desc ) : m_allowedNumBytes( desc.NumBytes )
@@ -51,6 +60,7 @@ BinaryReader::BinaryReader( const InteropString &filePath, const BinaryReaderDes
     if ( !stream->is_open( ) )
     {
         spdlog::error( "Failed to open file for reading: {}", filePath.Get( ) );
+        delete stream;
         m_isStreamValid = false;
         return;
     }
@@ -61,28 +71,43 @@ BinaryReader::BinaryReader( const InteropString &filePath, const BinaryReaderDes
 
 BinaryReader::BinaryReader( const ByteArrayView &data, const BinaryReaderDesc &desc ) : m_allowedNumBytes( desc.NumBytes )
 {
-    m_isStreamOwned = true;
-    auto *stream    = new std::stringstream( std::ios::in | std::ios::out | std::ios::binary );
+    m_isStreamOwned = false;
+    m_isStreamValid = true;
+    m_dataNumBytes  = data.NumElements;
+
+    if ( !desc.CopyData )
+    {
+        m_data = data.Elements;
+        return;
+    }
 
     if ( data.NumElements > 0 )
     {
-        stream->write( reinterpret_cast<const char *>( data.Elements ), data.NumElements );
-        stream->flush( );
-        stream->seekg( 0, std::ios::beg );
+        m_ownedData = static_cast<Byte *>( std::malloc( data.NumElements ) );
+        std::memcpy( m_ownedData, data.Elements, data.NumElements );
     }
+    m_data = m_ownedData;
+}
 
-    m_stream         = stream;
-    m_isStreamValid  = true;
-    m_isStringStream = true;
+BinaryReader::BinaryReader( const ByteArray &data, const BinaryReaderDesc &desc ) : m_allowedNumBytes( desc.NumBytes )
+{
+    m_isStreamOwned = false;
+    m_isStreamValid = true;
+    m_ownedData     = data.Elements;
+    m_data          = m_ownedData;
+    m_dataNumBytes  = data.NumElements;
 }
 
 BinaryReader::~BinaryReader( )
 {
+    std::free( m_ownedData );
+    m_ownedData = nullptr;
+
     if ( m_isStreamValid && m_isStreamOwned )
     {
-        if ( !m_isStringStream && dynamic_cast<std::ifstream *>( m_stream )->is_open( ) )
+        if ( auto *fileStream = dynamic_cast<std::ifstream *>( m_stream ); fileStream && fileStream->is_open( ) )
         {
-            dynamic_cast<std::ifstream *>( m_stream )->close( );
+            fileStream->close( );
         }
         delete m_stream;
         m_stream = nullptr;
@@ -91,11 +116,12 @@ BinaryReader::~BinaryReader( )
 
 int BinaryReader::ReadByte( )
 {
-    if ( !IsStreamValid( ) || !TrackReadBytes( 1 ) )
+    Byte value = 0;
+    if ( !ReadExact( &value, sizeof( value ) ) )
     {
         return -1;
     }
-    return m_stream->get( );
+    return value;
 }
 
 int BinaryReader::Read( const ByteArray &buffer, const uint32_t offset, const uint32_t count )
@@ -105,8 +131,7 @@ int BinaryReader::Read( const ByteArray &buffer, const uint32_t offset, const ui
         return -1;
     }
 
-    m_stream->read( reinterpret_cast<char *>( buffer.Elements + offset ), count );
-    return static_cast<int>( m_stream->gcount( ) );
+    return static_cast<int>( ReadRaw( buffer.Elements + offset, count ) );
 }
 
 ByteArray BinaryReader::ReadAllBytes( )
@@ -116,6 +141,11 @@ ByteArray BinaryReader::ReadAllBytes( )
         return { nullptr, 0 };
     }
 
+    if ( IsMemoryBacked( ) )
+    {
+        return ReadBytes( static_cast<uint32_t>( m_dataNumBytes - m_dataPosition ) );
+    }
+
     const std::streampos currentPos = m_stream->tellg( );
 
     m_stream->seekg( 0, std::ios::end );
@@ -137,9 +167,9 @@ ByteArray BinaryReader::ReadBytes( const uint32_t count )
     ByteArray result{ };
     result.Elements    = static_cast<Byte *>( std::malloc( count ) );
     result.NumElements = count;
-    if ( const int bytesRead = Read( result, 0, count ); bytesRead >= 0 && static_cast<uint32_t>( bytesRead ) < count )
+    if ( const uint64_t bytesRead = ReadRaw( result.Elements, count ); bytesRead < count )
     {
-        ByteArray resized{};
+        ByteArray resized{ };
         resized.Elements    = static_cast<Byte *>( std::realloc( result.Elements, bytesRead ) );
         resized.NumElements = bytesRead;
         return resized;
@@ -150,42 +180,24 @@ ByteArray BinaryReader::ReadBytes( const uint32_t count )
 
 uint16_t BinaryReader::ReadUInt16( )
 {
-    if ( !IsStreamValid( ) || !TrackReadBytes( 1 ) )
+    Byte bytes[ 2 ];
+    if ( !ReadExact( bytes, sizeof( bytes ) ) )
     {
         return 0;
     }
-    uint16_t value = 0;
-    Byte     bytes[ 2 ];
-    m_stream->read( reinterpret_cast<char *>( bytes ), 2 );
-    if ( m_stream->gcount( ) != 2 )
-    {
-        spdlog::error( "Failed to read 2 bytes for uint16" );
-        return 0;
-    }
 
-    value |= static_cast<uint16_t>( bytes[ 0 ] );
-    value |= static_cast<uint16_t>( bytes[ 1 ] ) << 8;
-
-    return value;
+    return static_cast<uint16_t>( bytes[ 0 ] | bytes[ 1 ] << 8 );
 }
 
 uint32_t BinaryReader::ReadUInt32( )
 {
-    if ( !IsStreamValid( ) || !TrackReadBytes( 1 ) )
+    Byte bytes[ 4 ];
+    if ( !ReadExact( bytes, sizeof( bytes ) ) )
     {
         return 0;
     }
 
     uint32_t value = 0;
-    Byte     bytes[ 4 ];
-    m_stream->read( reinterpret_cast<char *>( bytes ), 4 );
-
-    if ( m_stream->gcount( ) != 4 )
-    {
-        spdlog::error( "Failed to read 4 bytes for uint32" );
-        return 0;
-    }
-
     value |= static_cast<uint32_t>( bytes[ 0 ] );
     value |= static_cast<uint32_t>( bytes[ 1 ] ) << 8;
     value |= static_cast<uint32_t>( bytes[ 2 ] ) << 16;
@@ -196,15 +208,14 @@ uint32_t BinaryReader::ReadUInt32( )
 
 uint64_t BinaryReader::ReadUInt64( )
 {
-    if ( !IsStreamValid( ) || !TrackReadBytes( 1 ) )
+    // Written as two uint32s, high word first
+    uint32_t words[ 2 ];
+    if ( !ReadArray( words, 2 ) )
     {
         return 0;
     }
 
-    const uint32_t high = ReadUInt32( );
-    const uint32_t low  = ReadUInt32( );
-
-    return static_cast<uint64_t>( high ) << 32 | low;
+    return static_cast<uint64_t>( words[ 0 ] ) << 32 | words[ 1 ];
 }
 
 int16_t BinaryReader::ReadInt16( )
@@ -224,24 +235,11 @@ int64_t BinaryReader::ReadInt64( )
 
 float BinaryReader::ReadFloat( )
 {
-    if ( !IsStreamValid( ) || !TrackReadBytes( 1 ) )
-    {
-        return 0.0f;
-    }
-
-    const uint32_t intValue = ReadUInt32( );
-    float          result;
-    std::memcpy( &result, &intValue, sizeof( float ) );
-    return result;
+    return ReadValue<float>( );
 }
 
 double BinaryReader::ReadDouble( )
 {
-    if ( !IsStreamValid( ) || !TrackReadBytes( 1 ) )
-    {
-        return 0.0f;
-    }
-
     const uint64_t intValue = ReadUInt64( );
     double         result;
     std::memcpy( &result, &intValue, sizeof( double ) );
@@ -257,9 +255,7 @@ InteropString BinaryReader::ReadString( )
     }
 
     std::vector<char> buffer( length + 1 /* + \0*/, 0 );
-    m_stream->read( buffer.data( ), length );
-
-    if ( static_cast<uint32_t>( m_stream->gcount( ) ) != length )
+    if ( ReadRaw( reinterpret_cast<Byte *>( buffer.data( ) ), length ) != length )
     {
         spdlog::error( "Failed to read full string, expected {} bytes", length );
     }
@@ -269,104 +265,83 @@ InteropString BinaryReader::ReadString( )
 
 UInt16_2 BinaryReader::ReadUInt16_2( )
 {
-    return { ReadUInt16( ), ReadUInt16( ) };
+    return ReadValue<UInt16_2>( );
 }
 
 UInt16_3 BinaryReader::ReadUInt16_3( )
 {
-    return { ReadUInt16( ), ReadUInt16( ), ReadUInt16( ) };
+    return ReadValue<UInt16_3>( );
 }
 
 UInt16_4 BinaryReader::ReadUInt16_4( )
 {
-    return { ReadUInt16( ), ReadUInt16( ), ReadUInt16( ), ReadUInt16( ) };
+    return ReadValue<UInt16_4>( );
 }
 
 Int16_2 BinaryReader::ReadInt16_2( )
 {
-    return { ReadInt16( ), ReadInt16( ) };
+    return ReadValue<Int16_2>( );
 }
 
 Int16_3 BinaryReader::ReadInt16_3( )
 {
-    return { ReadInt16( ), ReadInt16( ), ReadInt16( ) };
+    return ReadValue<Int16_3>( );
 }
 
 Int16_4 BinaryReader::ReadInt16_4( )
 {
-    return { ReadInt16( ), ReadInt16( ), ReadInt16( ), ReadInt16( ) };
+    return ReadValue<Int16_4>( );
 }
 
 UInt32_2 BinaryReader::ReadUInt32_2( )
 {
-    return { ReadUInt32( ), ReadUInt32( ) };
+    return ReadValue<UInt32_2>( );
 }
 
 UInt32_3 BinaryReader::ReadUInt32_3( )
 {
-    return { ReadUInt32( ), ReadUInt32( ), ReadUInt32( ) };
+    return ReadValue<UInt32_3>( );
 }
 
 UInt32_4 BinaryReader::ReadUInt32_4( )
 {
-    return { ReadUInt32( ), ReadUInt32( ), ReadUInt32( ), ReadUInt32( ) };
+    return ReadValue<UInt32_4>( );
 }
 
 Int32_2 BinaryReader::ReadInt32_2( )
 {
-    return { ReadInt32( ), ReadInt32( ) };
+    return ReadValue<Int32_2>( );
 }
 
 Int32_3 BinaryReader::ReadInt32_3( )
 {
-    return { ReadInt32( ), ReadInt32( ), ReadInt32( ) };
+    return ReadValue<Int32_3>( );
 }
 
 Int32_4 BinaryReader::ReadInt32_4( )
 {
-    return { ReadInt32( ), ReadInt32( ), ReadInt32( ), ReadInt32( ) };
+    return ReadValue<Int32_4>( );
 }
 
 Float_2 BinaryReader::ReadFloat_2( )
 {
-    return { ReadFloat( ), ReadFloat( ) };
+    return ReadValue<Float_2>( );
 }
 
 Float_3 BinaryReader::ReadFloat_3( )
 {
-    return { ReadFloat( ), ReadFloat( ), ReadFloat( ) };
+    return ReadValue<Float_3>( );
 }
 
 Float_4 BinaryReader::ReadFloat_4( )
 {
-    return { ReadFloat( ), ReadFloat( ), ReadFloat( ), ReadFloat( ) };
+    return ReadValue<Float_4>( );
 }
 
 Float_4x4 BinaryReader::ReadFloat_4x4( )
 {
-    Float_4x4 result{ };
-
-    result._11 = ReadFloat( );
-    result._12 = ReadFloat( );
-    result._13 = ReadFloat( );
-    result._14 = ReadFloat( );
-
-    result._21 = ReadFloat( );
-    result._22 = ReadFloat( );
-    result._23 = ReadFloat( );
-    result._24 = ReadFloat( );
-
-    result._31 = ReadFloat( );
-    result._32 = ReadFloat( );
-    result._33 = ReadFloat( );
-    result._34 = ReadFloat( );
-
-    result._41 = ReadFloat( );
-    result._42 = ReadFloat( );
-    result._43 = ReadFloat( );
-    result._44 = ReadFloat( );
-
-    return result;
+    // Written row by row in member order
+    return ReadValue<Float_4x4>( );
 }
 
 uint64_t BinaryReader::Position( ) const
@@ -375,6 +350,10 @@ uint64_t BinaryReader::Position( ) const
     {
         return 0;
     }
+    if ( IsMemoryBacked( ) )
+    {
+        return m_dataPosition;
+    }
     return m_stream->tellg( );
 }
 
@@ -384,6 +363,12 @@ void BinaryReader::Seek( const uint64_t position ) const
     {
         return;
     }
+    if ( IsMemoryBacked( ) )
+    {
+        RefreshContainerView( );
+        m_dataPosition = std::min( position, m_dataNumBytes );
+        return;
+    }
     m_stream->seekg( position );
 }
 
@@ -399,7 +384,8 @@ void BinaryReader::Skip( const uint64_t count ) const
 
 bool BinaryReader::IsStreamValid( ) const
 {
-    if ( !m_isStreamValid || m_stream->eof( ) )
+    RefreshContainerView( );
+    if ( !m_isStreamValid || ( IsMemoryBacked( ) ? m_dataPosition >= m_dataNumBytes : m_stream->eof( ) ) )
     {
         spdlog::error( "Attempted to read string beyond end of file" );
         return false;
@@ -408,7 +394,47 @@ bool BinaryReader::IsStreamValid( ) const
     return true;
 }
 
-bool BinaryReader::TrackReadBytes( const uint32_t requested )
+bool BinaryReader::IsMemoryBacked( ) const
+{
+    return m_stream == nullptr;
+}
+
+bool BinaryReader::ReadExactSlow( Byte *destination, const uint64_t count )
+{
+    if ( count == 0 )
+    {
+        return true;
+    }
+    if ( !IsStreamValid( ) || !TrackReadBytes( count ) )
+    {
+        return false;
+    }
+    if ( const uint64_t numRead = ReadRaw( destination, count ); numRead != count )
+    {
+        spdlog::error( "Failed to read {} bytes, only {} were available", count, numRead );
+        return false;
+    }
+    return true;
+}
+
+uint64_t BinaryReader::ReadRaw( Byte *destination, const uint64_t count )
+{
+    if ( IsMemoryBacked( ) )
+    {
+        const uint64_t numBytes = std::min<uint64_t>( count, m_dataNumBytes - m_dataPosition );
+        if ( numBytes > 0 )
+        {
+            std::memcpy( destination, m_data + m_dataPosition, numBytes );
+        }
+        m_dataPosition += numBytes;
+        return numBytes;
+    }
+
+    m_stream->read( reinterpret_cast<char *>( destination ), static_cast<std::streamsize>( count ) );
+    return static_cast<uint64_t>( m_stream->gcount( ) );
+}
+
+bool BinaryReader::TrackReadBytes( const uint64_t requested )
 {
     // 0 is all
     if ( m_allowedNumBytes > 0 )
@@ -440,7 +466,12 @@ void BinaryReader::LogAsCppArray( const InteropString &variableName ) const
     int               count        = 0;
     constexpr int     bytesPerLine = 16;
 
-    while ( m_stream->get( byte ) )
+    if ( IsMemoryBacked( ) )
+    {
+        RefreshContainerView( );
+        buffer.assign( m_data, m_data + m_dataNumBytes );
+    }
+    while ( !IsMemoryBacked( ) && m_stream->get( byte ) )
     {
         buffer.push_back( static_cast<Byte>( byte ) );
     }
@@ -487,7 +518,12 @@ void BinaryReader::WriteCppArrayToFile( const InteropString &targetFile ) const
     int               count        = 0;
     constexpr int     bytesPerLine = 16;
 
-    while ( m_stream->get( byte ) )
+    if ( IsMemoryBacked( ) )
+    {
+        RefreshContainerView( );
+        buffer.assign( m_data, m_data + m_dataNumBytes );
+    }
+    while ( !IsMemoryBacked( ) && m_stream->get( byte ) )
     {
         buffer.push_back( static_cast<Byte>( byte ) );
     }
@@ -508,6 +544,9 @@ void BinaryReader::WriteCppArrayToFile( const InteropString &targetFile ) const
     outputFile << "\n};";
     outputFile.flush( );
     outputFile.close( );
-    m_stream->clear( );
+    if ( !IsMemoryBacked( ) )
+    {
+        m_stream->clear( );
+    }
     Seek( currentPos );
 }
@@ -35,7 +35,7 @@ BinaryWriter::BinaryWriter( std::ostream *stream, const BinaryWriterDesc &desc )
 
 BinaryWriter::BinaryWriter( BinaryContainer &container, const BinaryWriterDesc &desc ) : m_desc( desc )
 {
-    m_stream        = &container.m_stream;
+    m_container     = &container;
     m_isStreamOwned = false;
     m_isStreamValid = true;
 }
@@ -71,7 +71,7 @@ void BinaryWriter::WriteByte( const Byte value ) const
     {
         return;
     }
-    m_stream->put( static_cast<char>( value ) );
+    WriteRaw( &value, 1 );
 }
 
 void BinaryWriter::Write( const ByteArrayView &buffer, const uint32_t offset, const uint32_t count ) const
@@ -81,7 +81,7 @@ void BinaryWriter::Write( const ByteArrayView &buffer, const uint32_t offset, co
         return;
     }
 
-    m_stream->write( reinterpret_cast<const char *>( buffer.Elements + offset ), count );
+    WriteRaw( buffer.Elements + offset, count );
 }
 
 void BinaryWriter::WriteBytes( const ByteArrayView &buffer ) const
@@ -99,7 +99,7 @@ void BinaryWriter::WriteUInt16( const uint16_t value ) const
     Byte bytes[ 2 ];
     bytes[ 0 ] = static_cast<Byte>( value & 0xFF );
     bytes[ 1 ] = static_cast<Byte>( value >> 8 & 0xFF );
-    m_stream->write( reinterpret_cast<const char *>( bytes ), 2 );
+    WriteRaw( bytes, 2 );
 }
 
 void BinaryWriter::WriteUInt32( const uint32_t value ) const
@@ -115,7 +115,7 @@ void BinaryWriter::WriteUInt32( const uint32_t value ) const
     bytes[ 2 ] = static_cast<Byte>( value >> 16 & 0xFF );
     bytes[ 3 ] = static_cast<Byte>( value >> 24 & 0xFF );
 
-    m_stream->write( reinterpret_cast<const char *>( bytes ), 4 );
+    WriteRaw( bytes, 4 );
 }
 
 void BinaryWriter::WriteUInt64( const uint64_t value ) const
@@ -169,7 +169,7 @@ void BinaryWriter::WriteString( const InteropString &value ) const
         return;
     }
 
-    m_stream->write( str, length );
+    WriteRaw( reinterpret_cast<const Byte *>( str ), length );
 }
 
 void BinaryWriter::WriteUInt16_2( const UInt16_2 &value ) const
@@ -306,6 +306,10 @@ uint64_t BinaryWriter::Position( ) const
     {
         return 0;
     }
+    if ( m_container != nullptr )
+    {
+        return m_containerPosition;
+    }
     return m_stream->tellp( );
 }
 
@@ -315,6 +319,11 @@ void BinaryWriter::Seek( const uint64_t position ) const
     {
         return;
     }
+    if ( m_container != nullptr )
+    {
+        m_containerPosition = position;
+        return;
+    }
     m_stream->seekp( static_cast<long long>( position ) );
 }
 
@@ -324,5 +333,19 @@ void BinaryWriter::Flush( ) const
     {
         return;
     }
-    m_stream->flush( );
+    if ( m_container == nullptr )
+    {
+        m_stream->flush( );
+    }
+}
+
+void BinaryWriter::WriteRaw( const Byte *data, const uint64_t count ) const
+{
+    if ( m_container != nullptr )
+    {
+        m_container->WriteAt( m_containerPosition, data, count );
+        m_containerPosition += count;
+        return;
+    }
+    m_stream->write( reinterpret_cast<const char *>( data ), static_cast<std::streamsize>( count ) );
 }
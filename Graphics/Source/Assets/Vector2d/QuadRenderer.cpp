@@ -18,8 +18,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphics/Assets/Vector2d/QuadRenderer.h"
 #include <algorithm>
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
 #include "DenOfIzGraphics/Data/BatchResourceCopy.h"
-#include "DenOfIzGraphics/Utilities/InteropUtilities.h"
 #include "DenOfIzGraphicsInternal/Utilities/InteropMathConverter.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 #include "DenOfIzGraphicsInternal/Utilities/Utilities.h"
@@ -29,77 +29,6 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 using namespace DenOfIz;
 using namespace DirectX;
 
-static auto QuadVertexShader = R"(
-struct VertexInput
-{
-    float3 Position : POSITION;
-    float2 TexCoord : TEXCOORD0;
-};
-
-struct InstanceData
-{
-    float4x4 Transform;
-    float4 UVScaleOffset;
-    uint TextureIndex;
-    float4 Color;
-    float3 _Pad0;
-};
-
-struct VertexOutput
-{
-    float4 Position : SV_Position;
-    float2 TexCoord : TEXCOORD0;
-    uint TextureIndex : TEXCOORD1;
-    float4 Color : TEXCOORD2;
-};
-
-StructuredBuffer<InstanceData> Instances : register(t0);
-cbuffer FrameConstants : register(b0)
-{
-    float4x4 Projection;
-};
-
-VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
-{
-    VertexOutput output;
-    InstanceData instance = Instances[instanceID];
-    float4 worldPos = mul(float4(input.Position, 1.0), instance.Transform);
-    output.Position = mul(worldPos, Projection);
-    output.TexCoord = input.TexCoord * instance.UVScaleOffset.xy + instance.UVScaleOffset.zw;
-    output.TextureIndex = instance.TextureIndex;
-    output.Color = instance.Color;
-    return output;
-}
-)";
-
-static auto RasterPixelShader = R"(
-struct PixelInput
-{
-    float4 Position : SV_Position;
-    float2 TexCoord : TEXCOORD0;
-    uint TextureIndex : TEXCOORD1;
-    float4 Color : TEXCOORD2;
-};
-
-// Bindless texture array
-Texture2D<float4> g_Textures[] : register(t0, space1);
-SamplerState g_Sampler : register(s0, space1);
-
-float4 main(PixelInput input) : SV_Target
-{
-    if (input.TextureIndex == 0) // 0 means no texture (null texture)
-    {
-        return input.Color;
-    }
-    
-    // Use dynamic indexing with the bindless texture array
-    float4 texColor = g_Textures[input.TextureIndex].Sample(g_Sampler, input.TexCoord);
-    
-    // Multiply with vertex color for tinting
-    return texColor * input.Color;
-}
-)";
-
 QuadRenderer::QuadRenderer( const QuadRendererDesc &desc ) : m_desc( desc )
 {
     DZ_NOT_NULL( desc.LogicalDevice );
@@ -212,32 +141,7 @@ void QuadRenderer::SetCanvas( const uint32_t width, const uint32_t height )
 
 void QuadRenderer::CreateShaderResources( )
 {
-    std::array<ShaderStageDesc, 2> shaderStages( { } );
-
-    ShaderStageDesc &vertexShaderDesc = shaderStages[ 0 ];
-    vertexShaderDesc.Stage            = ShaderStage::Vertex;
-    vertexShaderDesc.EntryPoint       = "main";
-    vertexShaderDesc.Data             = InteropUtilities::StringToBytes( QuadVertexShader );
-
-    ShaderStageDesc &pixelShaderDesc = shaderStages[ 1 ];
-    pixelShaderDesc.Stage            = ShaderStage::Pixel;
-    pixelShaderDesc.EntryPoint       = "main";
-    pixelShaderDesc.Data             = InteropUtilities::StringToBytes( RasterPixelShader );
-
-    std::array<BindlessSlot, 1> bindlessSlots{ };
-    bindlessSlots[ 0 ].RegisterSpace = 1;
-    bindlessSlots[ 0 ].Binding       = 0;
-    bindlessSlots[ 0 ].MaxArraySize  = m_desc.MaxNumTextures;
-
-    pixelShaderDesc.Bindless.BindlessArrays.Elements    = bindlessSlots.data( );
-    pixelShaderDesc.Bindless.BindlessArrays.NumElements = bindlessSlots.size( );
-
-    ShaderProgramDesc shaderProgramDesc{ };
-    shaderProgramDesc.ShaderStages.NumElements = shaderStages.size( );
-    shaderProgramDesc.ShaderStages.Elements    = shaderStages.data( );
-    m_shaderProgram                            = std::make_unique<ShaderProgram>( shaderProgramDesc );
-    std::free( vertexShaderDesc.Data.Elements );
-    std::free( pixelShaderDesc.Data.Elements );
+    m_shaderProgram = std::unique_ptr<ShaderProgram>( EngineShaders::CreateProgram( { EngineShader::Quad, m_desc.MaxNumTextures } ) );
 
     const ShaderReflectDesc reflectDesc = m_shaderProgram->Reflect( );
     m_rootSignature                     = std::unique_ptr<IRootSignature>( m_logicalDevice->CreateRootSignature( reflectDesc.RootSignature ) );
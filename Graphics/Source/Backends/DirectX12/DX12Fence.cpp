@@ -39,6 +39,11 @@ void DX12Fence::Wait( )
     }
 }
 
+bool DX12Fence::IsSignaled( )
+{
+    return m_fence->GetCompletedValue( ) >= m_fenceValue;
+}
+
 void DX12Fence::Reset( )
 {
     ++m_fenceValue;
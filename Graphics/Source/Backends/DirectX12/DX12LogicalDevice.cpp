@@ -17,6 +17,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphicsInternal/Backends/DirectX12/DX12LogicalDevice.h"
+#include "DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h"
 #include "DenOfIzGraphicsInternal/Backends/Common/SDLInclude.h"
 #include "DenOfIzGraphicsInternal/Backends/DirectX12/DX12CommandQueue.h"
 #include "DenOfIzGraphicsInternal/Backends/DirectX12/DX12InputLayout.h"
@@ -38,6 +39,7 @@ DX12LogicalDevice::DX12LogicalDevice( )
 
 DX12LogicalDevice::~DX12LogicalDevice( )
 {
+    GpuResourceLoader::ReleaseShared( this );
     WaitIdle( );
 }
 
@@ -39,6 +39,15 @@ void MetalFence::Wait( )
     }
 }
 
+bool MetalFence::IsSignaled( )
+{
+    if ( m_submitted && dispatch_semaphore_wait( m_fence, DISPATCH_TIME_NOW ) == 0 )
+    {
+        m_submitted = false;
+    }
+    return !m_submitted;
+}
+
 void MetalFence::Reset( )
 {
     m_submitted = true;
@@ -19,6 +19,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #import "Metal/Metal.h"
 #define IR_PRIVATE_IMPLEMENTATION
 #import "DenOfIzGraphicsInternal/Backends/Metal/MetalLogicalDevice.h"
+#import "DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h"
 #import "DenOfIzGraphicsInternal/Backends/Metal/MetalCommandQueue.h"
 #import "DenOfIzGraphicsInternal/Backends/Metal/RayTracing/MetalBottomLevelAS.h"
 #import "DenOfIzGraphicsInternal/Backends/Metal/RayTracing/MetalShaderBindingTable.h"
@@ -36,6 +37,7 @@ MetalLogicalDevice::MetalLogicalDevice( )
 
 MetalLogicalDevice::~MetalLogicalDevice( )
 {
+    GpuResourceLoader::ReleaseShared( this );
 }
 
 void MetalLogicalDevice::CreateDevice( )
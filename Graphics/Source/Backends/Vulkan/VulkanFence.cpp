@@ -38,6 +38,11 @@ void VulkanFence::Reset( )
     VK_CHECK_RESULT( vkResetFences( m_context->LogicalDevice, 1, &m_fence ) );
 }
 
+bool VulkanFence::IsSignaled( )
+{
+    return vkGetFenceStatus( m_context->LogicalDevice, m_fence ) == VK_SUCCESS;
+}
+
 VulkanFence::~VulkanFence( )
 {
     vkDestroyFence( m_context->LogicalDevice, m_fence, nullptr );
@@ -18,6 +18,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphicsInternal/Backends/Vulkan/VulkanLogicalDevice.h"
 #include <algorithm>
+#include "DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h"
 #include "DenOfIzGraphicsInternal/Backends/Vulkan/RayTracing/VulkanBottomLevelAS.h"
 #include "DenOfIzGraphicsInternal/Backends/Vulkan/RayTracing/VulkanShaderBindingTable.h"
 #include "DenOfIzGraphicsInternal/Backends/Vulkan/RayTracing/VulkanShaderLocalData.h"
@@ -619,6 +620,7 @@ void VulkanLogicalDevice::WaitIdle( )
 
 VulkanLogicalDevice::~VulkanLogicalDevice( )
 {
+    GpuResourceLoader::ReleaseShared( this );
     DestroyDebugUtils( );
 
     if ( m_context == nullptr )
@@ -22,17 +22,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 using namespace DenOfIz;
 
-BatchResourceCopy::BatchResourceCopy( ILogicalDevice *device, const bool issueBarriers ) : m_device( device ), m_issueBarriers( issueBarriers )
+BatchResourceCopy::BatchResourceCopy( ILogicalDevice *device, const bool issueBarriers, GpuResourceLoader *loader ) :
+    m_device( device ), m_loader( loader ? loader : GpuResourceLoader::Shared( device ) ), m_issueBarriers( issueBarriers )
 {
-    m_copyQueue = std::unique_ptr<ICommandQueue>( m_device->CreateCommandQueue( CommandQueueDesc{ QueueType::Copy } ) );
-
-    m_commandListPool = std::unique_ptr<ICommandListPool>( m_device->CreateCommandListPool( { m_copyQueue.get( ) } ) );
-    auto commandLists = m_commandListPool->GetCommandLists( );
-    DZ_ASSERTM( commandLists.NumElements != 0, "Command list pool did not produce any command lists." );
-
-    m_copyCommandList = commandLists.Elements[ 0 ];
-    m_executeFence    = std::unique_ptr<IFence>( m_device->CreateFence( ) );
-
     if ( m_issueBarriers )
     {
         m_syncQueue = std::unique_ptr<ICommandQueue>( m_device->CreateCommandQueue( CommandQueueDesc{ QueueType::Graphics } ) );
@@ -43,24 +35,17 @@ BatchResourceCopy::BatchResourceCopy( ILogicalDevice *device, const bool issueBa
         m_syncCommandPool        = std::unique_ptr<ICommandListPool>( m_device->CreateCommandListPool( poolDesc ) );
 
         m_syncCommandList = m_syncCommandPool->GetCommandLists( ).Elements[ 0 ];
-        m_batchCopyWait   = std::unique_ptr<ISemaphore>( m_device->CreateSemaphore( ) );
         m_syncWait        = std::unique_ptr<IFence>( m_device->CreateFence( ) );
     }
 }
 
 BatchResourceCopy::~BatchResourceCopy( )
 {
-    if ( m_issueBarriers )
-    {
-        m_cleanResourcesFuture.wait( );
-        m_executeFence.reset( );
-    }
-    m_commandListPool.reset( );
+    m_loader->WaitForUpdate( UpdateHandle{ m_lastUpdate.load( ) } ); // Queued but never submitted
 }
 
 void BatchResourceCopy::Begin( ) const
 {
-    m_copyCommandList->Begin( );
     if ( m_issueBarriers )
     {
         m_syncCommandList->Begin( );
@@ -69,47 +54,39 @@ void BatchResourceCopy::Begin( ) const
 
 void BatchResourceCopy::CopyToGPUBuffer( const CopyToGpuBufferDesc &copyDesc )
 {
-    BufferDesc stagingBufferDesc{ };
-    stagingBufferDesc.HeapType     = HeapType::CPU_GPU;
-    stagingBufferDesc.InitialUsage = ResourceUsage::CopySrc;
-    stagingBufferDesc.NumBytes     = Utilities::Align( copyDesc.Data.NumElements, m_device->DeviceInfo( ).Constants.ConstantBufferAlignment );
-    stagingBufferDesc.DebugName    = "CopyToGPUBuffer_StagingBuffer";
-
-    const auto stagingBuffer = m_device->CreateBufferResource( stagingBufferDesc );
-    memcpy( stagingBuffer->MapMemory( ), copyDesc.Data.Elements, copyDesc.Data.NumElements );
-    stagingBuffer->UnmapMemory( );
-
-    CopyBufferRegionDesc copyBufferRegionDesc{ };
-    copyBufferRegionDesc.DstBuffer = copyDesc.DstBuffer;
-    copyBufferRegionDesc.SrcBuffer = stagingBuffer;
-    copyBufferRegionDesc.DstOffset = copyDesc.DstBufferOffset;
-    copyBufferRegionDesc.NumBytes  = copyDesc.Data.NumElements;
-
-    CopyBufferRegion( copyBufferRegionDesc );
-
-    std::lock_guard lock( m_resourceCleanLock );
-    m_resourcesToClean.push_back( std::unique_ptr<IBufferResource>( stagingBuffer ) );
+    if ( copyDesc.Data.NumElements == 0 )
+    {
+        return;
+    }
+
+    BufferUpdateDesc updateDesc{ };
+    updateDesc.Buffer          = copyDesc.DstBuffer;
+    updateDesc.DstOffset       = copyDesc.DstBufferOffset;
+    updateDesc.SourceData.Data = copyDesc.Data;
+
+    UpdateHandle handle{ };
+    m_loader->QueueResourceUpdate( updateDesc, &handle );
+    TrackUpdate( handle );
 }
 
-void BatchResourceCopy::CopyBufferRegion( const CopyBufferRegionDesc &copyDesc ) const
+void BatchResourceCopy::CopyBufferRegion( const CopyBufferRegionDesc &copyDesc )
 {
-    m_copyCommandList->CopyBufferRegion( copyDesc );
+    StagedCopyDesc stagedDesc{ };
+    stagedDesc.Record = [ &copyDesc ]( const StagedCopy &staged ) { staged.CommandList->CopyBufferRegion( copyDesc ); };
+    QueueStagedCopy( stagedDesc );
 }
 
-void BatchResourceCopy::CopyTextureRegion( const CopyTextureRegionDesc &copyDesc ) const
+void BatchResourceCopy::CopyTextureRegion( const CopyTextureRegionDesc &copyDesc )
 {
-    m_copyCommandList->CopyTextureRegion( copyDesc );
+    StagedCopyDesc stagedDesc{ };
+    stagedDesc.Record = [ &copyDesc ]( const StagedCopy &staged ) { staged.CommandList->CopyTextureRegion( copyDesc ); };
+    QueueStagedCopy( stagedDesc );
 }
 
 void BatchResourceCopy::CopyDataToTexture( const CopyDataToTextureDesc &copyDesc )
 {
-    BufferDesc stagingBufferDesc{ };
-    stagingBufferDesc.HeapType     = HeapType::CPU_GPU;
-    stagingBufferDesc.InitialUsage = ResourceUsage::CopySrc;
-    stagingBufferDesc.NumBytes     = copyDesc.Data.NumElements;
-    stagingBufferDesc.DebugName    = "CopyDataToTexture_StagingBuffer";
-
-    const uint32_t bitSize = FormatNumBytes( copyDesc.DstTexture->GetFormat( ) );
+    uint64_t       numBytes = copyDesc.Data.NumElements;
+    const uint32_t bitSize  = FormatNumBytes( copyDesc.DstTexture->GetFormat( ) );
     if ( copyDesc.AutoAlign )
     {
         if ( copyDesc.Width == 0 || copyDesc.Height == 0 )
@@ -120,32 +97,35 @@ void BatchResourceCopy::CopyDataToTexture( const CopyDataToTextureDesc &copyDesc
 
         const uint32_t alignedRowPitch   = Utilities::Align( copyDesc.Width * bitSize, m_device->DeviceInfo( ).Constants.BufferTextureRowAlignment );
         const uint32_t alignedSlicePitch = Utilities::Align( alignedRowPitch * copyDesc.Height, GetSubresourceAlignment( bitSize ) );
-        stagingBufferDesc.NumBytes       = alignedSlicePitch;
+        numBytes                         = alignedSlicePitch;
     }
 
-    const auto stagingBuffer = m_device->CreateBufferResource( stagingBufferDesc );
-    void      *dst           = stagingBuffer->MapMemory( );
-    if ( copyDesc.AutoAlign )
+    StagedCopyDesc stagedDesc{ };
+    stagedDesc.NumBytes  = numBytes;
+    stagedDesc.Alignment = GetSubresourceAlignment( bitSize );
+    stagedDesc.Fill      = [ & ]( const StagedCopy &staged )
     {
-        AlignDataForTexture( copyDesc.Data.Elements, copyDesc.Width, copyDesc.Height, bitSize, static_cast<Byte *>( dst ) );
-    }
-    else
+        if ( copyDesc.AutoAlign )
+        {
+            AlignDataForTexture( copyDesc.Data.Elements, copyDesc.Width, copyDesc.Height, bitSize, staged.Data );
+        }
+        else
+        {
+            memcpy( staged.Data, copyDesc.Data.Elements, copyDesc.Data.NumElements );
+        }
+    };
+    stagedDesc.Record = [ & ]( const StagedCopy &staged )
     {
-        memcpy( dst, copyDesc.Data.Elements, copyDesc.Data.NumElements );
-    }
-
-    stagingBuffer->UnmapMemory( );
-
-    CopyBufferToTextureDesc copyBufferToTextureDesc{ };
-    copyBufferToTextureDesc.DstTexture = copyDesc.DstTexture;
-    copyBufferToTextureDesc.SrcBuffer  = stagingBuffer;
-    copyBufferToTextureDesc.Format     = FormatToTypeless( copyDesc.DstTexture->GetFormat( ) );
-    copyBufferToTextureDesc.MipLevel   = copyDesc.MipLevel;
-    copyBufferToTextureDesc.ArrayLayer = copyDesc.ArrayLayer;
-    m_copyCommandList->CopyBufferToTexture( copyBufferToTextureDesc );
-
-    std::lock_guard lock( m_resourceCleanLock );
-    m_resourcesToClean.push_back( std::unique_ptr<IBufferResource>( stagingBuffer ) );
+        CopyBufferToTextureDesc copyBufferToTextureDesc{ };
+        copyBufferToTextureDesc.DstTexture = copyDesc.DstTexture;
+        copyBufferToTextureDesc.SrcBuffer  = staged.Buffer;
+        copyBufferToTextureDesc.SrcOffset  = staged.Offset;
+        copyBufferToTextureDesc.Format     = FormatToTypeless( copyDesc.DstTexture->GetFormat( ) );
+        copyBufferToTextureDesc.MipLevel   = copyDesc.MipLevel;
+        copyBufferToTextureDesc.ArrayLayer = copyDesc.ArrayLayer;
+        staged.CommandList->CopyBufferToTexture( copyBufferToTextureDesc );
+    };
+    QueueStagedCopy( stagedDesc );
 }
 
 ITextureResource *BatchResourceCopy::CreateAndLoadTexture( const InteropString &file )
@@ -329,22 +309,28 @@ void BatchResourceCopy::LoadAssetTexture( const LoadAssetTextureDesc &loadDesc )
         return;
     }
 
-    BufferDesc stagingBufferDesc   = { };
-    stagingBufferDesc.HeapType     = HeapType::CPU_GPU;
-    stagingBufferDesc.InitialUsage = ResourceUsage::CopySrc;
-    stagingBufferDesc.DebugName    = "LoadAssetTexture_StagingBuffer";
-    stagingBufferDesc.NumBytes     = loadDesc.Reader->AlignedTotalNumBytes( m_device->DeviceInfo( ).Constants );
-
-    const auto             stagingBuffer = m_device->CreateBufferResource( stagingBufferDesc );
-    LoadIntoGpuTextureDesc readerLoadDesc{ };
-    readerLoadDesc.Texture       = loadDesc.DstTexture;
-    readerLoadDesc.CommandList   = m_copyCommandList;
-    readerLoadDesc.StagingBuffer = stagingBuffer;
-
-    loadDesc.Reader->LoadIntoGpuTexture( readerLoadDesc );
-
-    std::lock_guard lock( m_resourceCleanLock );
-    m_resourcesToClean.push_back( std::unique_ptr<IBufferResource>( stagingBuffer ) );
+    const DeviceConstants &constants = m_device->DeviceInfo( ).Constants;
+    const uint64_t         numBytes  = loadDesc.Reader->AlignedTotalNumBytes( constants, loadDesc.FirstMip );
+    const auto readerLoadDesc = [ & ]( const StagedCopy &staged )
+    {
+        LoadIntoGpuTextureDesc readerLoadDesc{ };
+        readerLoadDesc.Texture             = loadDesc.DstTexture;
+        readerLoadDesc.CommandList         = staged.CommandList;
+        readerLoadDesc.StagingBuffer       = staged.Buffer;
+        readerLoadDesc.StagingBufferOffset = staged.Offset;
+        readerLoadDesc.MappedStagingBuffer = staged.Data - staged.Offset;
+        readerLoadDesc.Constants           = constants;
+        readerLoadDesc.FirstMip            = loadDesc.FirstMip;
+        return readerLoadDesc;
+    };
+
+    // The mips are read from disk without holding the loader, only recording the copies does
+    StagedCopyDesc stagedDesc{ };
+    stagedDesc.NumBytes  = numBytes;
+    stagedDesc.Alignment = std::max( 1u, constants.BufferTextureAlignment );
+    stagedDesc.Fill      = [ & ]( const StagedCopy &staged ) { loadDesc.Reader->ReadIntoStagingBuffer( readerLoadDesc( staged ) ); };
+    stagedDesc.Record    = [ & ]( const StagedCopy &staged ) { loadDesc.Reader->RecordGpuTextureCopies( readerLoadDesc( staged ) ); };
+    QueueStagedCopy( stagedDesc );
 
     if ( m_issueBarriers )
     {
@@ -395,95 +381,86 @@ void BatchResourceCopy::LoadAssetStreamToBuffer( const LoadAssetStreamToBufferDe
 
 void BatchResourceCopy::Submit( ISemaphore *notify )
 {
-    m_copyCommandList->End( );
-
-    uint32_t                    numSignalSemaphores = 1;
-    std::array<ISemaphore *, 2> signalSemaphores( { } );
-    signalSemaphores[ 0 ] = m_batchCopyWait.get( );
     if ( notify )
     {
-        signalSemaphores[ 1 ] = notify;
-        ++numSignalSemaphores;
+        FlushUpdatesDesc flushDesc{ };
+        flushDesc.SignalSemaphores.Elements    = &notify;
+        flushDesc.SignalSemaphores.NumElements = 1;
+        m_loader->FlushResourceUpdates( flushDesc );
     }
-
-    ExecuteCommandListsDesc desc{ };
-    m_executeFence->Reset( );
-    desc.Signal                       = m_executeFence.get( );
-    desc.SignalSemaphores.Elements    = signalSemaphores.data( );
-    desc.SignalSemaphores.NumElements = numSignalSemaphores;
-    desc.CommandLists.Elements        = &m_copyCommandList;
-    desc.CommandLists.NumElements     = 1;
-    m_copyQueue->ExecuteCommandLists( desc );
-    m_cleanResourcesFuture = std::async( std::launch::async, [ this ] { CleanResources( ); } );
+    // Submits the copies unless a flush already did, the barriers can only run once they are done
+    m_loader->WaitForUpdate( UpdateHandle{ m_lastUpdate.exchange( 0 ) } );
 
     if ( m_issueBarriers )
     {
-        std::array<ISemaphore *, 1> waitSemaphores( { } );
-        waitSemaphores[ 0 ] = m_batchCopyWait.get( );
         m_syncWait->Reset( );
         ExecuteCommandListsDesc syncDesc{ };
-        syncDesc.Signal                     = m_syncWait.get( );
-        syncDesc.WaitSemaphores.Elements    = waitSemaphores.data( );
-        syncDesc.WaitSemaphores.NumElements = waitSemaphores.size( );
-        syncDesc.CommandLists.Elements      = &m_syncCommandList;
-        syncDesc.CommandLists.NumElements   = 1;
+        syncDesc.Signal                   = m_syncWait.get( );
+        syncDesc.CommandLists.Elements    = &m_syncCommandList;
+        syncDesc.CommandLists.NumElements = 1;
         m_syncCommandList->End( );
         m_syncQueue->ExecuteCommandLists( syncDesc );
         m_syncWait->Wait( );
     }
 }
 
-void BatchResourceCopy::CleanResources( )
-{
-    std::lock_guard lock( m_resourceCleanLock );
-    m_executeFence->Wait( );
-    m_resourcesToClean.clear( );
-
-    for ( const auto &texture : m_freeTextures )
-    {
-        free( texture );
-    }
-}
-
 void BatchResourceCopy::LoadTextureInternal( const Texture &texture, ITextureResource *dstTexture )
 {
-    BufferDesc stagingBufferDesc   = { };
-    stagingBufferDesc.HeapType     = HeapType::CPU_GPU;
-    stagingBufferDesc.InitialUsage = ResourceUsage::CopySrc;
-    stagingBufferDesc.DebugName    = "LoadTexture_StagingBuffer";
-
+    uint64_t numBytes = 0;
     for ( uint32_t i = 0; i < texture.GetMipLevels( ); ++i )
     {
         const uint32_t mipRowPitch   = Utilities::Align( std::max( 1u, texture.GetRowPitch( ) >> i ), m_device->DeviceInfo( ).Constants.BufferTextureRowAlignment );
         const uint32_t mipNumRows    = std::max( 1u, texture.GetNumRows( ) >> i );
         const uint32_t mipSlicePitch = Utilities::Align( texture.GetDepth( ) * mipRowPitch * mipNumRows, m_device->DeviceInfo( ).Constants.BufferTextureAlignment );
-        stagingBufferDesc.NumBytes += mipSlicePitch;
+        numBytes += mipSlicePitch;
     }
 
-    const auto stagingBuffer       = m_device->CreateBufferResource( stagingBufferDesc );
-    const auto stagingMappedMemory = static_cast<Byte *>( stagingBuffer->MapMemory( ) );
-
-    const auto mipDataArray = texture.ReadMipData( );
-    for ( uint32_t i = 0; i < mipDataArray.NumElements; ++i )
+    const auto     mipDataArray = texture.ReadMipData( );
+    StagedCopyDesc stagedDesc{ };
+    stagedDesc.NumBytes  = numBytes;
+    stagedDesc.Alignment = GetSubresourceAlignment( texture.GetBitsPerPixel( ) );
+    stagedDesc.Fill      = [ & ]( const StagedCopy &staged )
     {
-        const TextureMip &mipData = mipDataArray.Elements[ i ];
-        CopyTextureToMemoryAligned( texture, mipData, stagingMappedMemory + mipData.DataOffset );
+        for ( uint32_t i = 0; i < mipDataArray.NumElements; ++i )
+        {
+            const TextureMip &mipData = mipDataArray.Elements[ i ];
+            CopyTextureToMemoryAligned( texture, mipData, staged.Data + mipData.DataOffset );
+        }
+    };
+    stagedDesc.Record = [ & ]( const StagedCopy &staged )
+    {
+        for ( uint32_t i = 0; i < mipDataArray.NumElements; ++i )
+        {
+            const TextureMip &mipData = mipDataArray.Elements[ i ];
+
+            CopyBufferToTextureDesc copyBufferToTextureDesc{ };
+            copyBufferToTextureDesc.DstTexture = dstTexture;
+            copyBufferToTextureDesc.SrcBuffer  = staged.Buffer;
+            copyBufferToTextureDesc.SrcOffset  = staged.Offset + mipData.DataOffset;
+            copyBufferToTextureDesc.Format     = dstTexture->GetFormat( );
+            copyBufferToTextureDesc.MipLevel   = mipData.MipIndex;
+            copyBufferToTextureDesc.ArrayLayer = mipData.ArrayIndex;
+            copyBufferToTextureDesc.RowPitch   = mipData.RowPitch;
+            copyBufferToTextureDesc.NumRows    = mipData.NumRows;
+            staged.CommandList->CopyBufferToTexture( copyBufferToTextureDesc );
+        }
+    };
+    QueueStagedCopy( stagedDesc );
+}
 
-        CopyBufferToTextureDesc copyBufferToTextureDesc{ };
-        copyBufferToTextureDesc.DstTexture = dstTexture;
-        copyBufferToTextureDesc.SrcBuffer  = stagingBuffer;
-        copyBufferToTextureDesc.SrcOffset  = mipData.DataOffset;
-        copyBufferToTextureDesc.Format     = dstTexture->GetFormat( );
-        copyBufferToTextureDesc.MipLevel   = mipData.MipIndex;
-        copyBufferToTextureDesc.ArrayLayer = mipData.ArrayIndex;
-        copyBufferToTextureDesc.RowPitch   = mipData.RowPitch;
-        copyBufferToTextureDesc.NumRows    = mipData.NumRows;
-        m_copyCommandList->CopyBufferToTexture( copyBufferToTextureDesc );
-    }
+void BatchResourceCopy::QueueStagedCopy( const StagedCopyDesc &copyDesc )
+{
+    UpdateHandle handle{ };
+    m_loader->QueueStagedCopy( copyDesc, &handle );
+    TrackUpdate( handle );
+}
 
-    stagingBuffer->UnmapMemory( );
-    std::lock_guard lock( m_resourceCleanLock );
-    m_resourcesToClean.push_back( std::unique_ptr<IBufferResource>( stagingBuffer ) );
+void BatchResourceCopy::TrackUpdate( const UpdateHandle handle )
+{
+    uint64_t lastUpdate = m_lastUpdate.load( );
+    while ( lastUpdate < handle.Value && !m_lastUpdate.compare_exchange_weak( lastUpdate, handle.Value ) )
+    {
+    }
 }
 
 void BatchResourceCopy::CopyTextureToMemoryAligned( const Texture &texture, const TextureMip &mipData, Byte *dst ) const
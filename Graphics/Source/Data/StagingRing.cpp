@@ -0,0 +1,113 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Data/StagingRing.h"
+#include <algorithm>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+StagingRing::StagingRing( const StagingRingDesc &desc ) : m_numBytes( desc.NumBytes )
+{
+    DZ_NOT_NULL( desc.Device );
+
+    BufferDesc bufferDesc{ };
+    bufferDesc.HeapType     = HeapType::CPU_GPU;
+    bufferDesc.InitialUsage = ResourceUsage::CopySrc;
+    bufferDesc.NumBytes     = m_numBytes;
+    bufferDesc.DebugName    = "StagingRing";
+    m_buffer                = std::unique_ptr<IBufferResource>( desc.Device->CreateBufferResource( bufferDesc ) );
+    m_mappedMemory          = static_cast<Byte *>( m_buffer->MapMemory( ) );
+}
+
+StagingRing::~StagingRing( )
+{
+    if ( !m_regions.empty( ) )
+    {
+        spdlog::error( "StagingRing destroyed while {} allocations are in use, the GpuResourceLoader using it must wait for its updates first", m_regions.size( ) );
+    }
+    m_buffer->UnmapMemory( );
+}
+
+uint64_t StagingRing::NumBytes( ) const
+{
+    return m_numBytes;
+}
+
+bool StagingRing::CanHold( const uint64_t numBytes ) const
+{
+    return numBytes <= m_numBytes / 4;
+}
+
+bool StagingRing::Allocate( const uint64_t numBytes, const uint64_t alignment, Allocation &allocation )
+{
+    std::lock_guard lock( m_mutex );
+    const uint64_t  align   = std::max<uint64_t>( 1, alignment );
+    const uint64_t  offset  = m_head % m_numBytes;
+    uint64_t        padding = ( offset + align - 1 ) / align * align - offset;
+    if ( offset + padding + numBytes > m_numBytes )
+    {
+        padding = m_numBytes - offset; // Wraps around to the start of the buffer, which is aligned to anything
+    }
+    if ( m_head - m_tail + padding + numBytes > m_numBytes )
+    {
+        return false;
+    }
+
+    const uint64_t begin = m_head;
+    m_head               = begin + padding + std::max<uint64_t>( 1, numBytes );
+    allocation.Buffer    = m_buffer.get( );
+    allocation.Offset    = ( begin + padding ) % m_numBytes;
+    allocation.Data      = m_mappedMemory + allocation.Offset;
+    allocation.Position  = begin;
+    m_regions.push_back( { begin, m_head } );
+    return true;
+}
+
+StagingRing::Region *StagingRing::FindRegion( const uint64_t position )
+{
+    const auto region = std::ranges::lower_bound( m_regions, position, { }, &Region::Begin );
+    return region != m_regions.end( ) && region->Begin == position ? &*region : nullptr;
+}
+
+void StagingRing::Release( const std::vector<uint64_t> &positions )
+{
+    std::lock_guard lock( m_mutex );
+    for ( const uint64_t position : positions )
+    {
+        if ( Region *region = FindRegion( position ); region != nullptr )
+        {
+            region->IsReleased = true;
+        }
+    }
+
+    while ( !m_regions.empty( ) && m_regions.front( ).IsReleased )
+    {
+        m_regions.pop_front( );
+    }
+    if ( m_regions.empty( ) )
+    {
+        m_head = 0; // Nothing in use, start over so the next allocations are contiguous
+        m_tail = 0;
+    }
+    else
+    {
+        m_tail = m_regions.front( ).Begin;
+    }
+}
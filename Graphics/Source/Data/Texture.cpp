@@ -125,7 +125,7 @@ void Texture::LoadTextureSTB( )
 {
     int width, height, channels;
 
-    const stbi_uc *contents = stbi_load( m_path.c_str( ), &width, &height, &channels, STBI_rgb_alpha );
+    stbi_uc *contents = stbi_load( m_path.c_str( ), &width, &height, &channels, STBI_rgb_alpha );
 
     if ( contents == nullptr )
     {
@@ -146,6 +146,8 @@ void Texture::LoadTextureSTB( )
     m_slicePitch   = m_rowPitch * m_numRows;
     m_data.resize( m_slicePitch );
     std::memcpy( m_data.data( ), contents, m_slicePitch );
+
+    stbi_image_free( contents );
 }
 
 Format GetFormatFromDDS( const dds::DXGI_FORMAT &format )
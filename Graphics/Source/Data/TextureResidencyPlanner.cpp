@@ -0,0 +1,210 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DenOfIzGraphics/Data/TextureResidencyPlanner.h"
+#include <algorithm>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    // Block compressed textures need a top mip with sides that are a multiple of the block size
+    bool CanStartAtMip( const TextureDesc &desc, const uint32_t mip )
+    {
+        if ( mip == 0 || !IsFormatBC( desc.Format ) )
+        {
+            return true;
+        }
+        const uint32_t blockSize = FormatBlockSize( desc.Format );
+        return std::max( 1u, desc.Width >> mip ) % blockSize == 0 && std::max( 1u, desc.Height >> mip ) % blockSize == 0;
+    }
+
+    // Rounds towards the full resolution mip until the texture can start there
+    uint32_t FinerValidMip( const TextureDesc &desc, uint32_t mip )
+    {
+        while ( !CanStartAtMip( desc, mip ) )
+        {
+            --mip;
+        }
+        return mip;
+    }
+} // namespace
+
+TextureResidencyPlanner::TextureResidencyPlanner( const TextureResidencyPlannerDesc &desc ) : m_desc( desc )
+{
+}
+
+TextureResidencyPlanner::PlannedTexture *TextureResidencyPlanner::FindTexture( const uint32_t index )
+{
+    if ( index >= m_textures.size( ) || !m_textures[ index ].IsUsed )
+    {
+        spdlog::error( "TextureResidencyPlanner: Invalid texture index {}", index );
+        return nullptr;
+    }
+    return &m_textures[ index ];
+}
+
+const TextureResidencyPlanner::PlannedTexture *TextureResidencyPlanner::FindTexture( const uint32_t index ) const
+{
+    return const_cast<TextureResidencyPlanner *>( this )->FindTexture( index );
+}
+
+void TextureResidencyPlanner::SetTexture( const uint32_t index, const TextureDesc &desc, const TextureMipArray &mips )
+{
+    if ( index >= m_textures.size( ) )
+    {
+        m_textures.resize( index + 1 );
+    }
+
+    PlannedTexture &texture = m_textures[ index ];
+    texture                 = PlannedTexture{ };
+    texture.IsUsed          = true;
+    texture.Desc            = desc;
+    texture.Desc.MipLevels  = std::max( 1u, desc.MipLevels );
+
+    const uint32_t mipLevels = texture.Desc.MipLevels;
+    texture.NumBytesFromMip.assign( mipLevels + 1, 0 );
+    for ( uint32_t i = 0; i < mips.NumElements; ++i )
+    {
+        if ( const TextureMip &mip = mips.Elements[ i ]; mip.MipIndex < mipLevels )
+        {
+            texture.NumBytesFromMip[ mip.MipIndex ] += mip.SlicePitch;
+        }
+    }
+    for ( uint32_t mip = mipLevels; mip-- > 0; )
+    {
+        texture.NumBytesFromMip[ mip ] += texture.NumBytesFromMip[ mip + 1 ];
+    }
+
+    uint32_t tailMip = 0;
+    while ( tailMip + 1 < mipLevels && std::max( desc.Width >> tailMip, desc.Height >> tailMip ) > m_desc.MaxTailSize )
+    {
+        ++tailMip;
+    }
+    texture.TailMip      = FinerValidMip( texture.Desc, tailMip );
+    texture.RequestedMip = texture.TailMip;
+    texture.TargetMip    = texture.TailMip;
+}
+
+void TextureResidencyPlanner::RemoveTexture( const uint32_t index )
+{
+    if ( PlannedTexture *texture = FindTexture( index ) )
+    {
+        *texture = PlannedTexture{ };
+    }
+}
+
+void TextureResidencyPlanner::RequestMip( const uint32_t index, const uint32_t mipLevel )
+{
+    PlannedTexture *texture = FindTexture( index );
+    if ( texture == nullptr )
+    {
+        return;
+    }
+
+    const uint32_t mip        = std::min( mipLevel, texture->TailMip );
+    texture->RequestedMip     = texture->LastRequestFrame == m_frame ? std::min( texture->RequestedMip, mip ) : mip;
+    texture->LastRequestFrame = m_frame;
+}
+
+void TextureResidencyPlanner::Plan( )
+{
+    ++m_frame;
+
+    uint64_t numBytes = 0;
+    for ( PlannedTexture &texture : m_textures )
+    {
+        if ( texture.IsUsed )
+        {
+            texture.TargetMip = FinerValidMip( texture.Desc, texture.RequestedMip );
+            numBytes += texture.NumBytesFromMip[ texture.TargetMip ];
+        }
+    }
+    if ( numBytes <= m_desc.MemoryBudget )
+    {
+        return;
+    }
+
+    // Over budget, the least recently requested textures fall back towards their tail first
+    std::vector<PlannedTexture *> leastRecentFirst;
+    for ( PlannedTexture &texture : m_textures )
+    {
+        if ( texture.IsUsed && texture.TargetMip < texture.TailMip )
+        {
+            leastRecentFirst.push_back( &texture );
+        }
+    }
+    std::ranges::stable_sort( leastRecentFirst, { }, &PlannedTexture::LastRequestFrame );
+    for ( PlannedTexture *texture : leastRecentFirst )
+    {
+        uint32_t mip = texture->TargetMip;
+        while ( numBytes > m_desc.MemoryBudget && mip < texture->TailMip )
+        {
+            // Skip mips the texture can't start at, the tail always can
+            do
+            {
+                ++mip;
+            }
+            while ( mip < texture->TailMip && !CanStartAtMip( texture->Desc, mip ) );
+            numBytes -= texture->NumBytesFromMip[ texture->TargetMip ] - texture->NumBytesFromMip[ mip ];
+            texture->TargetMip = mip;
+        }
+        if ( numBytes <= m_desc.MemoryBudget )
+        {
+            break;
+        }
+    }
+}
+
+uint32_t TextureResidencyPlanner::GetTargetMip( const uint32_t index ) const
+{
+    const PlannedTexture *texture = FindTexture( index );
+    return texture != nullptr ? texture->TargetMip : 0;
+}
+
+uint32_t TextureResidencyPlanner::GetTailMip( const uint32_t index ) const
+{
+    const PlannedTexture *texture = FindTexture( index );
+    return texture != nullptr ? texture->TailMip : 0;
+}
+
+uint64_t TextureResidencyPlanner::GetLastRequestFrame( const uint32_t index ) const
+{
+    const PlannedTexture *texture = FindTexture( index );
+    return texture != nullptr ? texture->LastRequestFrame : 0;
+}
+
+uint64_t TextureResidencyPlanner::GetNumBytesFromMip( const uint32_t index, const uint32_t mip ) const
+{
+    const PlannedTexture *texture = FindTexture( index );
+    return texture != nullptr && mip < texture->NumBytesFromMip.size( ) ? texture->NumBytesFromMip[ mip ] : 0;
+}
+
+uint64_t TextureResidencyPlanner::GetTargetNumBytes( ) const
+{
+    uint64_t numBytes = 0;
+    for ( const PlannedTexture &texture : m_textures )
+    {
+        if ( texture.IsUsed )
+        {
+            numBytes += texture.NumBytesFromMip[ texture.TargetMip ];
+        }
+    }
+    return numBytes;
+}
@@ -0,0 +1,234 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Data/TextureStreamer.h"
+#include <algorithm>
+#include <cmath>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+TextureStreamer::TextureStreamer( const TextureStreamerDesc &desc ) : m_desc( desc ), m_planner( { desc.MemoryBudget, desc.MaxTailSize } )
+{
+    DZ_NOT_NULL( m_desc.Device );
+    m_batchCopy = std::make_unique<BatchResourceCopy>( m_desc.Device );
+}
+
+TextureStreamer::~TextureStreamer( ) = default;
+
+TextureStreamer::StreamedTexture *TextureStreamer::FindTexture( const StreamedTextureHandle handle )
+{
+    if ( handle.Value >= m_textures.size( ) || !m_textures[ handle.Value ].IsUsed )
+    {
+        spdlog::error( "TextureStreamer: Invalid streamed texture handle {}", handle.Value );
+        return nullptr;
+    }
+    return &m_textures[ handle.Value ];
+}
+
+const TextureStreamer::StreamedTexture *TextureStreamer::FindTexture( const StreamedTextureHandle handle ) const
+{
+    return const_cast<TextureStreamer *>( this )->FindTexture( handle );
+}
+
+StreamedTextureHandle TextureStreamer::AddTexture( const StreamedTextureDesc &desc )
+{
+    DZ_NOT_NULL( desc.Reader );
+
+    StreamedTextureHandle handle{ static_cast<uint32_t>( m_textures.size( ) ) };
+    if ( !m_freeTextures.empty( ) )
+    {
+        handle.Value = m_freeTextures.back( );
+        m_freeTextures.pop_back( );
+    }
+    else
+    {
+        m_textures.emplace_back( );
+    }
+
+    StreamedTexture &texture = m_textures[ handle.Value ];
+    texture                  = StreamedTexture{ };
+    texture.IsUsed           = true;
+    texture.Reader           = desc.Reader;
+    texture.Asset            = std::unique_ptr<TextureAsset>( desc.Reader->Read( ) );
+
+    const TextureAsset &asset       = *texture.Asset;
+    TextureDesc        &textureDesc = texture.Desc;
+    textureDesc.HeapType            = HeapType::GPU;
+    textureDesc.InitialUsage        = ResourceUsage::CopyDst;
+    textureDesc.Width               = asset.Width;
+    textureDesc.Height              = asset.Height;
+    textureDesc.Depth               = asset.Depth;
+    textureDesc.Format              = asset.Format;
+    textureDesc.ArraySize           = asset.ArraySize;
+    textureDesc.MipLevels           = std::max( 1u, asset.MipLevels );
+    textureDesc.Descriptor          = ResourceDescriptor::Texture | desc.AdditionalDescriptors;
+    if ( asset.Dimension == TextureDimension::TextureCube )
+    {
+        textureDesc.Descriptor |= ResourceDescriptor::TextureCube;
+    }
+    textureDesc.Usages    = ResourceUsage::ShaderResource | ResourceUsage::CopyDst | desc.AdditionalUsages;
+    textureDesc.DebugName = desc.DebugName.IsEmpty( ) ? InteropString( "StreamedTexture:" ).Append( asset.Uri.Path.Get( ) ) : desc.DebugName;
+
+    m_planner.SetTexture( handle.Value, textureDesc, asset.Mips );
+    texture.ResidentMip = m_planner.GetTailMip( handle.Value );
+    return handle;
+}
+
+void TextureStreamer::RemoveTexture( const StreamedTextureHandle handle )
+{
+    StreamedTexture *texture = FindTexture( handle );
+    if ( texture == nullptr )
+    {
+        return;
+    }
+    RetireTexture( handle.Value );
+    *texture = StreamedTexture{ };
+    m_planner.RemoveTexture( handle.Value );
+    m_freeTextures.push_back( handle.Value );
+}
+
+void TextureStreamer::RequestMip( const StreamedTextureHandle handle, const uint32_t mipLevel )
+{
+    if ( FindTexture( handle ) != nullptr )
+    {
+        m_planner.RequestMip( handle.Value, mipLevel );
+    }
+}
+
+void TextureStreamer::RequestScreenSize( const StreamedTextureHandle handle, const float width, const float height )
+{
+    const StreamedTexture *texture = FindTexture( handle );
+    if ( texture == nullptr )
+    {
+        return;
+    }
+
+    // Each mip halves the texels per pixel, the mip where they drop to one or fewer
+    const float texelsPerPixel = std::max( texture->Desc.Width / std::max( width, 1.0f ), texture->Desc.Height / std::max( height, 1.0f ) );
+    const auto  mip            = static_cast<uint32_t>( std::max( 0.0f, std::floor( std::log2( texelsPerPixel ) ) ) );
+    RequestMip( handle, mip );
+}
+
+StreamedTextureHandleArray TextureStreamer::Update( )
+{
+    ++m_frame;
+    ReleaseRetiredTextures( );
+    m_replacedTextures.clear( );
+    m_planner.Plan( );
+
+    // New textures and textures losing mips go first, they only shrink and free memory for the uploads
+    std::vector<uint32_t> changes;
+    std::vector<uint32_t> uploads;
+    for ( uint32_t i = 0; i < m_textures.size( ); ++i )
+    {
+        const StreamedTexture &texture = m_textures[ i ];
+        if ( !texture.IsUsed )
+        {
+            continue;
+        }
+        if ( const uint32_t targetMip = m_planner.GetTargetMip( i ); texture.Texture == nullptr || targetMip > texture.ResidentMip )
+        {
+            changes.push_back( i );
+        }
+        else if ( targetMip < texture.ResidentMip )
+        {
+            uploads.push_back( i );
+        }
+    }
+
+    // The most recently requested textures are the likeliest to be on screen
+    std::ranges::stable_sort( uploads, std::greater{ }, [ this ]( const uint32_t index ) { return m_planner.GetLastRequestFrame( index ); } );
+    uploads.resize( std::min<size_t>( uploads.size( ), m_desc.MaxUploadsPerUpdate ) );
+    changes.insert( changes.end( ), uploads.begin( ), uploads.end( ) );
+    if ( changes.empty( ) )
+    {
+        return { };
+    }
+
+    m_batchCopy->Begin( );
+    for ( const uint32_t index : changes )
+    {
+        // Textures that were just added start with their tail and grow from the next Update on
+        MakeResident( index, m_textures[ index ].Texture == nullptr ? m_planner.GetTailMip( index ) : m_planner.GetTargetMip( index ) );
+    }
+    m_batchCopy->Submit( );
+
+    StreamedTextureHandleArray result{ };
+    result.Elements    = m_replacedTextures.data( );
+    result.NumElements = static_cast<uint32_t>( m_replacedTextures.size( ) );
+    return result;
+}
+
+void TextureStreamer::MakeResident( const uint32_t index, const uint32_t firstMip )
+{
+    StreamedTexture &texture     = m_textures[ index ];
+    TextureDesc      textureDesc = texture.Desc;
+    textureDesc.Width            = std::max( 1u, textureDesc.Width >> firstMip );
+    textureDesc.Height           = std::max( 1u, textureDesc.Height >> firstMip );
+    textureDesc.Depth            = std::max( 1u, textureDesc.Depth >> firstMip );
+    textureDesc.MipLevels        = textureDesc.MipLevels - firstMip;
+
+    auto resource = std::unique_ptr<ITextureResource>( m_desc.Device->CreateTextureResource( textureDesc ) );
+
+    LoadAssetTextureDesc loadDesc{ };
+    loadDesc.Reader     = texture.Reader;
+    loadDesc.DstTexture = resource.get( );
+    loadDesc.FirstMip   = firstMip;
+    m_batchCopy->LoadAssetTexture( loadDesc );
+
+    RetireTexture( index );
+    texture.Texture     = std::move( resource );
+    texture.ResidentMip = firstMip;
+    m_residentNumBytes += m_planner.GetNumBytesFromMip( index, firstMip );
+    m_replacedTextures.push_back( StreamedTextureHandle{ index } );
+}
+
+void TextureStreamer::RetireTexture( const uint32_t index )
+{
+    StreamedTexture &texture = m_textures[ index ];
+    if ( texture.Texture == nullptr )
+    {
+        return;
+    }
+    m_residentNumBytes -= m_planner.GetNumBytesFromMip( index, texture.ResidentMip );
+    m_retiredTextures.push_back( { std::move( texture.Texture ), m_frame } );
+}
+
+void TextureStreamer::ReleaseRetiredTextures( )
+{
+    std::erase_if( m_retiredTextures, [ this ]( const RetiredTexture &retired ) { return retired.Frame + m_desc.NumFramesInFlight <= m_frame; } );
+}
+
+ITextureResource *TextureStreamer::GetTexture( const StreamedTextureHandle handle ) const
+{
+    const StreamedTexture *texture = FindTexture( handle );
+    return texture != nullptr ? texture->Texture.get( ) : nullptr;
+}
+
+uint32_t TextureStreamer::GetResidentMip( const StreamedTextureHandle handle ) const
+{
+    const StreamedTexture *texture = FindTexture( handle );
+    return texture != nullptr ? texture->ResidentMip : 0;
+}
+
+uint64_t TextureStreamer::GetResidentNumBytes( ) const
+{
+    return m_residentNumBytes;
+}
@@ -17,6 +17,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Renderer/Sync/FrameSync.h"
+#include "DenOfIzGraphics/Utilities/DZArena.h"
 
 using namespace DenOfIz;
 
@@ -50,6 +51,7 @@ uint32_t FrameSync::NextFrame( )
     m_currentFrame = m_nextFrame;
     m_nextFrame    = ( m_nextFrame + 1 ) % m_numFrames;
     m_frameFences[ m_currentFrame ]->Wait( );
+    DZFrameArena::BeginFrame( );
     return m_currentFrame;
 }
 
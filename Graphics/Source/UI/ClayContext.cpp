@@ -210,7 +210,7 @@ uint32_t ClayContext::HashString( const InteropString &str, const uint32_t index
 {
     Clay_String clayStr;
     clayStr.chars  = str.Get( );
-    clayStr.length = static_cast<int32_t>( strlen( str.Get( ) ) );
+    clayStr.length = static_cast<int32_t>( str.NumChars( ) );
 
     const Clay_ElementId id = Clay__HashString( clayStr, index, baseId );
     return id.id;
@@ -18,10 +18,11 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DenOfIzGraphicsInternal/UI/ClayRenderer.h"
 #include <cmath>
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
 #include "DenOfIzGraphics/Data/BatchResourceCopy.h"
 #include "DenOfIzGraphics/UI/ClayData.h"
 #include "DenOfIzGraphics/UI/Widgets/ResizableContainerWidget.h"
-#include "DenOfIzGraphicsInternal/UI/UIShaders.h"
+#include "DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 #include "DenOfIzGraphicsInternal/Utilities/Utilities.h"
 
@@ -113,35 +114,7 @@ ClayRenderer::~ClayRenderer( )
 
 void ClayRenderer::CreateShaderProgram( )
 {
-    auto vertexShader = EmbeddedUIShaders::GetUIVertexShaderBytes( );
-    auto pixelShader  = EmbeddedUIShaders::GetUIPixelShaderBytes( );
-
-    std::array<ShaderStageDesc, 2> shaderStages( { } );
-    ShaderStageDesc               &vsDesc = shaderStages[ 0 ];
-    vsDesc.Stage                          = ShaderStage::Vertex;
-    vsDesc.EntryPoint                     = InteropString( "main" );
-    vsDesc.Data.Elements                  = vertexShader.data( );
-    vsDesc.Data.NumElements               = vertexShader.size( );
-
-    ShaderStageDesc &psDesc = shaderStages[ 1 ];
-    psDesc.Stage            = ShaderStage::Pixel;
-    psDesc.EntryPoint       = InteropString( "main" );
-    psDesc.Data.Elements    = pixelShader.data( );
-    psDesc.Data.NumElements = pixelShader.size( );
-
-    std::array<BindlessSlot, 1> bindlessSlots( { } );
-    bindlessSlots[ 0 ].RegisterSpace = 0;
-    bindlessSlots[ 0 ].Binding       = 0;
-    bindlessSlots[ 0 ].MaxArraySize  = m_desc.MaxTextures;
-    bindlessSlots[ 0 ].Type          = ResourceBindingType::ShaderResource;
-
-    psDesc.Bindless.BindlessArrays.Elements    = bindlessSlots.data( );
-    psDesc.Bindless.BindlessArrays.NumElements = bindlessSlots.size( );
-
-    ShaderProgramDesc programDesc{ };
-    programDesc.ShaderStages.Elements    = shaderStages.data( );
-    programDesc.ShaderStages.NumElements = shaderStages.size( );
-    m_shaderProgram                      = std::make_unique<ShaderProgram>( programDesc );
+    m_shaderProgram = std::unique_ptr<ShaderProgram>( EngineShaders::CreateProgram( { EngineShader::UI, m_desc.MaxTextures } ) );
 }
 
 void ClayRenderer::CreatePipeline( )
@@ -781,14 +754,15 @@ void ClayRenderer::RenderSingleLineText( const Clay_RenderCommand *command, cons
         const TextVertexAllocationInfo allocInfo = textLayout->GetVertexAllocationInfo( );
         if ( allocInfo.VertexCount > 0 && allocInfo.IndexCount > 0 )
         {
-            std::vector<GlyphVertex> glyphVertices( allocInfo.VertexCount );
-            std::vector<uint32_t>    glyphIndices( allocInfo.IndexCount );
+            DZArena     &frameArena    = DZFrameArena::ThisThread( );
+            GlyphVertex *glyphVertices = DZArenaAllocator<GlyphVertex>::AllocateAndConstruct( frameArena, allocInfo.VertexCount );
+            uint32_t    *glyphIndices  = DZArenaAllocator<uint32_t>::Allocate( frameArena, allocInfo.IndexCount );
 
             GenerateTextVerticesDesc generateDesc{ };
             generateDesc.StartPosition   = Float_2{ bounds.x * m_dpiScale, adjustedY };
             generateDesc.Color           = Float_4{ data.textColor.r / 255.0f, data.textColor.g / 255.0f, data.textColor.b / 255.0f, data.textColor.a / 255.0f };
-            generateDesc.OutVertices     = glyphVertices.data( );
-            generateDesc.OutIndices      = glyphIndices.data( );
+            generateDesc.OutVertices     = glyphVertices;
+            generateDesc.OutIndices      = glyphIndices;
             generateDesc.BaseVertexIndex = 0;
             generateDesc.BaseIndexOffset = 0;
             generateDesc.Scale           = effectiveScale;
@@ -809,11 +783,7 @@ void ClayRenderer::RenderSingleLineText( const Clay_RenderCommand *command, cons
                 cachedVertices->vertices.push_back( vertex );
             }
 
-            cachedVertices->indices.reserve( allocInfo.IndexCount );
-            for ( uint32_t i = 0; i < allocInfo.IndexCount; ++i )
-            {
-                cachedVertices->indices.push_back( glyphIndices[ i ] );
-            }
+            cachedVertices->indices.assign( glyphIndices, glyphIndices + allocInfo.IndexCount );
         }
     }
 
@@ -17,7 +17,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphicsInternal/UI/FullscreenQuadPipeline.h"
-#include "DenOfIzGraphicsInternal/UI/FullscreenQuadShaders.h"
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
 using namespace DenOfIz;
@@ -37,26 +37,7 @@ FullscreenQuadPipeline::FullscreenQuadPipeline( const FullscreenQuadPipelineDesc
 
 void FullscreenQuadPipeline::CreateShaderProgram( )
 {
-    auto vertexShader = EmbeddedFullscreenQuadShaders::GetFullscreenQuadVertexShaderBytes( );
-    auto pixelShader  = EmbeddedFullscreenQuadShaders::GetFullscreenQuadPixelShaderBytes( );
-
-    std::array<ShaderStageDesc, 2> shaderStages( { } );
-    ShaderStageDesc               &vsDesc = shaderStages[ 0 ];
-    vsDesc.Stage                          = ShaderStage::Vertex;
-    vsDesc.EntryPoint                     = InteropString( "main" );
-    vsDesc.Data.Elements                  = vertexShader.data( );
-    vsDesc.Data.NumElements               = vertexShader.size( );
-
-    ShaderStageDesc &psDesc = shaderStages[ 1 ];
-    psDesc.Stage            = ShaderStage::Pixel;
-    psDesc.EntryPoint       = InteropString( "main" );
-    psDesc.Data.Elements    = pixelShader.data( );
-    psDesc.Data.NumElements = pixelShader.size( );
-
-    ShaderProgramDesc programDesc{ };
-    programDesc.ShaderStages.NumElements = shaderStages.size( );
-    programDesc.ShaderStages.Elements    = shaderStages.data( );
-    m_shaderProgram                      = std::make_unique<ShaderProgram>( programDesc );
+    m_shaderProgram = std::unique_ptr<ShaderProgram>( EngineShaders::CreateProgram( { EngineShader::FullscreenQuad } ) );
 }
 
 void FullscreenQuadPipeline::CreatePipeline( const FullscreenQuadPipelineDesc &desc )
@@ -17,16 +17,47 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "DenOfIzGraphics/Utilities/DZArena.h"
+#include <algorithm>
+#include <atomic>
 
 using namespace DenOfIz;
 
-DZArena::DZArena( const size_t initialCapacity ) : Buffer( nullptr ), Capacity( initialCapacity ), Used( 0 ), InitialCapacity( initialCapacity )
+namespace
 {
+    constexpr size_t FrameArenaInitialCapacity = 64 * 1024;
+
+    std::atomic<uint64_t> g_frameEpoch{ 0 };
+
+    size_t AlignOffset( const size_t offset, const size_t alignment )
+    {
+        return offset + alignment - 1 & ~( alignment - 1 );
+    }
+} // namespace
+
+DZArena::DZArena( const size_t initialCapacity, const DZArenaMode mode ) :
+    Buffer( nullptr ), Capacity( initialCapacity ), Used( 0 ), InitialCapacity( initialCapacity ), Mode( mode )
+{
+    if ( Mode == DZArenaMode::Chunked )
+    {
+        FirstBlock = CreateBlock( initialCapacity );
+        UseBlock( FirstBlock );
+        return;
+    }
     Buffer = static_cast<Byte *>( malloc( initialCapacity ) );
 }
 
 DZArena::~DZArena( )
 {
+    if ( Mode == DZArenaMode::Chunked )
+    {
+        while ( FirstBlock )
+        {
+            Block *next = FirstBlock->Next;
+            free( FirstBlock );
+            FirstBlock = next;
+        }
+        return;
+    }
     if ( Buffer )
     {
         free( Buffer );
@@ -35,12 +66,28 @@ DZArena::~DZArena( )
 
 void DZArena::Reset( )
 {
+    if ( Mode == DZArenaMode::Chunked )
+    {
+        UseBlock( FirstBlock );
+    }
     Used = 0;
 }
 
 void DZArena::Clear( )
 {
     Reset( );
+    if ( Mode == DZArenaMode::Chunked )
+    {
+        Block *block = FirstBlock->Next;
+        while ( block )
+        {
+            Block *next = block->Next;
+            free( block );
+            block = next;
+        }
+        FirstBlock->Next = nullptr;
+        return;
+    }
     if ( Capacity > InitialCapacity * 4 )
     {
         free( Buffer );
@@ -51,13 +98,20 @@ void DZArena::Clear( )
 
 Byte *DZArena::Allocate( const size_t size, const size_t alignment )
 {
-    size_t       alignedUsed  = Used + alignment - 1 & ~( alignment - 1 );
+    size_t       alignedUsed  = AlignOffset( Used, alignment );
     const size_t requiredSize = alignedUsed + size;
 
     if ( requiredSize > Capacity )
     {
-        Grow( requiredSize );
-        alignedUsed = Used + alignment - 1 & ~( alignment - 1 );
+        if ( Mode == DZArenaMode::Chunked )
+        {
+            NextBlock( size ); // Blocks start max_align_t aligned, so offset 0 satisfies the alignment
+        }
+        else
+        {
+            Grow( requiredSize );
+        }
+        alignedUsed = AlignOffset( Used, alignment );
     }
 
     Byte *result = Buffer + alignedUsed;
@@ -77,24 +131,36 @@ size_t DZArena::GetRemainingCapacity( ) const
 
 size_t DZArena::GetTotalCapacity( ) const
 {
+    if ( Mode == DZArenaMode::Chunked )
+    {
+        size_t total = 0;
+        for ( const Block *block = FirstBlock; block; block = block->Next )
+        {
+            total += block->Capacity;
+        }
+        return total;
+    }
     return Capacity;
 }
 
 void DZArena::AdvanceCursor( const size_t bytes )
 {
-    const size_t newUsed = Used + bytes;
-    if ( newUsed > Capacity )
-    {
-        Grow( newUsed );
-    }
-    Used = newUsed;
+    EnsureCapacity( Used + bytes );
+    Used += bytes;
 }
 
 void DZArena::EnsureCapacity( const size_t requiredCapacity )
 {
     if ( requiredCapacity > Capacity )
     {
-        Grow( requiredCapacity );
+        if ( Mode == DZArenaMode::Chunked )
+        {
+            NextBlock( requiredCapacity - Used );
+        }
+        else
+        {
+            Grow( requiredCapacity );
+        }
     }
 }
 
@@ -120,6 +186,69 @@ void DZArena::Grow( const size_t requiredSize )
     Capacity = newCapacity;
 }
 
+void DZArena::NextBlock( const size_t minCapacity )
+{
+    // Nothing was handed out from the arena yet, typically EnsureCapacity right after construction, so the first block is replaced
+    if ( CurrentBlock == FirstBlock && FirstBlock->Next == nullptr && Used == 0 )
+    {
+        free( FirstBlock );
+        FirstBlock = CreateBlock( minCapacity );
+        UseBlock( FirstBlock );
+        return;
+    }
+
+    // Blocks retained by Reset are reused in order, a block that is too small stays in the chain for later allocations
+    Block *next = CurrentBlock->Next;
+    if ( next == nullptr || next->Capacity < minCapacity )
+    {
+        Block *block       = CreateBlock( std::max( minCapacity, CurrentBlock->Capacity * 2 ) );
+        block->Next        = next;
+        CurrentBlock->Next = block;
+        next               = block;
+    }
+    UseBlock( next );
+}
+
+void DZArena::UseBlock( Block *block )
+{
+    CurrentBlock = block;
+    Buffer       = reinterpret_cast<Byte *>( block + 1 );
+    Capacity     = block->Capacity;
+    Used         = 0;
+}
+
+DZArena::Block *DZArena::CreateBlock( const size_t capacity )
+{
+    const auto block = static_cast<Block *>( malloc( sizeof( Block ) + capacity ) );
+    block->Next      = nullptr;
+    block->Capacity  = capacity;
+    return block;
+}
+
+void DZFrameArena::BeginFrame( )
+{
+    g_frameEpoch.fetch_add( 1, std::memory_order_relaxed );
+}
+
+DZArena &DZFrameArena::ThisThread( )
+{
+    thread_local DZArena  arena( FrameArenaInitialCapacity, DZArenaMode::Chunked );
+    thread_local uint64_t epoch = 0;
+
+    const uint64_t currentEpoch = g_frameEpoch.load( std::memory_order_relaxed );
+    if ( epoch != currentEpoch )
+    {
+        arena.Reset( );
+        epoch = currentEpoch;
+    }
+    return arena;
+}
+
+Byte *DZFrameArena::Allocate( const size_t size, const size_t alignment )
+{
+    return ThisThread( ).Allocate( size, alignment );
+}
+
 DZArenaCursor DZArenaCursor::Create( DZArena *arena )
 {
     DZArenaCursor cursor{ };
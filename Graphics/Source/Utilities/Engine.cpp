@@ -21,7 +21,6 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <thorvg.h>
-#include <thread>
 #include "DenOfIzGraphicsInternal/Backends/Common/SDLInclude.h"
 #include "DenOfIzGraphicsInternal/Utilities/Logging.h"
 
@@ -44,7 +43,9 @@ void Engine::Init( const EngineDesc &desc )
     std::atexit( SDL_Quit );
 #endif
 
-    tvg::Initializer::init( tvg::CanvasEngine::Sw, std::thread::hardware_concurrency( ) );
+    JobSystem::Init( desc.Jobs );
+    EngineShaders::SetSource( desc.Shaders );
+    tvg::Initializer::init( tvg::CanvasEngine::Sw, JobSystem::Get( ).NumWorkers( ) );
     std::atexit( [] { tvg::Initializer::term( tvg::CanvasEngine::Sw ); } );
 
     std::vector<spdlog::sink_ptr> sinks;
@@ -84,5 +85,6 @@ void Engine::Init( const EngineDesc &desc )
 
 void Engine::Shutdown( )
 {
+    JobSystem::Shutdown( );
     spdlog::shutdown( );
 }
@@ -0,0 +1,146 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Utilities/InternedString.h"
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include "DenOfIzGraphics/Utilities/DZArena.h"
+#include "DenOfIzGraphicsInternal/Utilities/Fnv1a.h"
+
+namespace DenOfIz
+{
+    struct InternedStringEntry
+    {
+        uint64_t    Hash;
+        size_t      NumChars;
+        const char *Chars;
+    };
+} // namespace DenOfIz
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr size_t TableArenaCapacity = 64 * 1024;
+
+    struct StringViewHash
+    {
+        size_t operator( )( const std::string_view str ) const
+        {
+            return Fnv1a::Hash( str.data( ), str.size( ) );
+        }
+    };
+
+    // Entries and their characters are allocated from a chunked arena so handles stay valid while the table grows
+    struct InternTable
+    {
+        std::shared_mutex                                                                Mutex;
+        DZArena                                                                          Arena{ TableArenaCapacity, DZArenaMode::Chunked };
+        std::unordered_map<std::string_view, const InternedStringEntry *, StringViewHash> Entries;
+
+        const InternedStringEntry *Intern( const char *str, const size_t numChars )
+        {
+            const std::string_view key( str, numChars );
+            {
+                std::shared_lock lock( Mutex );
+                if ( const auto it = Entries.find( key ); it != Entries.end( ) )
+                {
+                    return it->second;
+                }
+            }
+
+            std::unique_lock lock( Mutex );
+            if ( const auto it = Entries.find( key ); it != Entries.end( ) )
+            {
+                return it->second;
+            }
+
+            const auto chars = reinterpret_cast<char *>( Arena.Allocate( numChars + 1, 1 ) );
+            std::memcpy( chars, str, numChars );
+            chars[ numChars ] = '\0';
+
+            const auto entry = reinterpret_cast<InternedStringEntry *>( Arena.Allocate( sizeof( InternedStringEntry ), alignof( InternedStringEntry ) ) );
+            entry->Hash      = Fnv1a::Hash( chars, numChars );
+            entry->NumChars  = numChars;
+            entry->Chars     = chars;
+            Entries.emplace( std::string_view( chars, numChars ), entry );
+            return entry;
+        }
+    };
+
+    InternTable &GetInternTable( )
+    {
+        static InternTable table;
+        return table;
+    }
+} // namespace
+
+InternedString::InternedString( const InteropString &str )
+{
+    if ( !str.IsEmpty( ) )
+    {
+        m_entry = GetInternTable( ).Intern( str.Get( ), str.NumChars( ) );
+    }
+}
+
+InternedString::InternedString( const char *str )
+{
+    if ( str != nullptr && str[ 0 ] != '\0' )
+    {
+        m_entry = GetInternTable( ).Intern( str, std::strlen( str ) );
+    }
+}
+
+uint64_t InternedString::Hash( ) const
+{
+    if ( m_entry == nullptr )
+    {
+        return Fnv1a::Hash( "", 0 );
+    }
+    return m_entry->Hash;
+}
+
+size_t InternedString::NumChars( ) const
+{
+    return m_entry == nullptr ? 0 : m_entry->NumChars;
+}
+
+bool InternedString::IsEmpty( ) const
+{
+    return m_entry == nullptr;
+}
+
+const char *InternedString::Get( ) const
+{
+    return m_entry == nullptr ? "" : m_entry->Chars;
+}
+
+InteropString InternedString::ToInteropString( ) const
+{
+    return { Get( ), NumChars( ) };
+}
+
+size_t InternedString::NumInterned( )
+{
+    InternTable     &table = GetInternTable( );
+    std::shared_lock lock( table.Mutex );
+    return table.Entries.size( );
+}
@@ -0,0 +1,240 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
+#include <algorithm>
+#include <taskflow/taskflow.hpp>
+#include <thread>
+#include "DenOfIzGraphicsInternal/Utilities/Logging.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr uint32_t RangesPerWorker = 4; // Lets idle workers steal from an uneven ParallelFor
+
+    std::mutex               g_jobSystemMutex;
+    std::atomic<JobSystem *> g_jobSystem = nullptr;
+} // namespace
+
+void JobCounter::Increment( )
+{
+    m_pending.fetch_add( 1, std::memory_order_relaxed );
+}
+
+void JobCounter::Decrement( )
+{
+    std::lock_guard lock( m_mutex );
+    if ( m_pending.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+    {
+        m_finished.notify_all( );
+    }
+}
+
+bool JobCounter::IsDone( ) const
+{
+    return m_pending.load( std::memory_order_acquire ) == 0;
+}
+
+JobGraph::~JobGraph( )
+{
+    delete m_taskflow;
+}
+
+uint32_t JobGraph::Add( Job job )
+{
+    delete m_taskflow;
+    m_taskflow = nullptr;
+    m_nodes.push_back( { std::move( job ), { } } );
+    return static_cast<uint32_t>( m_nodes.size( ) - 1 );
+}
+
+void JobGraph::Precede( const uint32_t before, const uint32_t after )
+{
+    if ( before >= m_nodes.size( ) || after >= m_nodes.size( ) )
+    {
+        spdlog::error( "JobGraph::Precede: job id out of range" );
+        return;
+    }
+    delete m_taskflow;
+    m_taskflow = nullptr;
+    m_nodes[ before ].Successors.push_back( after );
+}
+
+void JobGraph::Clear( )
+{
+    delete m_taskflow;
+    m_taskflow = nullptr;
+    m_nodes.clear( );
+}
+
+uint32_t JobGraph::NumJobs( ) const
+{
+    return static_cast<uint32_t>( m_nodes.size( ) );
+}
+
+tf::Taskflow &JobGraph::GetTaskflow( )
+{
+    if ( m_taskflow != nullptr )
+    {
+        return *m_taskflow;
+    }
+
+    m_taskflow = new tf::Taskflow( );
+    std::vector<tf::Task> tasks;
+    tasks.reserve( m_nodes.size( ) );
+    for ( Node &node : m_nodes )
+    {
+        tasks.push_back( m_taskflow->emplace( [ &node ] { node.Function( ); } ) );
+    }
+    for ( size_t i = 0; i < m_nodes.size( ); ++i )
+    {
+        for ( const uint32_t successor : m_nodes[ i ].Successors )
+        {
+            tasks[ i ].precede( tasks[ successor ] );
+        }
+    }
+    return *m_taskflow;
+}
+
+JobSystem::JobSystem( const JobSystemDesc &desc )
+{
+    const uint32_t numWorkers = desc.NumWorkers > 0 ? desc.NumWorkers : std::max( 1u, std::thread::hardware_concurrency( ) );
+    m_executor                = new tf::Executor( numWorkers );
+}
+
+JobSystem::~JobSystem( )
+{
+    delete m_executor; // Waits for the submitted jobs
+}
+
+void JobSystem::Submit( Job job, JobCounter *counter ) const
+{
+    if ( counter == nullptr )
+    {
+        m_executor->silent_async( std::move( job ) );
+        return;
+    }
+
+    counter->Increment( );
+    m_executor->silent_async(
+        [ job = std::move( job ), counter ]
+        {
+            job( );
+            counter->Decrement( );
+        } );
+}
+
+void JobSystem::Run( JobGraph &graph, JobCounter *counter ) const
+{
+    if ( counter == nullptr )
+    {
+        m_executor->run( graph.GetTaskflow( ) );
+        return;
+    }
+
+    counter->Increment( );
+    m_executor->run( graph.GetTaskflow( ), [ counter ] { counter->Decrement( ); } );
+}
+
+void JobSystem::ParallelFor( const uint32_t count, const std::function<void( uint32_t begin, uint32_t end )> &body, const uint32_t grainSize ) const
+{
+    if ( count == 0 )
+    {
+        return;
+    }
+
+    const uint32_t maxRanges = NumWorkers( ) * RangesPerWorker;
+    const uint32_t rangeSize = std::max( { 1u, grainSize, ( count + maxRanges - 1 ) / maxRanges } );
+    const uint32_t numRanges = ( count + rangeSize - 1 ) / rangeSize;
+    if ( numRanges <= 1 )
+    {
+        body( 0, count );
+        return;
+    }
+
+    JobCounter counter;
+    for ( uint32_t range = 1; range < numRanges; ++range )
+    {
+        const uint32_t begin = range * rangeSize;
+        const uint32_t end   = std::min( count, begin + rangeSize );
+        Submit( [ &body, begin, end ] { body( begin, end ); }, &counter );
+    }
+    body( 0, rangeSize );
+    Wait( counter );
+}
+
+void JobSystem::Wait( JobCounter &counter ) const
+{
+    if ( IsWorkerThread( ) )
+    {
+        m_executor->corun_until( [ &counter ] { return counter.IsDone( ); } );
+    }
+
+    // Also taken on workers, Decrement might still be holding the lock after corun_until saw the counter reach zero
+    std::unique_lock lock( counter.m_mutex );
+    counter.m_finished.wait( lock, [ &counter ] { return counter.IsDone( ); } );
+}
+
+void JobSystem::WaitIdle( ) const
+{
+    m_executor->wait_for_all( );
+}
+
+uint32_t JobSystem::NumWorkers( ) const
+{
+    return static_cast<uint32_t>( m_executor->num_workers( ) );
+}
+
+bool JobSystem::IsWorkerThread( ) const
+{
+    return m_executor->this_worker_id( ) >= 0;
+}
+
+void JobSystem::Init( const JobSystemDesc &desc )
+{
+    std::lock_guard lock( g_jobSystemMutex );
+    if ( g_jobSystem.load( std::memory_order_acquire ) != nullptr )
+    {
+        spdlog::warn( "JobSystem is already running, JobSystemDesc is ignored" );
+        return;
+    }
+    g_jobSystem.store( new JobSystem( desc ), std::memory_order_release );
+}
+
+void JobSystem::Shutdown( )
+{
+    std::lock_guard lock( g_jobSystemMutex );
+    delete g_jobSystem.exchange( nullptr, std::memory_order_acq_rel );
+}
+
+JobSystem &JobSystem::Get( )
+{
+    if ( JobSystem *jobSystem = g_jobSystem.load( std::memory_order_acquire ) )
+    {
+        return *jobSystem;
+    }
+
+    std::lock_guard lock( g_jobSystemMutex );
+    if ( g_jobSystem.load( std::memory_order_acquire ) == nullptr )
+    {
+        g_jobSystem.store( new JobSystem( ), std::memory_order_release );
+    }
+    return *g_jobSystem.load( std::memory_order_acquire );
+}
@@ -1,9 +1,17 @@
 set(DEN_OF_IZ_ASSETS_SOURCES
+    Source/Assets/Bundle/AssetAccessTrace.cpp
+    Source/Assets/Bundle/AssetRequestQueue.cpp
+    Source/Assets/Bundle/BlockCompression.cpp
     Source/Assets/Bundle/Bundle.cpp
     Source/Assets/Bundle/BundleManager.cpp
+    Source/Assets/Bundle/BundleSpaceMap.cpp
+    Source/Assets/Bundle/BundleTableOfContents.cpp
+    Source/Assets/FileSystem/BatchFileReader.cpp
     Source/Assets/FileSystem/PathResolver.cpp
     Source/Assets/FileSystem/FileIO.cpp
     Source/Assets/FileSystem/FSConfig.cpp
+    Source/Assets/FileSystem/MemoryMappedFile.cpp
+    Source/Assets/FileSystem/RandomAccessFile.cpp
     Source/Assets/Font/Font.cpp
     Source/Assets/Font/FontLibrary.cpp
     Source/Assets/Font/TextBatch.cpp
@@ -14,14 +22,18 @@ set(DEN_OF_IZ_ASSETS_SOURCES
     Source/Assets/GpuResource/GpuResourceLoader.cpp
     Source/Assets/Import/AssetPathUtilities.cpp
     Source/Assets/Import/AssimpImporter.cpp
+    Source/Assets/Import/BatchImporter.cpp
     Source/Assets/Import/AssimpSceneLoader.cpp
     Source/Assets/Import/AssimpMeshProcessor.cpp
     Source/Assets/Import/AssimpMaterialProcessor.cpp
     Source/Assets/Import/AssimpSkeletonProcessor.cpp
     Source/Assets/Import/AssimpAnimationProcessor.cpp
     Source/Assets/Import/FontImporter.cpp
+    Source/Assets/Import/ImportCache.cpp
     Source/Assets/Import/ShaderImporter.cpp
     Source/Assets/Import/TextureImporter.cpp
+    Source/Assets/Import/TextureMipGenerator.cpp
+    Source/Assets/Import/TextureBlockCompressor.cpp
     Source/Assets/Import/VGImporter.cpp
     Source/Assets/Serde/Asset.cpp
     Source/Assets/Serde/Animation/AnimationAssetReader.cpp
@@ -34,6 +46,7 @@ set(DEN_OF_IZ_ASSETS_SOURCES
     Source/Assets/Serde/Material/MaterialAssetWriter.cpp
     Source/Assets/Serde/Mesh/MeshAssetReader.cpp
     Source/Assets/Serde/Mesh/MeshAssetWriter.cpp
+    Source/Assets/Serde/Mesh/VertexFormatConverter.cpp
     Source/Assets/Serde/Physics/PhysicsAssetReader.cpp
     Source/Assets/Serde/Physics/PhysicsAssetWriter.cpp
     Source/Assets/Serde/Shader/ShaderAssetReader.cpp
@@ -43,7 +56,9 @@ set(DEN_OF_IZ_ASSETS_SOURCES
     Source/Assets/Serde/Texture/TextureAssetReader.cpp
     Source/Assets/Serde/Texture/TextureAssetWriter.cpp
     Source/Assets/Shaders/DxcEnumConverter.cpp
+    Source/Assets/Shaders/EngineShaders.cpp
     Source/Assets/Shaders/ReflectionDebugOutput.cpp
+    Source/Assets/Shaders/ShaderCache.cpp
     Source/Assets/Shaders/ShaderCompiler.cpp
     Source/Assets/Shaders/ShaderReflectionHelper.cpp
     Source/Assets/Shaders/ShaderProgram.cpp
@@ -97,6 +112,9 @@ set(DEN_OF_IZ_GRAPHICS_COMMON_SOURCES
     Source/Backends/Common/GraphicsWindowHandle.cpp
     Source/Data/AlignedDataWriter.cpp
     Source/Data/BatchResourceCopy.cpp
+    Source/Data/StagingRing.cpp
+    Source/Data/TextureResidencyPlanner.cpp
+    Source/Data/TextureStreamer.cpp
     Source/Data/Texture.cpp
     Source/Data/Geometry.cpp
     Source/Renderer/Sync/FrameSync.cpp
@@ -108,6 +126,8 @@ set(DEN_OF_IZ_GRAPHICS_COMMON_SOURCES
     Source/Utilities/FrameDebugRenderer.cpp
     Source/Utilities/InteropMathConverter.cpp
     Source/Utilities/InteropUtilities.cpp
+    Source/Utilities/InternedString.cpp
+    Source/Utilities/JobSystem.cpp
     Source/Backends/Interface/CommonData.cpp
     Source/Backends/Interface/ITextureResource.cpp
     Source/Backends/Interface/ShaderData.cpp
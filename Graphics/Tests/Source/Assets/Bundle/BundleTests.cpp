@@ -18,8 +18,12 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <filesystem>
+#include <thread>
 #include "../../TestComparators.h"
+#include "DenOfIzGraphics/Assets/Bundle/AssetAccessTrace.h"
+#include "DenOfIzGraphics/Assets/Bundle/AssetRequestQueue.h"
 #include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
 #include "DenOfIzGraphics/Assets/Bundle/BundleManager.h"
 #include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
@@ -466,3 +470,582 @@ TEST_F( BundleTest, BundleManager )
     delete bundle1;
     delete bundle2;
 }
+
+TEST_F( BundleTest, MemoryMappedReader )
+{
+    BundleDesc desc;
+    desc.Path              = GetTempPath( "mapped.dzbundle" );
+    desc.CreateIfNotExists = true;
+
+    auto bundle = new Bundle( desc );
+
+    const AssetUri  meshUri  = AssetUri::Create( "models/cube.dzmesh" );
+    const ByteArray meshData = CreateTestData( "This is mesh data" );
+    bundle->AddAsset( meshUri, AssetType::Mesh, ByteArrayView( meshData ) );
+    ASSERT_TRUE( bundle->Save( ) );
+    delete bundle;
+
+    desc.MemoryMapped = true;
+    bundle            = new Bundle( desc );
+
+    BinaryReader *meshReader = bundle->OpenReader( meshUri );
+    ASSERT_NE( meshReader, nullptr );
+    const ByteArray readMeshData = meshReader->ReadBytes( static_cast<uint32_t>( meshData.NumElements ) );
+    ASSERT_EQ( readMeshData.NumElements, meshData.NumElements );
+    AssertArrayEq( readMeshData.Elements, meshData.Elements, meshData.NumElements );
+    std::free( readMeshData.Elements );
+
+    // Assets added after mapping are readable before and after the bundle is saved again
+    const AssetUri  texUri  = AssetUri::Create( "textures/diffuse.dztex" );
+    const ByteArray texData = CreateTestData( "This is texture data" );
+    bundle->AddAsset( texUri, AssetType::Texture, ByteArrayView( texData ) );
+    for ( int i = 0; i < 2; ++i )
+    {
+        BinaryReader *texReader = bundle->OpenReader( texUri );
+        ASSERT_NE( texReader, nullptr );
+        const ByteArray readTexData = texReader->ReadBytes( static_cast<uint32_t>( texData.NumElements ) );
+        ASSERT_EQ( readTexData.NumElements, texData.NumElements );
+        AssertArrayEq( readTexData.Elements, texData.Elements, texData.NumElements );
+        std::free( readTexData.Elements );
+        delete texReader;
+        ASSERT_TRUE( bundle->Save( ) );
+    }
+
+    // Readers opened before a save keep viewing valid memory
+    meshReader->Seek( 0 );
+    ASSERT_EQ( meshReader->ReadByte( ), 'T' );
+    delete meshReader;
+    delete bundle;
+}
+
+TEST_F( BundleTest, ConcurrentReaders )
+{
+    BundleDesc desc;
+    desc.Path              = GetTempPath( "concurrent.dzbundle" );
+    desc.CreateIfNotExists = true;
+
+    constexpr int numAssets  = 64;
+    constexpr int numThreads = 8;
+
+    auto                     bundle = new Bundle( desc );
+    std::vector<std::string> contents;
+    for ( int i = 0; i < numAssets; ++i )
+    {
+        contents.push_back( "Asset contents " + std::to_string( i ) + std::string( i * 31, static_cast<char>( 'a' + i % 26 ) ) );
+        const AssetUri uri = AssetUri::Create( ( "assets/" + std::to_string( i ) + ".dzmesh" ).c_str( ) );
+        bundle->AddAsset( uri, AssetType::Mesh, ByteArrayView( reinterpret_cast<const Byte *>( contents[ i ].data( ) ), contents[ i ].size( ) ) );
+    }
+    ASSERT_TRUE( bundle->Save( ) );
+
+    BundleManagerDesc managerDesc;
+    managerDesc.DefaultSearchPath = tempDir;
+    BundleManager manager( managerDesc );
+    manager.MountBundle( bundle );
+
+    std::atomic<int>         numMismatches = 0;
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < numThreads; ++t )
+    {
+        threads.emplace_back(
+            [ &, t ]
+            {
+                for ( int i = 0; i < numAssets; ++i )
+                {
+                    const AssetUri uri    = AssetUri::Create( ( "assets/" + std::to_string( ( i * 7 + t ) % numAssets ) + ".dzmesh" ).c_str( ) );
+                    BinaryReader  *reader = manager.OpenReader( uri );
+                    if ( reader == nullptr )
+                    {
+                        ++numMismatches;
+                        continue;
+                    }
+                    const std::string &expected = contents[ ( i * 7 + t ) % numAssets ];
+                    const ByteArray    data     = reader->ReadBytes( static_cast<uint32_t>( expected.size( ) ) );
+                    if ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ) != expected )
+                    {
+                        ++numMismatches;
+                    }
+                    std::free( data.Elements );
+                    delete reader;
+                }
+            } );
+    }
+    for ( auto &thread : threads )
+    {
+        thread.join( );
+    }
+
+    ASSERT_EQ( numMismatches.load( ), 0 );
+    delete bundle;
+}
+
+TEST_F( BundleTest, BlockCompressedSeek )
+{
+    constexpr uint32_t blockSize = 64 * 1024;
+    std::vector<Byte>  data( blockSize * 9 + 123 );
+    for ( size_t i = 0; i < data.size( ); ++i )
+    {
+        data[ i ] = static_cast<Byte>( i * 31 % 251 );
+    }
+
+    BundleDesc desc;
+    desc.Path                 = GetTempPath( "blocks.dzbundle" );
+    desc.CreateIfNotExists    = true;
+    desc.Compress             = true;
+    desc.CompressionBlockSize = blockSize;
+
+    const AssetUri uri    = AssetUri::Create( "textures/large.dztex" );
+    auto           bundle = new Bundle( desc );
+    bundle->AddAsset( uri, AssetType::Texture, ByteArrayView( data.data( ), data.size( ) ) );
+    ASSERT_TRUE( bundle->Save( ) );
+    delete bundle;
+
+    for ( const bool memoryMapped : { false, true } )
+    {
+        desc.MemoryMapped = memoryMapped;
+        bundle            = new Bundle( desc );
+        ASSERT_TRUE( bundle->IsCompressed( ) );
+
+        BinaryReader *reader = bundle->OpenReader( uri );
+        ASSERT_NE( reader, nullptr );
+
+        // Partial read in the middle of a block
+        reader->Seek( blockSize * 4 + 1000 );
+        ByteArray range = reader->ReadBytes( 5000 );
+        ASSERT_EQ( range.NumElements, 5000u );
+        AssertArrayEq( range.Elements, data.data( ) + blockSize * 4 + 1000, range.NumElements );
+        std::free( range.Elements );
+        ASSERT_EQ( reader->Position( ), blockSize * 4 + 6000u );
+
+        // Range spanning several whole blocks and the partial last block
+        reader->Seek( blockSize * 2 );
+        range = reader->ReadBytes( static_cast<uint32_t>( data.size( ) - blockSize * 2 ) );
+        ASSERT_EQ( range.NumElements, data.size( ) - blockSize * 2 );
+        AssertArrayEq( range.Elements, data.data( ) + blockSize * 2, range.NumElements );
+        std::free( range.Elements );
+
+        // Seeking backwards into an unaligned position followed by small reads
+        reader->Seek( 3 );
+        for ( size_t i = 3; i < 3 + blockSize + 16; i += 2 )
+        {
+            ASSERT_EQ( reader->ReadUInt16( ), static_cast<uint16_t>( data[ i ] | data[ i + 1 ] << 8 ) );
+        }
+        delete reader;
+        delete bundle;
+    }
+}
+
+TEST_F( BundleTest, AssetRequestQueue )
+{
+    BundleDesc desc;
+    desc.Path              = GetTempPath( "requests.dzbundle" );
+    desc.CreateIfNotExists = true;
+    desc.Compress          = true;
+
+    constexpr int            numAssets = 8;
+    auto                     bundle    = new Bundle( desc );
+    std::vector<std::string> contents;
+    for ( int i = 0; i < numAssets; ++i )
+    {
+        contents.push_back( "Requested asset " + std::to_string( i ) + std::string( i * 1000, static_cast<char>( 'a' + i ) ) );
+        const AssetUri uri = AssetUri::Create( ( "assets/" + std::to_string( i ) + ".dzmesh" ).c_str( ) );
+        bundle->AddAsset( uri, AssetType::Mesh, ByteArrayView( reinterpret_cast<const Byte *>( contents[ i ].data( ) ), contents[ i ].size( ) ) );
+    }
+    ASSERT_TRUE( bundle->Save( ) );
+
+    BundleManagerDesc managerDesc;
+    managerDesc.DefaultSearchPath = tempDir;
+    BundleManager manager( managerDesc );
+    manager.MountBundle( bundle );
+
+    AssetRequestQueueDesc queueDesc;
+    queueDesc.Manager                = &manager;
+    queueDesc.NumWorkers             = 2;
+    queueDesc.MaxCompletionsPerFrame = 3;
+    auto queue                       = std::make_unique<AssetRequestQueue>( queueDesc );
+
+    std::vector<AssetRequestHandle> handles;
+    for ( int i = 0; i < numAssets; ++i )
+    {
+        AssetRequestDesc requestDesc;
+        requestDesc.Uri = AssetUri::Create( ( "assets/" + std::to_string( i ) + ".dzmesh" ).c_str( ) );
+        handles.push_back( queue->Request( requestDesc ) );
+    }
+    AssetRequestDesc missingDesc;
+    missingDesc.Uri                    = AssetUri::Create( "assets/missing.dzmesh" );
+    const AssetRequestHandle missing   = queue->Request( missingDesc );
+    const AssetRequestHandle cancelled = handles.back( );
+    ASSERT_TRUE( queue->Cancel( cancelled ) );
+    ASSERT_EQ( queue->GetStatus( cancelled ), AssetRequestStatus::Unknown );
+    ASSERT_FALSE( queue->Cancel( cancelled ) );
+    queue->SetPriority( handles[ 3 ], 10 );
+
+    for ( int i = 0; i < numAssets - 1; ++i )
+    {
+        ASSERT_TRUE( queue->WaitForRequest( handles[ i ] ) );
+        ASSERT_EQ( queue->GetStatus( handles[ i ] ), AssetRequestStatus::Ready );
+    }
+    ASSERT_TRUE( queue->WaitForRequest( missing ) );
+    ASSERT_EQ( queue->GetStatus( missing ), AssetRequestStatus::Failed );
+
+    int numCompleted = 0;
+    for ( int frame = 0; frame < 3; ++frame )
+    {
+        const AssetRequestResultArray results = queue->CompleteRequests( );
+        ASSERT_LE( results.NumElements, queueDesc.MaxCompletionsPerFrame );
+        for ( uint32_t i = 0; i < results.NumElements; ++i )
+        {
+            const AssetRequestResult &result = results.Elements[ i ];
+            ASSERT_EQ( queue->GetStatus( result.Handle ), AssetRequestStatus::Unknown );
+            if ( result.Handle.Value == missing.Value )
+            {
+                ASSERT_EQ( result.Status, AssetRequestStatus::Failed );
+                ASSERT_EQ( result.Reader, nullptr );
+                ++numCompleted;
+                continue;
+            }
+
+            const auto it = std::ranges::find_if( handles, [ & ]( const AssetRequestHandle &handle ) { return handle.Value == result.Handle.Value; } );
+            ASSERT_NE( it, handles.end( ) );
+            const std::string &expected = contents[ it - handles.begin( ) ];
+            const ByteArray    data     = result.Reader->ReadBytes( static_cast<uint32_t>( expected.size( ) ) );
+            ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), expected );
+            std::free( data.Elements );
+            delete result.Reader;
+            ++numCompleted;
+        }
+    }
+    ASSERT_EQ( numCompleted, numAssets );
+    ASSERT_EQ( queue->NumOutstandingRequests( ), 0u );
+
+    queue.reset( );
+    delete bundle;
+}
+
+TEST_F( BundleTest, HashedTableOfContents )
+{
+    BundleDesc desc;
+    desc.Path              = GetTempPath( "toc.dzbundle" );
+    desc.CreateIfNotExists = true;
+
+    constexpr int numAssets = 2000;
+    auto          bundle    = new Bundle( desc );
+    for ( int i = 0; i < numAssets; ++i )
+    {
+        const std::string content = std::to_string( i );
+        const AssetUri    uri     = AssetUri::Create( ( "toc/" + content + ".dzmesh" ).c_str( ) );
+        bundle->AddAsset( uri, AssetType::Mesh, ByteArrayView( reinterpret_cast<const Byte *>( content.data( ) ), content.size( ) ) );
+    }
+    ASSERT_TRUE( bundle->Save( ) );
+    delete bundle;
+
+    for ( const bool memoryMapped : { false, true } )
+    {
+        desc.MemoryMapped = memoryMapped;
+        bundle            = new Bundle( desc );
+        ASSERT_EQ( bundle->GetAllAssets( ).NumElements, static_cast<uint32_t>( numAssets ) );
+        ASSERT_FALSE( bundle->Exists( AssetUri::Create( "toc/missing.dzmesh" ) ) );
+
+        for ( int i = 0; i < numAssets; i += 7 )
+        {
+            const std::string content = std::to_string( i );
+            const AssetUri    uri     = AssetUri::Create( ( "toc/" + content + ".dzmesh" ).c_str( ) );
+            ASSERT_TRUE( bundle->Exists( uri ) );
+
+            BinaryReader *reader = bundle->OpenReader( uri );
+            ASSERT_NE( reader, nullptr );
+            const ByteArray data = reader->ReadBytes( static_cast<uint32_t>( content.size( ) ) );
+            ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), content );
+            std::free( data.Elements );
+            delete reader;
+        }
+
+        // Replacing an asset shadows the saved entry until the next save folds it into the table of contents
+        const AssetUri    replacedUri = AssetUri::Create( "toc/5.dzmesh" );
+        const std::string replaced    = memoryMapped ? "mapped" : "replaced";
+        bundle->AddAsset( replacedUri, AssetType::Texture, ByteArrayView( reinterpret_cast<const Byte *>( replaced.data( ) ), replaced.size( ) ) );
+        ASSERT_EQ( bundle->GetAllAssets( ).NumElements, static_cast<uint32_t>( numAssets ) );
+        ASSERT_EQ( bundle->GetAssetsByType( AssetType::Texture ).NumElements, 1u );
+        for ( int pass = 0; pass < 2; ++pass )
+        {
+            BinaryReader *reader = bundle->OpenReader( replacedUri );
+            ASSERT_NE( reader, nullptr );
+            const ByteArray data = reader->ReadBytes( static_cast<uint32_t>( replaced.size( ) ) );
+            ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), replaced );
+            std::free( data.Elements );
+            delete reader;
+            ASSERT_TRUE( bundle->Save( ) );
+        }
+        ASSERT_EQ( bundle->GetAllAssets( ).NumElements, static_cast<uint32_t>( numAssets ) );
+        delete bundle;
+    }
+}
+
+TEST_F( BundleTest, DeduplicatedAssets )
+{
+    const std::string shared( 4096, 's' );
+    const std::string unique     = "Unique asset contents";
+    const AssetUri    sharedUri1 = AssetUri::Create( "dedup/first.dztex" );
+    const AssetUri    sharedUri2 = AssetUri::Create( "dedup/second.dztex" );
+    const AssetUri    uniqueUri  = AssetUri::Create( "dedup/unique.dztex" );
+
+    for ( const bool compress : { false, true } )
+    {
+        BundleDesc desc;
+        desc.Path              = GetTempPath( compress ? "dedup_compressed.dzbundle" : "dedup.dzbundle" );
+        desc.CreateIfNotExists = true;
+        desc.Compress          = compress;
+
+        auto bundle = new Bundle( desc );
+        bundle->AddAsset( sharedUri1, AssetType::Texture, ByteArrayView( reinterpret_cast<const Byte *>( shared.data( ) ), shared.size( ) ) );
+        const uint64_t sizeAfterFirst = FileIO::GetFileNumBytes( desc.Path );
+        bundle->AddAsset( sharedUri2, AssetType::Texture, ByteArrayView( reinterpret_cast<const Byte *>( shared.data( ) ), shared.size( ) ) );
+        // The second copy only adds a table of contents entry
+        ASSERT_EQ( FileIO::GetFileNumBytes( desc.Path ), sizeAfterFirst );
+        bundle->AddAsset( uniqueUri, AssetType::Texture, ByteArrayView( reinterpret_cast<const Byte *>( unique.data( ) ), unique.size( ) ) );
+        ASSERT_GT( FileIO::GetFileNumBytes( desc.Path ), sizeAfterFirst );
+        ASSERT_TRUE( bundle->Save( ) );
+        delete bundle;
+
+        bundle = new Bundle( desc );
+        ASSERT_EQ( bundle->GetAllAssets( ).NumElements, 3u );
+        const std::pair<AssetUri, const std::string *> expectations[] = { { sharedUri1, &shared }, { sharedUri2, &shared }, { uniqueUri, &unique } };
+        for ( const auto &[ uri, expected ] : expectations )
+        {
+            BinaryReader *reader = bundle->OpenReader( uri );
+            ASSERT_NE( reader, nullptr );
+            const ByteArray data = reader->ReadBytes( static_cast<uint32_t>( expected->size( ) ) );
+            ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), *expected );
+            std::free( data.Elements );
+            delete reader;
+        }
+        delete bundle;
+    }
+}
+
+TEST_F( BundleTest, IncrementalSaveReusesSpace )
+{
+    BundleDesc desc;
+    desc.Path              = GetTempPath( "incremental.dzbundle" );
+    desc.CreateIfNotExists = true;
+
+    const AssetUri editedUri = AssetUri::Create( "incremental/edited.dztex" );
+    const AssetUri stableUri = AssetUri::Create( "incremental/stable.dztex" );
+    const auto     addAsset  = [ & ]( Bundle *bundle, const AssetUri &uri, const std::string &content )
+    { bundle->AddAsset( uri, AssetType::Texture, ByteArrayView( reinterpret_cast<const Byte *>( content.data( ) ), content.size( ) ) ); };
+
+    auto bundle = new Bundle( desc );
+    addAsset( bundle, editedUri, std::string( 4096, '0' ) );
+    addAsset( bundle, stableUri, "Stable asset" );
+    ASSERT_TRUE( bundle->Save( ) );
+    delete bundle;
+
+    for ( const bool memoryMapped : { false, true } )
+    {
+        desc.MemoryMapped = memoryMapped;
+        bundle            = new Bundle( desc );
+        uint64_t steadyNumBytes = 0;
+        for ( int edit = 1; edit <= 4; ++edit )
+        {
+            const std::string content( 4096, static_cast<char>( '0' + edit ) );
+            addAsset( bundle, editedUri, content );
+            ASSERT_TRUE( bundle->Save( ) );
+
+            // The first edit has nothing to reuse yet, later edits land in the space left behind by earlier ones
+            const uint64_t numBytes = FileIO::GetFileNumBytes( desc.Path );
+            if ( edit > 1 )
+            {
+                ASSERT_EQ( numBytes, steadyNumBytes );
+            }
+            steadyNumBytes = numBytes;
+
+            BinaryReader *reader = bundle->OpenReader( editedUri );
+            ASSERT_NE( reader, nullptr );
+            const ByteArray data = reader->ReadBytes( static_cast<uint32_t>( content.size( ) ) );
+            ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), content );
+            std::free( data.Elements );
+            delete reader;
+        }
+        delete bundle;
+
+        bundle               = new Bundle( desc );
+        BinaryReader *reader = bundle->OpenReader( stableUri );
+        ASSERT_NE( reader, nullptr );
+        const ByteArray data = reader->ReadBytes( 12 );
+        ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), "Stable asset" );
+        std::free( data.Elements );
+        delete reader;
+        delete bundle;
+    }
+}
+
+TEST_F( BundleTest, CompactBundle )
+{
+    const std::string meshContent    = "Mesh asset contents";
+    const std::string textureContent = std::string( 2048, 't' );
+    const std::string sharedContent  = std::string( 1024, 's' );
+    const AssetUri    meshUri        = AssetUri::Create( "compact/model.dzmesh" );
+    const AssetUri    textureUri     = AssetUri::Create( "compact/albedo.dztex" );
+    const AssetUri    sharedUri1     = AssetUri::Create( "compact/shared1.dztex" );
+    const AssetUri    sharedUri2     = AssetUri::Create( "compact/shared2.dztex" );
+
+    for ( const bool compress : { false, true } )
+    {
+        BundleDesc desc;
+        desc.Path              = GetTempPath( compress ? "compact_compressed.dzbundle" : "compact.dzbundle" );
+        desc.CreateIfNotExists = true;
+        desc.Compress          = compress;
+
+        const auto addAsset = [ & ]( Bundle *bundle, const AssetUri &uri, const AssetType type, const std::string &content )
+        { bundle->AddAsset( uri, type, ByteArrayView( reinterpret_cast<const Byte *>( content.data( ) ), content.size( ) ) ); };
+
+        auto bundle = new Bundle( desc );
+        addAsset( bundle, textureUri, AssetType::Texture, std::string( 2048, 'x' ) );
+        addAsset( bundle, meshUri, AssetType::Mesh, meshContent );
+        addAsset( bundle, sharedUri1, AssetType::Texture, sharedContent );
+        addAsset( bundle, sharedUri2, AssetType::Texture, sharedContent );
+        ASSERT_TRUE( bundle->Save( ) );
+        addAsset( bundle, textureUri, AssetType::Texture, textureContent );
+        ASSERT_TRUE( bundle->Save( ) );
+        const uint64_t numBytesBefore = FileIO::GetFileNumBytes( desc.Path );
+
+        AssetUri          loadOrder[] = { textureUri };
+        BundleCompactDesc compactDesc;
+        compactDesc.Order                 = BundleCompactOrder::Type;
+        compactDesc.LoadOrder.Elements    = loadOrder;
+        compactDesc.LoadOrder.NumElements = 1;
+        ASSERT_TRUE( bundle->Compact( compactDesc ) );
+        ASSERT_LT( FileIO::GetFileNumBytes( desc.Path ), numBytesBefore );
+        delete bundle;
+
+        if ( !compress )
+        {
+            // The load order comes first, then the mesh since meshes sort before textures
+            std::vector<Byte> file( FileIO::GetFileNumBytes( desc.Path ) );
+            FileIO::ReadFile( desc.Path, { file.data( ), file.size( ) } );
+            const std::string fileContents( reinterpret_cast<const char *>( file.data( ) ), file.size( ) );
+            ASSERT_LT( fileContents.find( textureContent ), fileContents.find( meshContent ) );
+            ASSERT_LT( fileContents.find( meshContent ), fileContents.find( sharedContent ) );
+            ASSERT_EQ( fileContents.find( std::string( 2048, 'x' ) ), std::string::npos );
+            ASSERT_EQ( fileContents.find( sharedContent, fileContents.find( sharedContent ) + sharedContent.size( ) ), std::string::npos );
+        }
+
+        bundle = new Bundle( desc );
+        ASSERT_EQ( bundle->GetAllAssets( ).NumElements, 4u );
+        const std::pair<AssetUri, const std::string *> expectations[] = {
+            { meshUri, &meshContent }, { textureUri, &textureContent }, { sharedUri1, &sharedContent }, { sharedUri2, &sharedContent } };
+        for ( const auto &[ uri, expected ] : expectations )
+        {
+            BinaryReader *reader = bundle->OpenReader( uri );
+            ASSERT_NE( reader, nullptr );
+            const ByteArray data = reader->ReadBytes( static_cast<uint32_t>( expected->size( ) ) );
+            ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), *expected );
+            std::free( data.Elements );
+            delete reader;
+        }
+        delete bundle;
+    }
+}
+
+TEST_F( BundleTest, CompactEmptyAsset )
+{
+    const std::string nextContent  = "Asset written right after the empty one";
+    const std::string otherContent = "Asset written after that";
+    const AssetUri    emptyUri     = AssetUri::Create( "compact/a_empty.dzmesh" );
+    const AssetUri    nextUri      = AssetUri::Create( "compact/b_next.dzmesh" );
+    const AssetUri    otherUri     = AssetUri::Create( "compact/c_other.dzmesh" );
+
+    BundleDesc desc;
+    desc.Path              = GetTempPath( "compact_empty.dzbundle" );
+    desc.CreateIfNotExists = true;
+    desc.MemoryMapped      = true;
+
+    // The empty asset takes no space, the next asset is written at the same offset
+    auto bundle = new Bundle( desc );
+    bundle->AddAsset( emptyUri, AssetType::Mesh, ByteArrayView( nullptr, 0 ) );
+    bundle->AddAsset( nextUri, AssetType::Mesh, ByteArrayView( reinterpret_cast<const Byte *>( nextContent.data( ) ), nextContent.size( ) ) );
+    bundle->AddAsset( otherUri, AssetType::Mesh, ByteArrayView( reinterpret_cast<const Byte *>( otherContent.data( ) ), otherContent.size( ) ) );
+    ASSERT_TRUE( bundle->Save( ) );
+
+    BundleCompactDesc compactDesc;
+    compactDesc.Order = BundleCompactOrder::Path;
+    ASSERT_TRUE( bundle->Compact( compactDesc ) );
+    delete bundle;
+
+    bundle = new Bundle( desc );
+    ASSERT_EQ( bundle->GetAllAssets( ).NumElements, 3u );
+    const std::pair<AssetUri, const std::string *> expectations[] = { { nextUri, &nextContent }, { otherUri, &otherContent } };
+    for ( const auto &[ uri, expected ] : expectations )
+    {
+        BinaryReader *reader = bundle->OpenReader( uri );
+        ASSERT_NE( reader, nullptr );
+        const ByteArray data = reader->ReadBytes( static_cast<uint32_t>( expected->size( ) ) );
+        ASSERT_EQ( std::string( reinterpret_cast<const char *>( data.Elements ), data.NumElements ), *expected );
+        std::free( data.Elements );
+        delete reader;
+    }
+    delete bundle;
+}
+
+TEST_F( BundleTest, AccessTraceLayout )
+{
+    const InteropString assetDir = GetTempPath( "traced_directory" );
+    FileIO::CreateDirectories( assetDir );
+
+    const std::string names[]    = { "a.dzmesh", "b.dzmesh", "c.dztex" };
+    const std::string contents[] = { "Asset a contents", "Asset b contents", "Asset c contents" };
+    for ( int i = 0; i < 3; ++i )
+    {
+        const auto path = InteropString( ( std::string( assetDir.Get( ) ) + "/" + names[ i ] ).c_str( ) );
+        FileIO::WriteFile( path, ByteArrayView( reinterpret_cast<const Byte *>( contents[ i ].data( ) ), contents[ i ].size( ) ) );
+    }
+
+    BundleDirectoryDesc dirDesc;
+    dirDesc.DirectoryPath    = assetDir;
+    dirDesc.OutputBundlePath = GetTempPath( "untraced.dzbundle" );
+    Bundle *bundle           = Bundle::CreateFromDirectory( dirDesc );
+
+    AssetAccessTrace  trace;
+    BundleManagerDesc managerDesc;
+    managerDesc.DefaultSearchPath = tempDir;
+    BundleManager manager( managerDesc );
+    manager.MountBundle( bundle );
+    manager.SetAccessTrace( &trace );
+    for ( const char *name : { "c.dztex", "a.dzmesh", "c.dztex" } )
+    {
+        delete manager.OpenReader( AssetUri::Create( name ) );
+    }
+    manager.SetAccessTrace( nullptr );
+    delete manager.OpenReader( AssetUri::Create( "b.dzmesh" ) );
+
+    const AssetAccessArray accesses = trace.GetAccesses( );
+    ASSERT_EQ( accesses.NumElements, 3u );
+    ASSERT_LE( accesses.Elements[ 0 ].TimeNs, accesses.Elements[ 1 ].TimeNs );
+    ASSERT_LE( accesses.Elements[ 1 ].TimeNs, accesses.Elements[ 2 ].TimeNs );
+
+    const InteropString tracePath = GetTempPath( "load.dztrace" );
+    ASSERT_TRUE( trace.Save( tracePath ) );
+    AssetAccessTrace loaded;
+    ASSERT_TRUE( loaded.Load( tracePath ) );
+    ASSERT_EQ( loaded.GetAccesses( ).NumElements, 3u );
+    ASSERT_EQ( loaded.GetAccesses( ).Elements[ 2 ].TimeNs, accesses.Elements[ 2 ].TimeNs );
+
+    const AssetUriArray firstTouch = loaded.FirstTouchOrder( );
+    ASSERT_EQ( firstTouch.NumElements, 2u );
+    ASSERT_TRUE( firstTouch.Elements[ 0 ].Equals( AssetUri::Create( "c.dztex" ) ) );
+    ASSERT_TRUE( firstTouch.Elements[ 1 ].Equals( AssetUri::Create( "a.dzmesh" ) ) );
+
+    // Traced assets are laid out first in the order they were touched, the untouched asset follows
+    dirDesc.OutputBundlePath = GetTempPath( "traced.dzbundle" );
+    dirDesc.LoadOrder        = firstTouch;
+    delete Bundle::CreateFromDirectory( dirDesc );
+
+    std::vector<Byte> file( FileIO::GetFileNumBytes( dirDesc.OutputBundlePath ) );
+    FileIO::ReadFile( dirDesc.OutputBundlePath, { file.data( ), file.size( ) } );
+    const std::string fileContents( reinterpret_cast<const char *>( file.data( ) ), file.size( ) );
+    ASSERT_NE( fileContents.find( contents[ 1 ] ), std::string::npos );
+    ASSERT_LT( fileContents.find( contents[ 2 ] ), fileContents.find( contents[ 0 ] ) );
+    ASSERT_LT( fileContents.find( contents[ 0 ] ), fileContents.find( contents[ 1 ] ) );
+
+    manager.UnmountBundle( bundle );
+    delete bundle;
+}
@@ -0,0 +1,115 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <vector>
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+
+using namespace DenOfIz;
+
+class FileIOTest : public testing::Test
+{
+protected:
+    InteropString tempDir;
+
+    void SetUp( ) override
+    {
+        const std::string uniqueTempPath =
+            std::filesystem::temp_directory_path( ).string( ) + "/DenOfIzFileIOTest_" + std::to_string( std::chrono::system_clock::now( ).time_since_epoch( ).count( ) );
+        tempDir = InteropString( uniqueTempPath.c_str( ) );
+
+        FileIO::CreateDirectories( tempDir );
+    }
+
+    void TearDown( ) override
+    {
+        FileIO::RemoveAll( tempDir );
+    }
+
+    InteropString WriteTestFile( const char *filename, const std::vector<Byte> &data ) const
+    {
+        std::string path = tempDir.Get( );
+        path += std::string( "/" ) + filename;
+        FileIO::WriteFile( path.c_str( ), { data.data( ), data.size( ) } );
+        return InteropString( path.c_str( ) );
+    }
+
+    static std::vector<Byte> CreatePattern( const size_t numBytes, const uint32_t seed )
+    {
+        std::vector<Byte> data( numBytes );
+        for ( size_t i = 0; i < numBytes; ++i )
+        {
+            data[ i ] = static_cast<Byte>( ( i * 31 + seed ) & 0xFF );
+        }
+        return data;
+    }
+};
+
+TEST_F( FileIOTest, ReadFilesBatch )
+{
+    // Large enough to be split into several chunks
+    const std::vector<Byte> large     = CreatePattern( 20u << 20, 7 );
+    const std::vector<Byte> small     = CreatePattern( 4096, 3 );
+    const InteropString     largePath = WriteTestFile( "large.bin", large );
+    const InteropString     smallPath = WriteTestFile( "small.bin", small );
+
+    std::vector<Byte> largeResult( large.size( ) );
+    std::vector<Byte> headResult( 100 );
+    std::vector<Byte> tailResult( 1000 );
+
+    FileReadRequest requests[ 3 ];
+    requests[ 0 ].Path        = largePath;
+    requests[ 0 ].NumBytes    = large.size( );
+    requests[ 0 ].Destination = { largeResult.data( ), largeResult.size( ) };
+    requests[ 1 ].Path        = smallPath;
+    requests[ 1 ].Offset      = 10;
+    requests[ 1 ].NumBytes    = headResult.size( );
+    requests[ 1 ].Destination = { headResult.data( ), headResult.size( ) };
+    requests[ 2 ].Path        = smallPath;
+    requests[ 2 ].Offset      = small.size( ) - 500;
+    requests[ 2 ].NumBytes    = tailResult.size( ); // Runs past the end of the file
+    requests[ 2 ].Destination = { tailResult.data( ), tailResult.size( ) };
+
+    ASSERT_FALSE( FileIO::ReadFiles( { requests, 3 } ) );
+    ASSERT_EQ( requests[ 0 ].NumBytesRead, large.size( ) );
+    ASSERT_EQ( requests[ 1 ].NumBytesRead, headResult.size( ) );
+    ASSERT_EQ( requests[ 2 ].NumBytesRead, 500u );
+
+    ASSERT_EQ( largeResult, large );
+    ASSERT_TRUE( std::equal( headResult.begin( ), headResult.end( ), small.begin( ) + 10 ) );
+    ASSERT_TRUE( std::equal( tailResult.begin( ), tailResult.begin( ) + 500, small.end( ) - 500 ) );
+
+    // Everything in range reads completely
+    requests[ 2 ].NumBytes = 500;
+    ASSERT_TRUE( FileIO::ReadFiles( { requests, 3 } ) );
+}
+
+TEST_F( FileIOTest, ReadFilesMissingFile )
+{
+    std::vector<Byte> result( 16 );
+    FileReadRequest   request{ };
+    request.Path        = InteropString( ( std::string( tempDir.Get( ) ) + "/missing.bin" ).c_str( ) );
+    request.NumBytes    = result.size( );
+    request.Destination = { result.data( ), result.size( ) };
+
+    ASSERT_FALSE( FileIO::ReadFiles( { &request, 1 } ) );
+    ASSERT_EQ( request.NumBytesRead, 0u );
+}
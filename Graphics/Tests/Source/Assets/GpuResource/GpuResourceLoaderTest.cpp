@@ -0,0 +1,252 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+#include <vector>
+#include "DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h"
+#include "DenOfIzGraphics/Backends/GraphicsApi.h"
+#include "DenOfIzGraphics/Data/BatchResourceCopy.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    constexpr uint64_t SmallRingNumBytes = 64 * 1024; // Updates over 16 KiB get a dedicated staging buffer
+
+    std::vector<Byte> Pattern( const uint64_t numBytes, const uint32_t seed )
+    {
+        std::vector<Byte> data( numBytes );
+        for ( uint64_t i = 0; i < numBytes; ++i )
+        {
+            data[ i ] = static_cast<Byte>( i * 31 + seed );
+        }
+        return data;
+    }
+
+    // Readback memory is the copy destination, so the uploaded bytes can be checked without another copy
+    std::unique_ptr<IBufferResource> CreateReadBack( ILogicalDevice *device, const uint64_t numBytes )
+    {
+        BufferDesc bufferDesc{ };
+        bufferDesc.HeapType     = HeapType::GPU_CPU;
+        bufferDesc.InitialUsage = ResourceUsage::CopyDst;
+        bufferDesc.NumBytes     = numBytes;
+        bufferDesc.DebugName    = "GpuResourceLoaderTest_ReadBack";
+        return std::unique_ptr<IBufferResource>( device->CreateBufferResource( bufferDesc ) );
+    }
+
+    UpdateHandle QueueUpdate( GpuResourceLoader &loader, IBufferResource *buffer, const uint64_t dstOffset, const std::vector<Byte> &data )
+    {
+        BufferUpdateDesc updateDesc{ };
+        updateDesc.Buffer                      = buffer;
+        updateDesc.DstOffset                   = dstOffset;
+        updateDesc.SourceData.Data.Elements    = data.data( );
+        updateDesc.SourceData.Data.NumElements = data.size( );
+
+        UpdateHandle handle{ };
+        loader.QueueResourceUpdate( updateDesc, &handle );
+        return handle;
+    }
+
+    void ExpectContents( IBufferResource *buffer, const uint64_t offset, const std::vector<Byte> &expected )
+    {
+        const auto *mapped = static_cast<const Byte *>( buffer->MapMemory( ) );
+        ASSERT_EQ( std::memcmp( mapped + offset, expected.data( ), expected.size( ) ), 0 );
+        buffer->UnmapMemory( );
+    }
+} // namespace
+
+void HandlesCompleteInOrder( const GraphicsApi &gApi )
+{
+    const auto        device = std::unique_ptr<ILogicalDevice>( gApi.CreateAndLoadOptimalLogicalDevice( ) );
+    GpuResourceLoader loader( { .Device = device.get( ) } );
+
+    constexpr uint64_t numBytes = 256;
+    const auto         readBack = CreateReadBack( device.get( ), numBytes * 4 );
+    const auto         data     = Pattern( numBytes, 7 );
+
+    std::vector<UpdateHandle> handles;
+    for ( uint32_t i = 0; i < 4; ++i )
+    {
+        handles.push_back( QueueUpdate( loader, readBack.get( ), i * numBytes, data ) );
+        if ( i > 0 )
+        {
+            ASSERT_GT( handles[ i ].Value, handles[ i - 1 ].Value );
+        }
+    }
+    ASSERT_FALSE( loader.IsHandleSubmitted( handles.back( ) ) );
+    ASSERT_FALSE( loader.IsUpdateComplete( handles.back( ) ) );
+    ASSERT_EQ( loader.PendingUpdates( ), 4 );
+    ASSERT_TRUE( loader.IsUpdateComplete( UpdateHandle{ } ) );
+
+    const FlushUpdatesResult flushed = loader.FlushResourceUpdates( );
+    ASSERT_NE( flushed.Fence, nullptr );
+    ASSERT_TRUE( loader.IsHandleSubmitted( handles.back( ) ) );
+
+    flushed.Fence->Wait( );
+    // The fence signaled, polling retires the batch without waiting
+    ASSERT_TRUE( loader.IsUpdateComplete( handles.back( ) ) );
+    for ( const UpdateHandle &handle : handles )
+    {
+        ASSERT_TRUE( loader.IsUpdateComplete( handle ) );
+    }
+    ASSERT_EQ( loader.PendingUpdates( ), 0 );
+    ASSERT_EQ( loader.FlushResourceUpdates( ).Fence, nullptr );
+
+    for ( uint32_t i = 0; i < 4; ++i )
+    {
+        ExpectContents( readBack.get( ), i * numBytes, data );
+    }
+}
+
+void WaitForUpdateSubmitsRecordedUpdates( const GraphicsApi &gApi )
+{
+    const auto        device = std::unique_ptr<ILogicalDevice>( gApi.CreateAndLoadOptimalLogicalDevice( ) );
+    GpuResourceLoader loader( { .Device = device.get( ) } );
+
+    const auto         data     = Pattern( 1024, 3 );
+    const auto         readBack = CreateReadBack( device.get( ), data.size( ) );
+    const UpdateHandle handle   = QueueUpdate( loader, readBack.get( ), 0, data );
+    ASSERT_NE( handle.Value, 0 );
+
+    loader.WaitForUpdate( handle ); // Never flushed
+    ASSERT_TRUE( loader.IsUpdateComplete( handle ) );
+    ASSERT_EQ( loader.GetLastCompletedHandle( ).Value, handle.Value );
+    ExpectContents( readBack.get( ), 0, data );
+}
+
+void StagingRingWrapsAround( const GraphicsApi &gApi )
+{
+    const auto        device = std::unique_ptr<ILogicalDevice>( gApi.CreateAndLoadOptimalLogicalDevice( ) );
+    GpuResourceLoader loader( { .Device = device.get( ), .StagingRingNumBytes = SmallRingNumBytes } );
+
+    // 32 updates of 12 KiB go around the 64 KiB ring several times and force submissions before the flush
+    constexpr uint32_t numUpdates = 32;
+    constexpr uint64_t numBytes   = 12 * 1024;
+    const auto         readBack   = CreateReadBack( device.get( ), numUpdates * numBytes );
+
+    std::vector<std::vector<Byte>> data;
+    UpdateHandle                   lastHandle{ };
+    for ( uint32_t i = 0; i < numUpdates; ++i )
+    {
+        data.push_back( Pattern( numBytes, i ) );
+        lastHandle = QueueUpdate( loader, readBack.get( ), i * numBytes, data.back( ) );
+    }
+    ASSERT_GT( loader.GetLastSubmittedHandle( ).Value, 0 );
+
+    loader.FlushResourceUpdates( );
+    loader.WaitForUpdate( lastHandle );
+    ASSERT_EQ( loader.PendingUpdates( ), 0 );
+    for ( uint32_t i = 0; i < numUpdates; ++i )
+    {
+        ExpectContents( readBack.get( ), i * numBytes, data[ i ] );
+    }
+}
+
+void OversizeUpdatesUseDedicatedBuffers( const GraphicsApi &gApi )
+{
+    const auto        device = std::unique_ptr<ILogicalDevice>( gApi.CreateAndLoadOptimalLogicalDevice( ) );
+    GpuResourceLoader loader( { .Device = device.get( ), .StagingRingNumBytes = SmallRingNumBytes } );
+
+    const auto large    = Pattern( 1024 * 1024, 11 );
+    const auto small    = Pattern( 4 * 1024, 13 );
+    const auto readBack = CreateReadBack( device.get( ), large.size( ) + small.size( ) );
+
+    const UpdateHandle largeHandle = QueueUpdate( loader, readBack.get( ), 0, large );
+    const UpdateHandle smallHandle = QueueUpdate( loader, readBack.get( ), large.size( ), small );
+    ASSERT_GT( smallHandle.Value, largeHandle.Value );
+    ASSERT_FALSE( loader.IsHandleSubmitted( largeHandle ) ); // The ring was not full, nothing forced a submission
+
+    loader.WaitForAllUpdates( );
+    ASSERT_TRUE( loader.IsUpdateComplete( largeHandle ) );
+    ASSERT_TRUE( loader.IsUpdateComplete( smallHandle ) );
+    ExpectContents( readBack.get( ), 0, large );
+    ExpectContents( readBack.get( ), large.size( ), small );
+}
+
+void BatchResourceCopyUsesSharedLoader( const GraphicsApi &gApi )
+{
+    const auto device   = std::unique_ptr<ILogicalDevice>( gApi.CreateAndLoadOptimalLogicalDevice( ) );
+    const auto data     = Pattern( 2048, 17 );
+    const auto readBack = CreateReadBack( device.get( ), data.size( ) );
+
+    {
+        BatchResourceCopy batchCopy( device.get( ), false );
+        batchCopy.Begin( );
+        CopyToGpuBufferDesc copyDesc{ };
+        copyDesc.DstBuffer = readBack.get( );
+        copyDesc.Data      = { data.data( ), data.size( ) };
+        batchCopy.CopyToGPUBuffer( copyDesc );
+        batchCopy.Submit( );
+    }
+
+    GpuResourceLoader *shared = GpuResourceLoader::Shared( device.get( ) );
+    ASSERT_EQ( shared->PendingUpdates( ), 0 );
+    ASSERT_TRUE( shared->IsUpdateComplete( shared->GetLastSubmittedHandle( ) ) );
+    ExpectContents( readBack.get( ), 0, data );
+}
+
+TEST( GpuResourceLoaderTest, HandlesCompleteInOrder_Win32_DX12 )
+{
+    HandlesCompleteInOrder( GraphicsApi( { .Windows = APIPreferenceWindows::DirectX12 } ) );
+}
+
+TEST( GpuResourceLoaderTest, HandlesCompleteInOrder_Win32_Vulkan )
+{
+    HandlesCompleteInOrder( GraphicsApi( { .Windows = APIPreferenceWindows::Vulkan } ) );
+}
+
+TEST( GpuResourceLoaderTest, WaitForUpdateSubmitsRecordedUpdates_Win32_DX12 )
+{
+    WaitForUpdateSubmitsRecordedUpdates( GraphicsApi( { .Windows = APIPreferenceWindows::DirectX12 } ) );
+}
+
+TEST( GpuResourceLoaderTest, WaitForUpdateSubmitsRecordedUpdates_Win32_Vulkan )
+{
+    WaitForUpdateSubmitsRecordedUpdates( GraphicsApi( { .Windows = APIPreferenceWindows::Vulkan } ) );
+}
+
+TEST( GpuResourceLoaderTest, StagingRingWrapsAround_Win32_DX12 )
+{
+    StagingRingWrapsAround( GraphicsApi( { .Windows = APIPreferenceWindows::DirectX12 } ) );
+}
+
+TEST( GpuResourceLoaderTest, StagingRingWrapsAround_Win32_Vulkan )
+{
+    StagingRingWrapsAround( GraphicsApi( { .Windows = APIPreferenceWindows::Vulkan } ) );
+}
+
+TEST( GpuResourceLoaderTest, OversizeUpdatesUseDedicatedBuffers_Win32_DX12 )
+{
+    OversizeUpdatesUseDedicatedBuffers( GraphicsApi( { .Windows = APIPreferenceWindows::DirectX12 } ) );
+}
+
+TEST( GpuResourceLoaderTest, OversizeUpdatesUseDedicatedBuffers_Win32_Vulkan )
+{
+    OversizeUpdatesUseDedicatedBuffers( GraphicsApi( { .Windows = APIPreferenceWindows::Vulkan } ) );
+}
+
+TEST( GpuResourceLoaderTest, BatchResourceCopyUsesSharedLoader_Win32_DX12 )
+{
+    BatchResourceCopyUsesSharedLoader( GraphicsApi( { .Windows = APIPreferenceWindows::DirectX12 } ) );
+}
+
+TEST( GpuResourceLoaderTest, BatchResourceCopyUsesSharedLoader_Win32_Vulkan )
+{
+    BatchResourceCopyUsesSharedLoader( GraphicsApi( { .Windows = APIPreferenceWindows::Vulkan } ) );
+}
@@ -0,0 +1,145 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <filesystem>
+#include <fstream>
+
+#include "../../TestOutputDirectory.h"
+#include "DenOfIzGraphics/Assets/FileSystem/FileIO.h"
+#include "DenOfIzGraphics/Assets/Import/BatchImporter.h"
+#include "DenOfIzGraphics/Assets/Serde/Material/MaterialAssetReader.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    const std::string BATCH_OUTPUT_DIR   = std::string( DZ_TEST_DATA_DEST_DIR ) + "/Batch";
+    const std::string BATCH_RESOURCE_DIR = DZ_TEST_DATA_SRC_DIR;
+} // namespace
+
+class BatchImporterTest : public TestOutputDirectory
+{
+protected:
+    BatchImporterTest( ) : TestOutputDirectory( BATCH_OUTPUT_DIR )
+    {
+    }
+
+    static uint32_t CountAssetsWithSuffix( const ImporterResult &result, const std::string &suffix )
+    {
+        uint32_t count = 0;
+        for ( uint32_t i = 0; i < result.CreatedAssets.NumElements; ++i )
+        {
+            count += std::string( result.CreatedAssets.Elements[ i ].Path.Get( ) ).ends_with( suffix ) ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+TEST_F( BatchImporterTest, ImportWithoutSourcesFails )
+{
+    const BatchImporter importer;
+    BatchImportDesc     desc;
+    desc.TargetDirectory = BATCH_OUTPUT_DIR.c_str( );
+
+    const ImporterResult result = importer.Import( desc );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::InvalidParameters );
+    ASSERT_EQ( result.CreatedAssets.NumElements, 0 );
+}
+
+TEST_F( BatchImporterTest, ImportMissingManifestFails )
+{
+    const BatchImporter importer;
+    BatchImportDesc     desc;
+    desc.ManifestPath    = ( BATCH_OUTPUT_DIR + "/DoesNotExist.txt" ).c_str( );
+    desc.TargetDirectory = BATCH_OUTPUT_DIR.c_str( );
+
+    const ImporterResult result = importer.Import( desc );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::FileNotFound );
+}
+
+// Texture.png is both a source in the directory and referenced by Fox.gltf, it must be imported once and referenced by the material
+TEST_F( BatchImporterTest, ImportDirectorySharesReferencedTexture )
+{
+    const std::string modelsDir = BATCH_RESOURCE_DIR + "/Models";
+    if ( !FileIO::FileExists( ( modelsDir + "/Fox.gltf" ).c_str( ) ) )
+    {
+        GTEST_SKIP( ) << "Skipping, required resource file not found: " << modelsDir << "/Fox.gltf";
+    }
+
+    BundleDesc bundleDesc;
+    bundleDesc.Path              = ( BATCH_OUTPUT_DIR + "/Batch.dzbundle" ).c_str( );
+    bundleDesc.CreateIfNotExists = true;
+    Bundle bundle( bundleDesc );
+
+    const BatchImporter importer;
+    BatchImportDesc     desc;
+    desc.SourceDirectory = modelsDir.c_str( );
+    desc.TargetDirectory = BATCH_OUTPUT_DIR.c_str( );
+    desc.TargetBundle    = &bundle;
+
+    const ImporterResult result = importer.Import( desc );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success ) << result.ErrorMessage.Get( );
+    ASSERT_EQ( CountAssetsWithSuffix( result, ".dztex" ), 1 );
+    ASSERT_EQ( CountAssetsWithSuffix( result, ".dzmesh" ), 1 );
+
+    AssetUri textureUri;
+    AssetUri materialUri;
+    for ( uint32_t i = 0; i < result.CreatedAssets.NumElements; ++i )
+    {
+        const AssetUri &uri = result.CreatedAssets.Elements[ i ];
+        ASSERT_TRUE( bundle.Exists( uri ) ) << uri.Path.Get( );
+        const std::string path = uri.Path.Get( );
+        if ( path.ends_with( ".dztex" ) )
+        {
+            textureUri = uri;
+        }
+        if ( path.ends_with( ".dzmat" ) )
+        {
+            materialUri = uri;
+        }
+    }
+
+    BinaryReader        materialFile( ( BATCH_OUTPUT_DIR + "/" + materialUri.Path.Get( ) ).c_str( ) );
+    MaterialAssetReader materialReader( { &materialFile } );
+    const auto          material = std::unique_ptr<MaterialAsset>( materialReader.Read( ) );
+    ASSERT_TRUE( material->AlbedoMapRef.Equals( textureUri ) );
+}
+
+// Both sources would be written to rock.dztex by concurrent jobs, the import has to fail before either of them runs
+TEST_F( BatchImporterTest, ImportSameNameInDifferentDirectoriesFails )
+{
+    const std::string sourceDir = BATCH_OUTPUT_DIR + "/CollidingSources";
+    for ( const char *subdirectory : { "/a", "/b" } )
+    {
+        std::filesystem::create_directories( sourceDir + subdirectory );
+        std::ofstream( sourceDir + subdirectory + "/rock.png", std::ios::binary ) << "not a real image";
+    }
+
+    const BatchImporter importer;
+    BatchImportDesc     desc;
+    desc.SourceDirectory = sourceDir.c_str( );
+    desc.TargetDirectory = BATCH_OUTPUT_DIR.c_str( );
+
+    const ImporterResult result = importer.Import( desc );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::InvalidParameters );
+    ASSERT_NE( std::string( result.ErrorMessage.Get( ) ).find( "rock.png" ), std::string::npos );
+    ASSERT_EQ( result.CreatedAssets.NumElements, 0 );
+    ASSERT_FALSE( std::filesystem::exists( BATCH_OUTPUT_DIR + "/rock.dztex" ) );
+}
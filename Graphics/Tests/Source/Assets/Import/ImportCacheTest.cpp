@@ -0,0 +1,125 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <filesystem>
+#include <fstream>
+
+#include "../../TestOutputDirectory.h"
+#include "DenOfIzGraphics/Assets/Import/ImportCache.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    const std::string CACHE_TEST_DIR = std::string( DZ_TEST_DATA_DEST_DIR ) + "/ImportCache";
+} // namespace
+
+class ImportCacheTest : public TestOutputDirectory
+{
+protected:
+    std::string m_source;
+    std::string m_output;
+
+    ImportCacheTest( ) : TestOutputDirectory( CACHE_TEST_DIR )
+    {
+    }
+
+    void SetUp( ) override
+    {
+        TestOutputDirectory::SetUp( );
+        m_source = WriteFile( "Source.txt", "source" );
+        m_output = WriteFile( "Output.dzmesh", "output" );
+    }
+
+    static std::string WriteFile( const std::string &name, const std::string &content )
+    {
+        const std::string path = CACHE_TEST_DIR + "/" + name;
+        std::ofstream     file( path, std::ios::binary | std::ios::trunc );
+        file << content;
+        return path;
+    }
+
+    [[nodiscard]] ImportCacheRecord Record( ) const
+    {
+        ImportCacheRecord record;
+        record.SourceFilePath = m_source;
+        record.ImporterHash   = 1;
+        record.OptionsHash    = 2;
+        record.InputFiles     = { m_source };
+        record.OutputFiles    = { m_output };
+        record.CreatedAssets  = { AssetUri::Create( "Output.dzmesh" ) };
+        return record;
+    }
+};
+
+TEST_F( ImportCacheTest, FindsUnchangedImport )
+{
+    ImportCache cache;
+    cache.Store( Record( ) );
+
+    std::vector<AssetUri> assets;
+    ASSERT_TRUE( cache.Find( m_source, 1, 2, assets ) );
+    ASSERT_EQ( assets.size( ), 1 );
+    ASSERT_TRUE( assets[ 0 ].Equals( AssetUri::Create( "Output.dzmesh" ) ) );
+}
+
+TEST_F( ImportCacheTest, MissesOnDifferentImporterOrOptions )
+{
+    ImportCache cache;
+    cache.Store( Record( ) );
+
+    std::vector<AssetUri> assets;
+    ASSERT_FALSE( cache.Find( m_source, 3, 2, assets ) );
+    ASSERT_FALSE( cache.Find( m_source, 1, 3, assets ) );
+}
+
+TEST_F( ImportCacheTest, MissesWhenInputOrOutputChanges )
+{
+    ImportCache cache;
+    cache.Store( Record( ) );
+
+    std::vector<AssetUri> assets;
+    WriteFile( "Source.txt", "changed" );
+    ASSERT_FALSE( cache.Find( m_source, 1, 2, assets ) );
+
+    WriteFile( "Source.txt", "source" );
+    ASSERT_TRUE( cache.Find( m_source, 1, 2, assets ) ) << "Same content with a new modification time is not a change";
+
+    std::filesystem::remove( m_output );
+    ASSERT_FALSE( cache.Find( m_source, 1, 2, assets ) );
+}
+
+TEST_F( ImportCacheTest, SaveAndLoadRoundTrip )
+{
+    const std::string cachePath = CACHE_TEST_DIR + "/Import.dzcache";
+    {
+        ImportCache cache;
+        cache.Store( Record( ) );
+        ASSERT_TRUE( cache.Save( cachePath.c_str( ) ) );
+    }
+
+    ImportCache cache;
+    ASSERT_TRUE( cache.Load( cachePath.c_str( ) ) );
+    ASSERT_EQ( cache.NumEntries( ), 1 );
+
+    std::vector<AssetUri> assets;
+    ASSERT_TRUE( cache.Find( m_source, 1, 2, assets ) );
+    ASSERT_EQ( assets.size( ), 1 );
+}
@@ -0,0 +1,240 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <filesystem>
+#include <fstream>
+
+#include "../../TestOutputDirectory.h"
+#include "DenOfIzGraphics/Assets/Import/TextureImporter.h"
+#include "DenOfIzGraphics/Assets/Serde/Texture/TextureAssetReader.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    const std::string TEXTURE_TEST_DIR = std::string( DZ_TEST_DATA_DEST_DIR ) + "/TextureImporter";
+} // namespace
+
+class TextureImporterTest : public TestOutputDirectory
+{
+protected:
+    TextureImporter m_importer; // Owns the created asset uris of every result
+
+    TextureImporterTest( ) : TestOutputDirectory( TEXTURE_TEST_DIR )
+    {
+    }
+
+    // Uncompressed 32 bit TGA, texels are RGBA and stored top row first
+    static std::string WriteTga( const std::string &name, const uint16_t width, const uint16_t height, const std::vector<uint8_t> &rgba )
+    {
+        uint8_t header[ 18 ]{ };
+        header[ 2 ]  = 2;
+        header[ 12 ] = width & 0xFF;
+        header[ 13 ] = width >> 8;
+        header[ 14 ] = height & 0xFF;
+        header[ 15 ] = height >> 8;
+        header[ 16 ] = 32;
+        header[ 17 ] = 0x28; // 8 alpha bits, top left origin
+
+        const std::string path = TEXTURE_TEST_DIR + "/" + name;
+        std::ofstream     file( path, std::ios::binary | std::ios::trunc );
+        file.write( reinterpret_cast<const char *>( header ), sizeof( header ) );
+        for ( size_t i = 0; i < rgba.size( ); i += 4 )
+        {
+            const uint8_t bgra[ 4 ]{ rgba[ i + 2 ], rgba[ i + 1 ], rgba[ i ], rgba[ i + 3 ] };
+            file.write( reinterpret_cast<const char *>( bgra ), sizeof( bgra ) );
+        }
+        return path;
+    }
+
+    [[nodiscard]] ImporterResult Import( const std::string &path, const bool generateMips, const TextureMipFilter filter = TextureMipFilter::Kaiser,
+                                         const bool isSrgb = true, const TextureCompression compression = TextureCompression::None,
+                                         const TextureRole role = TextureRole::Color ) const
+    {
+        TextureImportDesc desc;
+        desc.SourceFilePath  = path.c_str( );
+        desc.TargetDirectory = TEXTURE_TEST_DIR.c_str( );
+        desc.GenerateMips    = generateMips;
+        desc.MipFilter       = filter;
+        desc.IsSrgb          = isSrgb;
+        desc.Compression     = compression;
+        desc.Role            = role;
+        return m_importer.Import( desc );
+    }
+
+    static std::vector<uint8_t> ReadMip( const ImporterResult &result, const uint32_t mipLevel, uint32_t &numMipLevels )
+    {
+        Format format;
+        return ReadMip( result, mipLevel, numMipLevels, format );
+    }
+
+    static std::vector<uint8_t> ReadMip( const ImporterResult &result, const uint32_t mipLevel, uint32_t &numMipLevels, Format &format )
+    {
+        // The importer accumulates created assets, the last one is from this import
+        BinaryReader                        reader( result.CreatedAssets.Elements[ result.CreatedAssets.NumElements - 1 ].Path );
+        TextureAssetReader                  assetReader( { &reader } );
+        const std::unique_ptr<TextureAsset> asset( assetReader.Read( ) );
+        numMipLevels = asset->MipLevels;
+        format       = asset->Format;
+
+        const ByteArray            mip = assetReader.ReadRaw( mipLevel );
+        const std::vector<uint8_t> data( mip.Elements, mip.Elements + mip.NumElements );
+        std::free( mip.Elements );
+        return data;
+    }
+};
+
+TEST_F( TextureImporterTest, GeneratesFullMipChain )
+{
+    std::vector<uint8_t> rgba( 16 * 8 * 4 );
+    for ( size_t i = 0; i < rgba.size( ); i += 4 )
+    {
+        rgba[ i ]     = 200;
+        rgba[ i + 1 ] = 17;
+        rgba[ i + 2 ] = 90;
+        rgba[ i + 3 ] = 255;
+    }
+
+    const ImporterResult result = Import( WriteTga( "Solid.tga", 16, 8, rgba ), true );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+    ASSERT_EQ( result.CreatedAssets.NumElements, 1 );
+
+    uint32_t                   numMipLevels = 0;
+    const std::vector<uint8_t> lastMip      = ReadMip( result, 4, numMipLevels );
+    ASSERT_EQ( numMipLevels, 5 );
+    ASSERT_EQ( lastMip.size( ), 4 );
+    // Filtering a constant image must not change it, in linear or sRGB space
+    ASSERT_EQ( lastMip[ 0 ], 200 );
+    ASSERT_EQ( lastMip[ 1 ], 17 );
+    ASSERT_EQ( lastMip[ 2 ], 90 );
+    ASSERT_EQ( lastMip[ 3 ], 255 );
+
+    const std::vector<uint8_t> firstMip = ReadMip( result, 0, numMipLevels );
+    ASSERT_EQ( firstMip, rgba );
+}
+
+TEST_F( TextureImporterTest, BoxFilterAveragesInLinearSpace )
+{
+    const std::vector<uint8_t> rgba{ 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0 };
+    const std::string          path = WriteTga( "Checker.tga", 2, 2, rgba );
+
+    uint32_t       numMipLevels = 0;
+    ImporterResult result       = Import( path, true, TextureMipFilter::Box, false );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+    std::vector<uint8_t> mip = ReadMip( result, 1, numMipLevels );
+    ASSERT_EQ( mip, std::vector<uint8_t>( { 128, 128, 128, 128 } ) );
+
+    // Half of the light is 188 in sRGB, alpha is never sRGB encoded
+    result = Import( path, true, TextureMipFilter::Box, true );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+    mip = ReadMip( result, 1, numMipLevels );
+    ASSERT_EQ( mip, std::vector<uint8_t>( { 188, 188, 188, 128 } ) );
+}
+
+TEST_F( TextureImporterTest, OddSizesRoundDown )
+{
+    const std::vector<uint8_t> rgba( 5 * 3 * 4, 255 );
+    const ImporterResult       result = Import( WriteTga( "Odd.tga", 5, 3, rgba ), true );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+
+    uint32_t                   numMipLevels = 0;
+    const std::vector<uint8_t> mip          = ReadMip( result, 1, numMipLevels );
+    ASSERT_EQ( numMipLevels, 3 );
+    ASSERT_EQ( mip.size( ), 2 * 1 * 4 );
+    ASSERT_EQ( mip, std::vector<uint8_t>( 2 * 4, 255 ) );
+}
+
+TEST_F( TextureImporterTest, GenerateMipsDisabledKeepsSingleMip )
+{
+    const std::vector<uint8_t> rgba( 4 * 4 * 4, 255 );
+    const ImporterResult       result = Import( WriteTga( "Single.tga", 4, 4, rgba ), false );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+
+    uint32_t numMipLevels = 0;
+    ReadMip( result, 0, numMipLevels );
+    ASSERT_EQ( numMipLevels, 1 );
+}
+
+TEST_F( TextureImporterTest, AutoCompressionFollowsRole )
+{
+    const std::vector<uint8_t> rgba( 16 * 16 * 4, 255 );
+    const std::string          path = WriteTga( "Compressed.tga", 16, 16, rgba );
+
+    const std::pair<TextureRole, Format> roles[ 3 ]{ { TextureRole::Color, Format::BC7Unorm }, { TextureRole::Normal, Format::BC5Unorm }, { TextureRole::Mask, Format::BC4Unorm } };
+    for ( const auto &[ role, expectedFormat ] : roles )
+    {
+        const ImporterResult result = Import( path, true, TextureMipFilter::Kaiser, true, TextureCompression::Auto, role );
+        ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+
+        uint32_t                   numMipLevels = 0;
+        Format                     format       = Format::Undefined;
+        const std::vector<uint8_t> firstMip     = ReadMip( result, 0, numMipLevels, format );
+        const uint32_t             blockBytes   = format == Format::BC4Unorm ? 8 : 16;
+        ASSERT_EQ( format, expectedFormat );
+        ASSERT_EQ( numMipLevels, 5 );
+        ASSERT_EQ( firstMip.size( ), 4 * 4 * blockBytes );
+        // Mips smaller than a block still take a whole block
+        ASSERT_EQ( ReadMip( result, 4, numMipLevels ).size( ), blockBytes );
+    }
+}
+
+TEST_F( TextureImporterTest, CompressesSolidBlocksExactly )
+{
+    std::vector<uint8_t> rgba( 8 * 4 * 4 );
+    for ( size_t i = 0; i < rgba.size( ); i += 4 )
+    {
+        rgba[ i ]     = 200;
+        rgba[ i + 1 ] = 17;
+        rgba[ i + 2 ] = 90;
+        rgba[ i + 3 ] = 255;
+    }
+    const std::string path = WriteTga( "SolidCompressed.tga", 8, 4, rgba );
+
+    uint32_t       numMipLevels = 0;
+    ImporterResult result       = Import( path, false, TextureMipFilter::Kaiser, true, TextureCompression::BC5 );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+    // Both endpoints are the value and every index selects the first one
+    const std::vector<uint8_t> bc5Block{ 200, 200, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0 };
+    std::vector<uint8_t>       mip = ReadMip( result, 0, numMipLevels );
+    ASSERT_EQ( mip.size( ), 2 * bc5Block.size( ) );
+    ASSERT_TRUE( std::equal( bc5Block.begin( ), bc5Block.end( ), mip.begin( ) ) );
+    ASSERT_TRUE( std::equal( bc5Block.begin( ), bc5Block.end( ), mip.begin( ) + bc5Block.size( ) ) );
+
+    result = Import( path, false, TextureMipFilter::Kaiser, true, TextureCompression::BC1 );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+    mip = ReadMip( result, 0, numMipLevels );
+    ASSERT_EQ( mip.size( ), 2 * 8 );
+    const uint16_t color0 = mip[ 0 ] | mip[ 1 ] << 8;
+    ASSERT_EQ( color0 >> 11, 24 ); // Rounded 200 * 31 / 255
+    ASSERT_EQ( color0 >> 5 & 63, 4 );
+    ASSERT_EQ( color0 & 31, 11 );
+}
+
+TEST_F( TextureImporterTest, CompressionSkipsSizesThatAreNotBlockAligned )
+{
+    const std::vector<uint8_t> rgba( 6 * 6 * 4, 255 );
+    const ImporterResult       result = Import( WriteTga( "Unaligned.tga", 6, 6, rgba ), false, TextureMipFilter::Kaiser, true, TextureCompression::BC7 );
+    ASSERT_EQ( result.ResultCode, ImporterResultCode::Success );
+
+    uint32_t numMipLevels = 0;
+    Format   format       = Format::Undefined;
+    ASSERT_EQ( ReadMip( result, 0, numMipLevels, format ), rgba );
+    ASSERT_EQ( format, Format::R8G8B8A8Unorm );
+}
@@ -18,6 +18,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+
 #include "../../../../Internal/DenOfIzGraphicsInternal/Utilities/DZArenaHelper.h"
 #include "../../TestComparators.h"
 #include "DenOfIzGraphics/Assets/Serde/Mesh/MeshAsset.h"
@@ -311,3 +313,148 @@ TEST_F( MeshAssetSerdeTest, WriteAndReadBack )
         ASSERT_FLOAT_EQ( readDeltas0.Elements[ i ].Position.Z, smileDeltas[ i ].Position.Z );
     }
 }
+
+TEST_F( MeshAssetSerdeTest, DecodeVerticesToLayouts )
+{
+    using namespace DenOfIz;
+
+    constexpr uint32_t numVertices = 300; // Spans more than one decode block
+    MeshAsset          asset;
+    asset.Name                            = "DecodeMesh";
+    asset.Uri                             = AssetUri::Create( "test/DecodeMesh.dzmesh" );
+    asset.NumLODs                         = 1;
+    asset.EnabledAttributes.Color         = true;
+    asset.EnabledAttributes.Tangent       = false;
+    asset.EnabledAttributes.Bitangent     = false;
+    asset.AttributeConfig.NumUVAttributes = 2;
+
+    ColorFormat colorFormats[]         = { ColorFormat::RGB };
+    asset.AttributeConfig.ColorFormats = { colorFormats, 1 };
+    SubMeshData subMesh;
+    subMesh.Name        = "Strip";
+    subMesh.NumVertices = numVertices;
+    asset.SubMeshes     = { &subMesh, 1 };
+
+    std::vector<MeshVertex> vertices( numVertices );
+    std::vector<Float_2>    uvs( numVertices * 2 );
+    std::vector<Float_4>    colors( numVertices );
+    for ( uint32_t i = 0; i < numVertices; ++i )
+    {
+        const float t       = static_cast<float>( i ) / numVertices;
+        MeshVertex &vertex  = vertices[ i ];
+        vertex.Position     = { t * 10.0f, -t, 2.0f * t, 1.0f };
+        vertex.Normal       = { t, -t, 0.5f, 0.0f };
+        uvs[ i * 2 ]        = { t, 1.0f - t };
+        uvs[ i * 2 + 1 ]    = { 0.25f, t * 0.5f };
+        colors[ i ]         = { t, 0.5f, 1.0f - t, 1.0f };
+        vertex.UVs          = { &uvs[ i * 2 ], 2 };
+        vertex.Colors       = { &colors[ i ], 1 };
+        vertex.BlendIndices = { i % 7, i % 300, 1, 65535 };
+        vertex.BoneWeights  = { t, 1.0f - t, 0.0f, 0.0f };
+    }
+
+    BinaryContainer container;
+    {
+        BinaryWriter    binaryWriter( container );
+        MeshAssetWriter writer( MeshAssetWriterDesc{ &binaryWriter } );
+        writer.Write( asset );
+        for ( const auto &v : vertices )
+        {
+            writer.AddVertex( v );
+        }
+        writer.FinalizeAsset( );
+    }
+
+    BinaryReader    reader( container );
+    MeshAssetReader meshReader( MeshAssetReaderDesc{ &reader } );
+    const auto      readAsset = std::unique_ptr<MeshAsset>( meshReader.Read( ) );
+    const auto     &stream    = readAsset->SubMeshes.Elements[ 0 ].VertexStream;
+    ASSERT_EQ( meshReader.NumVertices( stream ), numVertices );
+
+    // Interleaved: float3 position, snorm8 normal, half2 uv1, unorm8 color, uint16 indices, unorm16 weights
+    constexpr uint32_t        stride = 40;
+    std::vector<Byte>         interleaved( numVertices * stride );
+    VertexDecodeTarget        interleavedTarget{ { interleaved.data( ), interleaved.size( ) }, stride };
+    VertexAttributeLayoutDesc interleavedLayout[] = {
+        { VertexAttributeSemantic::Position, 0, Format::R32G32B32Float, 0, 0 },         { VertexAttributeSemantic::Normal, 0, Format::R8G8B8A8Snorm, 0, 12 },
+        { VertexAttributeSemantic::UV, 1, Format::R16G16Float, 0, 16 },                 { VertexAttributeSemantic::Color, 0, Format::R8G8B8A8Unorm, 0, 20 },
+        { VertexAttributeSemantic::BlendIndices, 0, Format::R16G16B16A16Uint, 0, 24 }, { VertexAttributeSemantic::BlendWeights, 0, Format::R16G16B16A16Unorm, 0, 32 },
+    };
+    DecodeVerticesDesc interleavedDesc{ };
+    interleavedDesc.Stream     = stream;
+    interleavedDesc.Attributes = { interleavedLayout, std::size( interleavedLayout ) };
+    interleavedDesc.Targets    = { &interleavedTarget, 1 };
+    ASSERT_EQ( meshReader.DecodeVertices( interleavedDesc ), numVertices );
+
+    for ( uint32_t i = 0; i < numVertices; ++i )
+    {
+        const Byte       *vertex = interleaved.data( ) + i * stride;
+        const MeshVertex &source = vertices[ i ];
+        float             position[ 3 ];
+        std::memcpy( position, vertex, sizeof( position ) );
+        ASSERT_FLOAT_EQ( position[ 0 ], source.Position.X );
+        ASSERT_FLOAT_EQ( position[ 1 ], source.Position.Y );
+        ASSERT_FLOAT_EQ( position[ 2 ], source.Position.Z );
+
+        const auto *normal = reinterpret_cast<const int8_t *>( vertex + 12 );
+        ASSERT_EQ( normal[ 0 ], static_cast<int8_t>( std::lrintf( source.Normal.X * 127.0f ) ) );
+        ASSERT_EQ( normal[ 1 ], static_cast<int8_t>( std::lrintf( source.Normal.Y * 127.0f ) ) );
+        ASSERT_EQ( normal[ 3 ], 0 );
+
+        uint16_t uv[ 2 ];
+        std::memcpy( uv, vertex + 16, sizeof( uv ) );
+        ASSERT_EQ( uv[ 0 ], 0x3400 ); // 0.25 in half precision
+        const float halfV = std::ldexp( static_cast<float>( ( uv[ 1 ] & 0x3FF ) | 0x400 ), ( uv[ 1 ] >> 10 & 0x1F ) - 25 );
+        ASSERT_NEAR( uv[ 1 ] == 0 ? 0.0f : halfV, source.UVs.Elements[ 1 ].Y, 1e-3f );
+
+        const Byte *color = vertex + 20;
+        ASSERT_EQ( color[ 0 ], std::lrintf( colors[ i ].X * 255.0f ) );
+        ASSERT_EQ( color[ 1 ], 128 );
+        ASSERT_EQ( color[ 3 ], 255 ); // RGB source, alpha is filled in
+
+        uint16_t indices[ 4 ];
+        std::memcpy( indices, vertex + 24, sizeof( indices ) );
+        ASSERT_EQ( indices[ 0 ], i % 7 );
+        ASSERT_EQ( indices[ 1 ], i % 300 );
+        ASSERT_EQ( indices[ 3 ], 65535 );
+
+        uint16_t weights[ 4 ];
+        std::memcpy( weights, vertex + 32, sizeof( weights ) );
+        ASSERT_EQ( weights[ 0 ], std::lrintf( source.BoneWeights.X * 65535.0f ) );
+        ASSERT_EQ( weights[ 1 ], std::lrintf( source.BoneWeights.Y * 65535.0f ) );
+        ASSERT_EQ( weights[ 2 ], 0 );
+    }
+
+    // Split: float4 positions and float2 uv0 in separate streams
+    std::vector<Float_4>      positions( numVertices );
+    std::vector<Float_2>      uv0( numVertices );
+    VertexDecodeTarget        splitTargets[] = { { { reinterpret_cast<Byte *>( positions.data( ) ), positions.size( ) * sizeof( Float_4 ) }, sizeof( Float_4 ) },
+                                                 { { reinterpret_cast<Byte *>( uv0.data( ) ), uv0.size( ) * sizeof( Float_2 ) }, sizeof( Float_2 ) } };
+    VertexAttributeLayoutDesc splitLayout[]  = { { VertexAttributeSemantic::Position, 0, Format::R32G32B32A32Float, 0, 0 },
+                                                 { VertexAttributeSemantic::UV, 0, Format::R32G32Float, 1, 0 } };
+    DecodeVerticesDesc        splitDesc{ };
+    splitDesc.Stream     = stream;
+    splitDesc.Attributes = { splitLayout, std::size( splitLayout ) };
+    splitDesc.Targets    = { splitTargets, std::size( splitTargets ) };
+    ASSERT_EQ( meshReader.DecodeVertices( splitDesc ), numVertices );
+    for ( uint32_t i = 0; i < numVertices; ++i )
+    {
+        ASSERT_FLOAT_EQ( positions[ i ].X, vertices[ i ].Position.X );
+        ASSERT_FLOAT_EQ( positions[ i ].W, vertices[ i ].Position.W );
+        ASSERT_FLOAT_EQ( uv0[ i ].X, uvs[ i * 2 ].X );
+        ASSERT_FLOAT_EQ( uv0[ i ].Y, uvs[ i * 2 ].Y );
+    }
+
+    // Invalid layouts are rejected without touching the targets
+    VertexAttributeLayoutDesc missingLayout[] = { { VertexAttributeSemantic::Tangent, 0, Format::R32G32B32A32Float, 0, 0 } };
+    splitDesc.Attributes                      = { missingLayout, 1 };
+    ASSERT_EQ( meshReader.DecodeVertices( splitDesc ), 0 );
+    VertexAttributeLayoutDesc badFormatLayout[] = { { VertexAttributeSemantic::BlendIndices, 0, Format::R16G16Float, 0, 0 } };
+    splitDesc.Attributes                        = { badFormatLayout, 1 };
+    ASSERT_EQ( meshReader.DecodeVertices( splitDesc ), 0 );
+
+    // Indices past 255 don't fit uint8, decoding stops instead of clamping them to the wrong bone
+    VertexAttributeLayoutDesc narrowIndicesLayout[] = { { VertexAttributeSemantic::BlendIndices, 0, Format::R8G8B8A8Uint, 0, 24 } };
+    interleavedDesc.Attributes                      = { narrowIndicesLayout, 1 };
+    ASSERT_EQ( meshReader.DecodeVertices( interleavedDesc ), 0 );
+}
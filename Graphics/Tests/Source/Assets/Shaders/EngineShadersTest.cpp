@@ -0,0 +1,113 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <filesystem>
+#include <memory>
+
+#include "../../TestOutputDirectory.h"
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
+#include "ShaderReflectionDescription.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    const std::string ENGINE_SHADERS_TEST_DIR = std::string( DZ_TEST_DATA_DEST_DIR ) + "/EngineShaders";
+
+    bool StartsWith( const std::string &value, const std::string &prefix )
+    {
+        return value.compare( 0, prefix.size( ), prefix ) == 0;
+    }
+
+    bool EndsWith( const std::string &value, const std::string &suffix )
+    {
+        return value.size( ) >= suffix.size( ) && value.compare( value.size( ) - suffix.size( ), suffix.size( ), suffix ) == 0;
+    }
+} // namespace
+
+class EngineShadersTest : public TestOutputDirectory
+{
+protected:
+    EngineShadersTest( ) : TestOutputDirectory( ENGINE_SHADERS_TEST_DIR )
+    {
+    }
+
+    void TearDown( ) override
+    {
+        EngineShaders::SetSource( { } );
+        TestOutputDirectory::TearDown( );
+    }
+
+    static bool Build( EngineShaderVariant *variants, const uint32_t numVariants )
+    {
+        EngineShaderBuildDesc buildDesc{ };
+        buildDesc.TargetDirectory = ENGINE_SHADERS_TEST_DIR.c_str( );
+        buildDesc.Variants        = { variants, numVariants };
+        return EngineShaders::Build( buildDesc );
+    }
+};
+
+TEST_F( EngineShadersTest, AssetNameIdentifiesVariant )
+{
+    const std::string text = EngineShaders::AssetName( { EngineShader::Text } ).Get( );
+    ASSERT_TRUE( StartsWith( text, "Text_" ) ) << text;
+    ASSERT_TRUE( EndsWith( text, ".dzshader" ) ) << text;
+    ASSERT_EQ( text, EngineShaders::AssetName( { EngineShader::Text } ).Get( ) );
+
+    // The texture array size is part of the reflection, every size is a separate asset
+    const std::string ui16 = EngineShaders::AssetName( { EngineShader::UI, 16 } ).Get( );
+    const std::string ui32 = EngineShaders::AssetName( { EngineShader::UI, 32 } ).Get( );
+    ASSERT_TRUE( StartsWith( ui16, "UI_16_" ) ) << ui16;
+    ASSERT_TRUE( StartsWith( ui32, "UI_32_" ) ) << ui32;
+    ASSERT_NE( ui16.substr( 6 ), ui32.substr( 6 ) ); // The source hash covers the bindless settings too
+
+    // Shaders without bindless textures ignore MaxNumTextures
+    ASSERT_EQ( EngineShaders::AssetName( { EngineShader::FullscreenQuad, 8 } ).Get( ), std::string( EngineShaders::AssetName( { EngineShader::FullscreenQuad } ).Get( ) ) );
+}
+
+TEST_F( EngineShadersTest, BuildWritesAssetsNamedByAssetName )
+{
+    EngineShaderVariant variants[ 2 ] = { { EngineShader::Text }, { EngineShader::Quad, 8 } };
+    ASSERT_TRUE( Build( variants, 2 ) );
+    for ( const EngineShaderVariant &variant : variants )
+    {
+        const std::string path = ENGINE_SHADERS_TEST_DIR + "/" + EngineShaders::AssetName( variant ).Get( );
+        ASSERT_TRUE( std::filesystem::exists( path ) ) << path;
+    }
+}
+
+TEST_F( EngineShadersTest, ProgramFromAssetMatchesRuntimeCompiled )
+{
+    EngineShaderVariant variants[ 2 ] = { { EngineShader::Text }, { EngineShader::UI, 16 } };
+    ASSERT_TRUE( Build( variants, 2 ) );
+
+    for ( const EngineShaderVariant &variant : variants )
+    {
+        EngineShaders::SetSource( { } ); // Nothing precompiled, the embedded HLSL is compiled
+        const auto compiled = std::unique_ptr<ShaderProgram>( EngineShaders::CreateProgram( variant ) );
+        ASSERT_NE( compiled, nullptr );
+
+        EngineShaders::SetSource( { nullptr, ENGINE_SHADERS_TEST_DIR.c_str( ) } );
+        const auto loaded = std::unique_ptr<ShaderProgram>( EngineShaders::CreateProgram( variant ) );
+        ASSERT_NE( loaded, nullptr );
+
+        ASSERT_EQ( Describe( loaded->Reflect( ) ), Describe( compiled->Reflect( ) ) ) << EngineShaders::AssetName( variant ).Get( );
+        ASSERT_EQ( loaded->CompiledShaders( ).NumElements, compiled->CompiledShaders( ).NumElements );
+    }
+}
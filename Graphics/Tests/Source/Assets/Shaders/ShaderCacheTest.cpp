@@ -0,0 +1,206 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "../../TestOutputDirectory.h"
+#include "DenOfIzGraphics/Assets/Shaders/ShaderCache.h"
+#include "DenOfIzGraphics/Assets/Shaders/ShaderCompiler.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    const std::string SHADER_CACHE_TEST_DIR = std::string( DZ_TEST_DATA_DEST_DIR ) + "/ShaderCache";
+
+    ByteArray CopyBytes( const std::string &bytes )
+    {
+        ByteArray array{ };
+        array.Elements    = static_cast<Byte *>( std::malloc( bytes.size( ) ) );
+        array.NumElements = bytes.size( );
+        std::memcpy( array.Elements, bytes.data( ), bytes.size( ) );
+        return array;
+    }
+
+    ShaderCacheKey KeyOf( const std::string &keyData )
+    {
+        return ShaderCache::Key( ByteArrayView( reinterpret_cast<const Byte *>( keyData.data( ) ), keyData.size( ) ) );
+    }
+
+    std::string ToString( const ByteArray &array )
+    {
+        return { reinterpret_cast<const char *>( array.Elements ), array.NumElements };
+    }
+
+    void WriteText( const std::string &path, const std::string &text )
+    {
+        std::ofstream( path, std::ios::binary | std::ios::trunc ) << text;
+    }
+
+    std::vector<std::filesystem::path> Entries( const std::string &directory )
+    {
+        std::vector<std::filesystem::path> entries;
+        for ( const auto &entry : std::filesystem::directory_iterator( directory ) )
+        {
+            entries.push_back( entry.path( ) );
+        }
+        return entries;
+    }
+} // namespace
+
+class ShaderCacheTest : public TestOutputDirectory
+{
+protected:
+    CompileResult m_result{ };
+
+    ShaderCacheTest( ) : TestOutputDirectory( SHADER_CACHE_TEST_DIR )
+    {
+    }
+
+    void SetUp( ) override
+    {
+        TestOutputDirectory::SetUp( );
+        m_result.Code       = CopyBytes( "compiled code" );
+        m_result.Reflection = CopyBytes( "reflection" );
+    }
+
+    void TearDown( ) override
+    {
+        std::free( m_result.Code.Elements );
+        std::free( m_result.Reflection.Elements );
+        TestOutputDirectory::TearDown( );
+    }
+};
+
+TEST_F( ShaderCacheTest, LoadsStoredResult )
+{
+    const ShaderCache    cache( { .Directory = SHADER_CACHE_TEST_DIR.c_str( ) } );
+    const ShaderCacheKey key = KeyOf( "float4 main( ) : SV_Target { return 1; }" );
+    ASSERT_TRUE( cache.Store( key, m_result ) );
+    ASSERT_TRUE( cache.Contains( key ) );
+
+    // A second instance over the same directory, as in the next run
+    const ShaderCache cache2( { .Directory = SHADER_CACHE_TEST_DIR.c_str( ) } );
+    CompileResult     loaded{ };
+    ASSERT_TRUE( cache2.Load( key, loaded ) );
+    ASSERT_EQ( ToString( loaded.Code ), "compiled code" );
+    ASSERT_EQ( ToString( loaded.Reflection ), "reflection" );
+    std::free( loaded.Code.Elements );
+    std::free( loaded.Reflection.Elements );
+}
+
+TEST_F( ShaderCacheTest, MissesOnDifferentKey )
+{
+    const ShaderCache cache( { .Directory = SHADER_CACHE_TEST_DIR.c_str( ) } );
+    ASSERT_TRUE( cache.Store( KeyOf( "-D A=1" ), m_result ) );
+
+    CompileResult loaded{ };
+    ASSERT_FALSE( cache.Load( KeyOf( "-D A=2" ), loaded ) );
+    ASSERT_EQ( loaded.Code.Elements, nullptr );
+}
+
+TEST_F( ShaderCacheTest, IgnoresCorruptedEntries )
+{
+    const ShaderCache    cache( { .Directory = SHADER_CACHE_TEST_DIR.c_str( ) } );
+    const ShaderCacheKey key = KeyOf( "corrupted" );
+    ASSERT_TRUE( cache.Store( key, m_result ) );
+
+    for ( const auto &entry : std::filesystem::directory_iterator( SHADER_CACHE_TEST_DIR ) )
+    {
+        std::fstream file( entry.path( ), std::ios::binary | std::ios::in | std::ios::out );
+        file.seekp( -1, std::ios::end );
+        file.put( 'x' );
+    }
+
+    CompileResult loaded{ };
+    ASSERT_FALSE( cache.Load( key, loaded ) );
+}
+
+TEST_F( ShaderCacheTest, ClearRemovesEntries )
+{
+    const ShaderCache    cache( { .Directory = SHADER_CACHE_TEST_DIR.c_str( ) } );
+    const ShaderCacheKey key = KeyOf( "cleared" );
+    ASSERT_TRUE( cache.Store( key, m_result ) );
+    cache.Clear( );
+    ASSERT_FALSE( cache.Contains( key ) );
+}
+
+// Goes through ShaderCompiler so the key itself is tested, not just the store
+TEST_F( ShaderCacheTest, CompilerMissesOnlyWhenInputsChange )
+{
+    const std::string sourceDir   = SHADER_CACHE_TEST_DIR + "/Sources";
+    const std::string cacheDir    = SHADER_CACHE_TEST_DIR + "/Compiled";
+    const std::string includePath = sourceDir + "/Common.hlsli";
+    const std::string shaderPath  = sourceDir + "/Cached.hlsl";
+    std::filesystem::create_directories( sourceDir );
+    WriteText( includePath, "static const float Scale = 1.0f;\n" );
+    WriteText( shaderPath, "#include \"Common.hlsli\"\n"
+                           "RWStructuredBuffer<float> Output : register( u0 );\n"
+                           "[numthreads( 1, 1, 1 )] void main( ) { Output[ 0 ] = Scale * VALUE; }\n"
+                           "[numthreads( 1, 1, 1 )] void other( ) { Output[ 0 ] = Scale; }\n" );
+
+    const ShaderCache    cache( { .Directory = cacheDir.c_str( ) } );
+    const ShaderCompiler compiler;
+    const auto           compile = [ & ]( const char *entryPoint, const TargetIL targetIL, const char *define )
+    {
+        StringView  defineView( define, static_cast<uint32_t>( std::strlen( define ) ) );
+        CompileDesc desc{ };
+        desc.Path                = shaderPath.c_str( );
+        desc.EntryPoint          = entryPoint;
+        desc.Stage               = ShaderStage::Compute;
+        desc.TargetIL            = targetIL;
+        desc.Defines.Elements    = &defineView;
+        desc.Defines.NumElements = 1;
+        desc.Cache               = &cache;
+
+        const CompileResult result = compiler.CompileHLSL( desc );
+        std::string         code   = ToString( result.Code );
+        std::free( result.Code.Elements );
+        std::free( result.Reflection.Elements );
+        return code;
+    };
+
+    ASSERT_FALSE( compile( "main", TargetIL::DXIL, "VALUE=1" ).empty( ) );
+    const std::vector<std::filesystem::path> entries = Entries( cacheDir );
+    ASSERT_EQ( entries.size( ), 1u );
+
+    // Replacing the entry proves the identical recompile is served from the cache instead of being compiled and stored again
+    const std::string name = entries[ 0 ].stem( ).string( );
+    ShaderCacheKey    key{ };
+    key.High = std::stoull( name.substr( 0, 16 ), nullptr, 16 );
+    key.Low  = std::stoull( name.substr( 16, 16 ), nullptr, 16 );
+    ASSERT_TRUE( cache.Store( key, m_result ) );
+    ASSERT_EQ( compile( "main", TargetIL::DXIL, "VALUE=1" ), "compiled code" );
+
+    ASSERT_NE( compile( "main", TargetIL::DXIL, "VALUE=2" ), "compiled code" );
+    ASSERT_EQ( Entries( cacheDir ).size( ), 2u );
+    ASSERT_NE( compile( "other", TargetIL::DXIL, "VALUE=1" ), "compiled code" );
+    ASSERT_EQ( Entries( cacheDir ).size( ), 3u );
+    ASSERT_NE( compile( "main", TargetIL::SPIRV, "VALUE=1" ), "compiled code" );
+    ASSERT_EQ( Entries( cacheDir ).size( ), 4u );
+
+    WriteText( includePath, "static const float Scale = 2.0f;\n" );
+    ASSERT_NE( compile( "main", TargetIL::DXIL, "VALUE=1" ), "compiled code" );
+    ASSERT_EQ( Entries( cacheDir ).size( ), 5u );
+}
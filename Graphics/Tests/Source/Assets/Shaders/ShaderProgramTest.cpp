@@ -0,0 +1,135 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "../../TestOutputDirectory.h"
+#include "ShaderReflectionDescription.h"
+#include "DenOfIzGraphics/Backends/Common/ShaderProgram.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    const std::string SHADER_PROGRAM_TEST_DIR = std::string( DZ_TEST_DATA_DEST_DIR ) + "/ShaderProgram";
+
+    // Both stages read ViewProjection, so the Camera binding has to be merged across stages
+    constexpr auto MultiStageSource = R"(
+struct VSInput { float3 Position : POSITION; float2 TexCoord : TEXCOORD0; };
+struct PSInput { float4 Position : SV_POSITION; float2 TexCoord : TEXCOORD0; };
+cbuffer Camera : register( b0 ) { float4x4 ViewProjection; };
+cbuffer Material : register( b1 ) { float4 Tint; };
+Texture2D Albedo : register( t0 );
+SamplerState LinearSampler : register( s0 );
+
+PSInput VSMain( VSInput input )
+{
+    PSInput output;
+    output.Position = mul( float4( input.Position, 1.0f ), ViewProjection );
+    output.TexCoord = input.TexCoord;
+    return output;
+}
+
+float4 PSMain( PSInput input ) : SV_Target
+{
+    return Albedo.Sample( LinearSampler, input.TexCoord ) * Tint * ViewProjection[ 0 ][ 0 ];
+}
+)";
+} // namespace
+
+class ShaderProgramTest : public TestOutputDirectory
+{
+protected:
+    std::string     m_shaderPath;
+    ShaderStageDesc m_stages[ 2 ]{ };
+
+    ShaderProgramTest( ) : TestOutputDirectory( SHADER_PROGRAM_TEST_DIR )
+    {
+    }
+
+    void SetUp( ) override
+    {
+        TestOutputDirectory::SetUp( );
+        m_shaderPath = SHADER_PROGRAM_TEST_DIR + "/MultiStage.hlsl";
+        std::ofstream( m_shaderPath, std::ios::binary | std::ios::trunc ) << MultiStageSource;
+
+        m_stages[ 0 ].Stage      = ShaderStage::Vertex;
+        m_stages[ 0 ].Path       = m_shaderPath.c_str( );
+        m_stages[ 0 ].EntryPoint = "VSMain";
+        m_stages[ 1 ].Stage      = ShaderStage::Pixel;
+        m_stages[ 1 ].Path       = m_shaderPath.c_str( );
+        m_stages[ 1 ].EntryPoint = "PSMain";
+    }
+
+    [[nodiscard]] ShaderProgramDesc ProgramDesc( )
+    {
+        ShaderProgramDesc desc{ };
+        desc.ShaderStages.Elements    = m_stages;
+        desc.ShaderStages.NumElements = 2;
+        return desc;
+    }
+};
+
+TEST_F( ShaderProgramTest, CreateProgramsMatchesSingleProgram )
+{
+    const auto        reference = std::make_unique<ShaderProgram>( ProgramDesc( ) );
+    const std::string expected  = Describe( reference->Reflect( ) );
+    ASSERT_NE( expected.find( "Camera" ), std::string::npos ) << expected;
+
+    constexpr uint32_t NumPrograms = 4;
+    ShaderProgramDesc  descs[ NumPrograms ];
+    ShaderProgram     *programs[ NumPrograms ]{ };
+    for ( ShaderProgramDesc &desc : descs )
+    {
+        desc = ProgramDesc( );
+    }
+    ShaderProgram::CreatePrograms( { descs, NumPrograms }, { programs, NumPrograms } );
+
+    for ( ShaderProgram *program : programs )
+    {
+        ASSERT_NE( program, nullptr );
+        ASSERT_EQ( Describe( program->Reflect( ) ), expected );
+        ASSERT_EQ( program->CompiledShaders( ).NumElements, 2u );
+        delete program;
+    }
+}
+
+TEST_F( ShaderProgramTest, FailedStageReleasesEverything )
+{
+    const std::string brokenPath = SHADER_PROGRAM_TEST_DIR + "/Broken.hlsl";
+    std::ofstream( brokenPath, std::ios::binary | std::ios::trunc ) << "float4 PSMain( ) : SV_Target { return undefinedValue; }";
+
+    ShaderStageDesc brokenStages[ 2 ] = { m_stages[ 0 ], m_stages[ 1 ] };
+    brokenStages[ 1 ].Path            = brokenPath.c_str( );
+
+    ShaderProgramDesc brokenDesc = ProgramDesc( );
+    brokenDesc.ShaderStages      = { brokenStages, 2 };
+    ASSERT_THROW( ShaderProgram program( brokenDesc ), std::runtime_error );
+
+    // The broken program sits between two that compile, those must be released again
+    ShaderProgramDesc descs[ 3 ] = { ProgramDesc( ), brokenDesc, ProgramDesc( ) };
+    ShaderProgram    *programs[ 3 ]{ };
+    ASSERT_THROW( ShaderProgram::CreatePrograms( { descs, 3 }, { programs, 3 } ), std::runtime_error );
+    for ( const ShaderProgram *program : programs )
+    {
+        ASSERT_EQ( program, nullptr );
+    }
+}
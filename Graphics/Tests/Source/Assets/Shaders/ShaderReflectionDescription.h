@@ -0,0 +1,96 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <sstream>
+#include <string>
+#include "DenOfIzGraphics/Backends/Common/ShaderProgram.h"
+
+using namespace DenOfIz;
+
+inline void AppendStages( std::ostringstream &out, const ShaderStageArray &stages )
+{
+    for ( size_t i = 0; i < stages.NumElements; ++i )
+    {
+        out << static_cast<int>( stages.Elements[ i ] ) << ',';
+    }
+}
+
+inline void AppendBinding( std::ostringstream &out, const ResourceBindingDesc &binding )
+{
+    out << binding.Name.Get( ) << ' ' << static_cast<int>( binding.BindingType ) << ' ' << binding.Binding << ' ' << binding.RegisterSpace << ' '
+        << binding.Descriptor << ' ' << binding.ArraySize << ' ' << binding.IsBindless << " stages ";
+    AppendStages( out, binding.Stages );
+    out << '\n';
+}
+
+// Everything Reflect( ) returns in a comparable form, a mismatch shows up as a readable diff
+inline std::string Describe( const ShaderReflectDesc &reflection )
+{
+    std::ostringstream out;
+    const InputGroupDescArray &groups = reflection.InputLayout.InputGroups;
+    for ( size_t i = 0; i < groups.NumElements; ++i )
+    {
+        out << "group " << static_cast<int>( groups.Elements[ i ].StepRate ) << '\n';
+        for ( size_t j = 0; j < groups.Elements[ i ].Elements.NumElements; ++j )
+        {
+            const InputLayoutElementDesc &element = groups.Elements[ i ].Elements.Elements[ j ];
+            out << "  " << element.Semantic.Get( ) << element.SemanticIndex << ' ' << static_cast<int>( element.Format ) << '\n';
+        }
+    }
+
+    const RootSignatureDesc &rootSignature = reflection.RootSignature;
+    for ( uint32_t i = 0; i < rootSignature.ResourceBindings.NumElements; ++i )
+    {
+        out << "binding ";
+        AppendBinding( out, rootSignature.ResourceBindings.Elements[ i ] );
+    }
+    for ( uint32_t i = 0; i < rootSignature.StaticSamplers.NumElements; ++i )
+    {
+        out << "sampler ";
+        AppendBinding( out, rootSignature.StaticSamplers.Elements[ i ].Binding );
+    }
+    for ( uint32_t i = 0; i < rootSignature.RootConstants.NumElements; ++i )
+    {
+        const RootConstantResourceBindingDesc &constants = rootSignature.RootConstants.Elements[ i ];
+        out << "constants " << constants.Name.Get( ) << ' ' << constants.Binding << ' ' << constants.NumBytes << " stages ";
+        AppendStages( out, constants.Stages );
+        out << '\n';
+    }
+    for ( uint32_t i = 0; i < rootSignature.BindlessResources.NumElements; ++i )
+    {
+        const BindlessResourceDesc &bindless = rootSignature.BindlessResources.Elements[ i ];
+        out << "bindless " << bindless.Name.Get( ) << ' ' << bindless.Binding << ' ' << bindless.RegisterSpace << ' ' << static_cast<int>( bindless.Type ) << '\n';
+    }
+    for ( uint32_t i = 0; i < reflection.LocalRootSignatures.NumElements; ++i )
+    {
+        const ResourceBindingDescArray &bindings = reflection.LocalRootSignatures.Elements[ i ].ResourceBindings;
+        for ( uint32_t j = 0; j < bindings.NumElements; ++j )
+        {
+            out << "local " << i << ' ';
+            AppendBinding( out, bindings.Elements[ j ] );
+        }
+    }
+    for ( uint32_t i = 0; i < reflection.ThreadGroups.NumElements; ++i )
+    {
+        const ThreadGroupInfo &group = reflection.ThreadGroups.Elements[ i ];
+        out << "threads " << group.X << ' ' << group.Y << ' ' << group.Z << '\n';
+    }
+    return out.str( );
+}
@@ -143,3 +143,148 @@ TEST( BinarySerdeTest, InteropArrayByteSupport )
 
     reader.LogAsCppArray( "TestData" );
 }
+
+TEST( BinarySerdeTest, BulkReads )
+{
+    std::vector<Float_3> positions( 1000 );
+    for ( size_t i = 0; i < positions.size( ); ++i )
+    {
+        positions[ i ] = { static_cast<float>( i ), static_cast<float>( i ) * 0.5f, -static_cast<float>( i ) };
+    }
+
+    BinaryContainer container;
+    {
+        const BinaryWriter writer( container );
+        writer.WriteUInt32( static_cast<uint32_t>( positions.size( ) ) );
+        for ( const Float_3 &position : positions )
+        {
+            writer.WriteFloat_3( position );
+        }
+        writer.WriteUInt64( 9876543210ULL );
+        writer.Flush( );
+    }
+
+    const ByteArrayView data = container.GetData( );
+    BinaryReaderDesc    desc{ };
+    desc.NumBytes = data.NumElements;
+    desc.CopyData = false;
+
+    BinaryReader memoryReader( data, desc );
+    BinaryReader streamReader( container );
+    for ( BinaryReader *reader : { &memoryReader, &streamReader } )
+    {
+        std::vector<Float_3> readPositions( reader->ReadUInt32( ) );
+        ASSERT_EQ( readPositions.size( ), positions.size( ) );
+        ASSERT_TRUE( reader->ReadInto( std::span( readPositions ) ) );
+        for ( size_t i = 0; i < positions.size( ); ++i )
+        {
+            ASSERT_FLOAT_EQ( readPositions[ i ].X, positions[ i ].X );
+            ASSERT_FLOAT_EQ( readPositions[ i ].Y, positions[ i ].Y );
+            ASSERT_FLOAT_EQ( readPositions[ i ].Z, positions[ i ].Z );
+        }
+        ASSERT_EQ( reader->ReadUInt64( ), 9876543210ULL );
+
+        uint32_t pastEnd = 0;
+        ASSERT_FALSE( reader->ReadArray( &pastEnd, 1 ) );
+    }
+}
+
+TEST( BinarySerdeTest, ReaderTakesOverReadAllBytes )
+{
+    BinaryContainer container;
+    {
+        const BinaryWriter writer( container );
+        writer.WriteUInt32( 42 );
+        writer.WriteString( "Owned" );
+        writer.Flush( );
+    }
+
+    ByteArray bytes{ };
+    {
+        BinaryReader source( container );
+        bytes = source.ReadAllBytes( );
+    }
+    ASSERT_NE( bytes.Elements, nullptr );
+
+    // The reader frees the bytes, there is nothing to release here
+    BinaryReader reader( bytes );
+    ASSERT_EQ( reader.ReadUInt32( ), 42u );
+    ASSERT_STREQ( reader.ReadString( ).Get( ), "Owned" );
+    ASSERT_EQ( reader.ReadByte( ), -1 );
+}
+
+TEST( BinarySerdeTest, ReadLimitCountsBytes )
+{
+    BinaryContainer container;
+    {
+        const BinaryWriter writer( container );
+        writer.WriteUInt32( 1 );
+        writer.WriteUInt64( 2 );
+        writer.WriteUInt32( 3 );
+        writer.Flush( );
+    }
+
+    BinaryReaderDesc desc{ };
+    desc.NumBytes = 12;
+
+    BinaryReader reader( container, desc );
+    ASSERT_EQ( reader.ReadUInt32( ), 1u );
+    ASSERT_EQ( reader.ReadUInt64( ), 2u );
+    ASSERT_EQ( reader.ReadUInt32( ), 0u );
+}
+
+TEST( BinarySerdeTest, ContainerGrowsInPlace )
+{
+    BinaryContainer container( 16 );
+    const BinaryWriter writer( container );
+    for ( uint32_t i = 0; i < 1000; ++i )
+    {
+        writer.WriteUInt32( i );
+    }
+    ASSERT_EQ( container.NumBytes( ), 4000u );
+
+    // GetData is a view, repeated calls return the same memory
+    const ByteArrayView data = container.GetData( );
+    ASSERT_EQ( data.Elements, container.GetData( ).Elements );
+    ASSERT_EQ( data.NumElements, 4000u );
+
+    // Writing past the end leaves a zero filled gap
+    writer.Seek( 4004 );
+    writer.WriteUInt32( 42 );
+    ASSERT_EQ( container.NumBytes( ), 4008u );
+
+    BinaryReader reader( container );
+    reader.Seek( 3996 );
+    ASSERT_EQ( reader.ReadUInt32( ), 999u );
+    ASSERT_EQ( reader.ReadUInt32( ), 0u );
+    ASSERT_EQ( reader.ReadUInt32( ), 42u );
+
+    // Data appended after the reader was opened is still readable
+    writer.WriteUInt32( 7 );
+    ASSERT_EQ( reader.ReadUInt32( ), 7u );
+}
+
+TEST( BinarySerdeTest, ContainerReallocatedWhileReading )
+{
+    BinaryContainer    container( 16 );
+    const BinaryWriter writer( container );
+    for ( uint32_t i = 0; i < 4; ++i )
+    {
+        writer.WriteUInt32( i );
+    }
+
+    BinaryReader reader( container );
+    ASSERT_EQ( reader.ReadUInt32( ), 0u );
+
+    // Growing far past the reserved size moves the buffer, reads that were in bounds before must follow it
+    const Byte *oldData = container.GetData( ).Elements;
+    for ( uint32_t i = 4; i < 4096; ++i )
+    {
+        writer.WriteUInt32( i );
+    }
+    ASSERT_NE( container.GetData( ).Elements, oldData );
+    for ( uint32_t i = 1; i < 4096; ++i )
+    {
+        ASSERT_EQ( reader.ReadUInt32( ), i );
+    }
+}
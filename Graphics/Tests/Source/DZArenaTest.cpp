@@ -0,0 +1,88 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <thread>
+#include "DenOfIzGraphics/Utilities/DZArena.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+TEST( DZArenaTest, ChunkedAllocationsDoNotMove )
+{
+    DZArena arena( 64 );
+
+    auto *first = reinterpret_cast<uint32_t *>( arena.Allocate( 16 * sizeof( uint32_t ), alignof( uint32_t ) ) );
+    for ( uint32_t i = 0; i < 16; ++i )
+    {
+        first[ i ] = i;
+    }
+
+    Byte *large = arena.Allocate( 4096 );
+    ASSERT_NE( large, nullptr );
+    memset( large, 0xAB, 4096 );
+    ASSERT_GE( arena.GetTotalCapacity( ), 64 + 4096 );
+
+    for ( uint32_t i = 0; i < 16; ++i )
+    {
+        ASSERT_EQ( first[ i ], i );
+    }
+}
+
+TEST( DZArenaTest, ResetReusesBlocks )
+{
+    DZArena arena( 64 );
+    Byte   *first = arena.Allocate( 32 );
+    Byte   *large = arena.Allocate( 1024 );
+
+    const size_t totalCapacity = arena.GetTotalCapacity( );
+    arena.Reset( );
+    ASSERT_EQ( arena.Allocate( 32 ), first );
+    ASSERT_EQ( arena.Allocate( 1024 ), large );
+    ASSERT_EQ( arena.GetTotalCapacity( ), totalCapacity );
+
+    arena.Clear( );
+    ASSERT_EQ( arena.GetTotalCapacity( ), 64 );
+}
+
+TEST( DZArenaTest, ContiguousWrite )
+{
+    DZArena arena( 4, DZArenaMode::Contiguous );
+
+    const char text[] = "contiguous arena";
+    arena.Write( text, sizeof( text ) );
+    ASSERT_EQ( arena.GetRemainingCapacity( ) + sizeof( text ), arena.GetTotalCapacity( ) );
+
+    DZArenaCursor cursor = DZArenaCursor::Create( &arena );
+    ASSERT_EQ( cursor.GetPosition( ), sizeof( text ) );
+    ASSERT_STREQ( reinterpret_cast<const char *>( cursor.GetWritePointer( ) - sizeof( text ) ), text );
+}
+
+TEST( DZArenaTest, FrameArenaIsPerThreadAndResetsEachFrame )
+{
+    DZFrameArena::BeginFrame( );
+    Byte *mainThread = DZFrameArena::Allocate( 128 );
+
+    Byte *otherThread = nullptr;
+    std::thread( [ &otherThread ] { otherThread = DZFrameArena::Allocate( 128 ); } ).join( );
+    ASSERT_NE( mainThread, otherThread );
+
+    ASSERT_NE( DZFrameArena::Allocate( 128 ), mainThread );
+    DZFrameArena::BeginFrame( );
+    ASSERT_EQ( DZFrameArena::Allocate( 128 ), mainThread );
+}
@@ -0,0 +1,111 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <thread>
+#include <vector>
+#include "DenOfIzGraphics/Assets/Serde/Asset.h"
+#include "DenOfIzGraphics/Utilities/InternedString.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+TEST( InteropStringTest, InlineAndHeapStrings )
+{
+    const InteropString shortString( "short" );
+    const InteropString longString( "a string that does not fit in the inline buffer" );
+    ASSERT_EQ( shortString.NumChars( ), 5 );
+    ASSERT_EQ( longString.NumChars( ), 47 );
+
+    InteropString copy = longString;
+    ASSERT_TRUE( copy.Equals( longString ) );
+    ASSERT_NE( copy.Get( ), longString.Get( ) );
+
+    const char   *heapChars = copy.Get( );
+    InteropString moved( std::move( copy ) );
+    ASSERT_EQ( moved.Get( ), heapChars );
+    ASSERT_TRUE( copy.IsEmpty( ) );
+
+    InteropString movedShort( InteropString( "short" ) );
+    ASSERT_TRUE( movedShort.Equals( shortString ) );
+    ASSERT_STREQ( movedShort.Append( "er" ).Get( ), "shorter" );
+    ASSERT_STREQ( longString.ToUpper( ).ToLower( ).Get( ), longString.Get( ) );
+}
+
+TEST( InteropStringTest, NullAndEmpty )
+{
+    const InteropString null;
+    const InteropString empty( "" );
+    ASSERT_TRUE( null.IsEmpty( ) );
+    ASSERT_TRUE( empty.IsEmpty( ) );
+    ASSERT_STREQ( null.Get( ), "" );
+    ASSERT_FALSE( null.Equals( empty ) );
+    ASSERT_TRUE( null.Equals( InteropString( ) ) );
+}
+
+TEST( InteropStringTest, HashIsCachedAndCopied )
+{
+    const InteropString a( "Models/Fox.dzmesh" );
+    InteropString       b( "Models/Fox.dzmesh" );
+    ASSERT_EQ( a.Hash( ), b.Hash( ) );
+    ASSERT_NE( a.Hash( ), InteropString( "Models/Fox.dzmes" ).Hash( ) );
+
+    const InteropString copy = a;
+    ASSERT_EQ( copy.Hash( ), a.Hash( ) );
+    b = InteropString( "Models/Cat.dzmesh" );
+    ASSERT_FALSE( a.Equals( b ) );
+    ASSERT_NE( a.Hash( ), b.Hash( ) );
+}
+
+TEST( InteropStringTest, InternedStrings )
+{
+    const InternedString a( "Textures/Albedo.dztex" );
+    const InternedString b( InteropString( "Textures/Albedo.dztex" ) );
+    const InternedString c( "Textures/Normal.dztex" );
+    ASSERT_TRUE( a.Equals( b ) );
+    ASSERT_EQ( a.Id( ), b.Id( ) );
+    ASSERT_FALSE( a.Equals( c ) );
+    ASSERT_EQ( a.Get( ), b.Get( ) );
+    ASSERT_STREQ( a.Get( ), "Textures/Albedo.dztex" );
+    ASSERT_EQ( a.Hash( ), InteropString( "Textures/Albedo.dztex" ).Hash( ) );
+    ASSERT_TRUE( InternedString( "" ).Equals( InternedString( ) ) );
+
+    const AssetUri uri = AssetUri::Create( "Textures/Albedo.dztex" );
+    ASSERT_TRUE( uri.Intern( ).Equals( InternedString( uri.ToInteropString( ) ) ) );
+    ASSERT_TRUE( uri.Equals( AssetUri::Parse( "asset://Textures/Albedo.dztex" ) ) );
+}
+
+TEST( InteropStringTest, InternFromManyThreads )
+{
+    const size_t                numInternedBefore = InternedString::NumInterned( );
+    std::vector<InternedString> results( 8 );
+    std::vector<std::thread>    threads;
+    for ( size_t i = 0; i < results.size( ); ++i )
+    {
+        threads.emplace_back( [ &results, i ] { results[ i ] = InternedString( "Shaders/Shared.dzshader" ); } );
+    }
+    for ( std::thread &thread : threads )
+    {
+        thread.join( );
+    }
+    for ( const InternedString &result : results )
+    {
+        ASSERT_TRUE( result.Equals( results[ 0 ] ) );
+    }
+    ASSERT_EQ( InternedString::NumInterned( ), numInternedBefore + 1 );
+}
@@ -0,0 +1,96 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <vector>
+#include "DenOfIzGraphics/Utilities/JobSystem.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+TEST( JobSystemTest, ParallelForCoversRange )
+{
+    JobSystemDesc desc{ };
+    desc.NumWorkers = 4;
+    const JobSystem jobs( desc );
+
+    std::vector<std::atomic<uint32_t>> visits( 1000 );
+    jobs.ParallelFor( static_cast<uint32_t>( visits.size( ) ),
+                      [ & ]( const uint32_t begin, const uint32_t end )
+                      {
+                          for ( uint32_t i = begin; i < end; ++i )
+                          {
+                              ++visits[ i ];
+                          }
+                      } );
+    for ( const auto &visit : visits )
+    {
+        ASSERT_EQ( visit.load( ), 1 );
+    }
+}
+
+TEST( JobSystemTest, GraphRunsInDependencyOrder )
+{
+    const JobSystem jobs( { 4 } );
+
+    std::atomic<uint32_t> step = 0;
+    uint32_t              first = 0, second = 0, third = 0;
+
+    JobGraph       graph;
+    const uint32_t a = graph.Add( [ & ] { first = ++step; } );
+    const uint32_t b = graph.Add( [ & ] { second = ++step; } );
+    const uint32_t c = graph.Add( [ & ] { third = ++step; } );
+    graph.Precede( a, b );
+    graph.Precede( b, c );
+
+    for ( uint32_t run = 0; run < 3; ++run )
+    {
+        step = 0;
+        JobCounter counter;
+        jobs.Run( graph, &counter );
+        jobs.Wait( counter );
+        ASSERT_EQ( first, 1 );
+        ASSERT_EQ( second, 2 );
+        ASSERT_EQ( third, 3 );
+    }
+}
+
+TEST( JobSystemTest, JobsWaitOnNestedJobs )
+{
+    // A single worker deadlocks unless waiting inside a job runs the nested jobs
+    const JobSystem jobs( { 1 } );
+
+    std::atomic<uint32_t> numNested = 0;
+    JobCounter            outer;
+    jobs.Submit(
+        [ & ]
+        {
+            ASSERT_TRUE( jobs.IsWorkerThread( ) );
+            JobCounter nested;
+            for ( uint32_t i = 0; i < 16; ++i )
+            {
+                jobs.Submit( [ & ] { ++numNested; }, &nested );
+            }
+            jobs.Wait( nested );
+        },
+        &outer );
+    jobs.Wait( outer );
+
+    ASSERT_FALSE( jobs.IsWorkerThread( ) );
+    ASSERT_EQ( numNested.load( ), 16 );
+}
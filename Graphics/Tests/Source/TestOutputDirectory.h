@@ -0,0 +1,47 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <gtest/gtest.h>
+
+// Base fixture for suites that write files. The directory is created before and removed after every test, suites share
+// DZ_TEST_DATA_DEST_DIR so each one only ever removes its own directory.
+class TestOutputDirectory : public testing::Test
+{
+    std::string m_directory;
+
+protected:
+    explicit TestOutputDirectory( std::string directory ) : m_directory( std::move( directory ) )
+    {
+    }
+
+    void SetUp( ) override
+    {
+        std::filesystem::create_directories( m_directory );
+    }
+
+    void TearDown( ) override
+    {
+        std::error_code error;
+        std::filesystem::remove_all( m_directory, error );
+    }
+};
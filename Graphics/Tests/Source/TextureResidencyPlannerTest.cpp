@@ -0,0 +1,199 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <vector>
+#include "DenOfIzGraphics/Data/TextureResidencyPlanner.h"
+#include "gtest/gtest.h"
+
+using namespace DenOfIz;
+
+namespace
+{
+    // Full mip chain of a square texture, every mip is one slice of Format
+    struct TestTexture
+    {
+        TextureDesc             Desc{ };
+        std::vector<TextureMip> Mips;
+
+        TestTexture( const uint32_t size, const Format format = Format::R8G8B8A8Unorm )
+        {
+            Desc.Width  = size;
+            Desc.Height = size;
+            Desc.Format = format;
+            for ( uint32_t mipSize = size; ; mipSize = std::max( 1u, mipSize / 2 ) )
+            {
+                TextureMip mip{ };
+                mip.Width      = mipSize;
+                mip.Height     = mipSize;
+                mip.MipIndex   = static_cast<uint32_t>( Mips.size( ) );
+                mip.RowPitch   = mipSize * 4;
+                mip.NumRows    = mipSize;
+                mip.SlicePitch = mip.RowPitch * mip.NumRows;
+                Mips.push_back( mip );
+                if ( mipSize == 1 )
+                {
+                    break;
+                }
+            }
+            Desc.MipLevels = static_cast<uint32_t>( Mips.size( ) );
+        }
+
+        [[nodiscard]] TextureMipArray MipArray( )
+        {
+            return { Mips.data( ), Mips.size( ) };
+        }
+    };
+
+    TextureResidencyPlannerDesc PlannerDesc( const uint64_t memoryBudget )
+    {
+        TextureResidencyPlannerDesc desc{ };
+        desc.MemoryBudget = memoryBudget;
+        desc.MaxTailSize  = 64;
+        return desc;
+    }
+} // namespace
+
+TEST( TextureResidencyPlannerTest, TextureStartsAtItsTail )
+{
+    TextureResidencyPlanner planner( PlannerDesc( UINT64_MAX ) );
+    TestTexture             texture( 256 );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+
+    ASSERT_EQ( planner.GetTailMip( 0 ), 2u ); // 64x64 is the largest mip within MaxTailSize
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 2u );
+    ASSERT_EQ( planner.GetNumBytesFromMip( 0, 8 ), 4u );
+    ASSERT_EQ( planner.GetNumBytesFromMip( 0, 1 ), 128u * 128 * 4 + planner.GetNumBytesFromMip( 0, 2 ) );
+
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 2u );
+}
+
+TEST( TextureResidencyPlannerTest, FinestRequestOfAFrameWins )
+{
+    TextureResidencyPlanner planner( PlannerDesc( UINT64_MAX ) );
+    TestTexture             texture( 256 );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+
+    planner.RequestMip( 0, 1 );
+    planner.RequestMip( 0, 0 );
+    planner.RequestMip( 0, 2 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 0u );
+    ASSERT_EQ( planner.GetTargetNumBytes( ), planner.GetNumBytesFromMip( 0, 0 ) );
+
+    // A new frame replaces the request, without one the last request persists
+    planner.RequestMip( 0, 1 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 1u );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 1u );
+
+    // Mips past the tail are clamped to it
+    planner.RequestMip( 0, 7 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 2u );
+}
+
+TEST( TextureResidencyPlannerTest, OverBudgetDropsLeastRecentlyRequestedFirst )
+{
+    TestTexture texture( 256 );
+    uint64_t    fullNumBytes = 0;
+    uint64_t    tailNumBytes = 0;
+    {
+        TextureResidencyPlanner sizes( PlannerDesc( UINT64_MAX ) );
+        sizes.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+        fullNumBytes = sizes.GetNumBytesFromMip( 0, 0 );
+        tailNumBytes = sizes.GetNumBytesFromMip( 0, sizes.GetTailMip( 0 ) );
+    }
+
+    // Room for one texture at full resolution, the other has to stay at its tail
+    TextureResidencyPlanner planner( PlannerDesc( fullNumBytes + tailNumBytes ) );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+    planner.SetTexture( 1, texture.Desc, texture.MipArray( ) );
+
+    planner.RequestMip( 0, 0 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 0u );
+
+    planner.RequestMip( 1, 0 ); // Texture 0 keeps its older request
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 1 ), 0u );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), planner.GetTailMip( 0 ) );
+    ASSERT_LE( planner.GetTargetNumBytes( ), fullNumBytes + tailNumBytes );
+
+    // Requesting both in the same frame keeps the order they were added in, the first one drops
+    planner.RequestMip( 0, 0 );
+    planner.RequestMip( 1, 0 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), planner.GetTailMip( 0 ) );
+    ASSERT_EQ( planner.GetTargetMip( 1 ), 0u );
+}
+
+TEST( TextureResidencyPlannerTest, DropsOnlyAsManyMipsAsNeeded )
+{
+    TestTexture             texture( 256 );
+    TextureResidencyPlanner sizes( PlannerDesc( UINT64_MAX ) );
+    sizes.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+
+    TextureResidencyPlanner planner( PlannerDesc( sizes.GetNumBytesFromMip( 0, 1 ) ) );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+    planner.RequestMip( 0, 0 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 1u );
+}
+
+TEST( TextureResidencyPlannerTest, TailsStayWhenTheyExceedTheBudget )
+{
+    TextureResidencyPlanner planner( PlannerDesc( 1 ) );
+    TestTexture             texture( 256 );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+    planner.SetTexture( 1, texture.Desc, texture.MipArray( ) );
+
+    planner.RequestMip( 0, 0 );
+    planner.RequestMip( 1, 0 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), planner.GetTailMip( 0 ) );
+    ASSERT_EQ( planner.GetTargetMip( 1 ), planner.GetTailMip( 1 ) );
+    ASSERT_EQ( planner.GetTargetNumBytes( ), 2 * planner.GetNumBytesFromMip( 0, planner.GetTailMip( 0 ) ) );
+}
+
+TEST( TextureResidencyPlannerTest, RemovedTexturesDontCount )
+{
+    TextureResidencyPlanner planner( PlannerDesc( UINT64_MAX ) );
+    TestTexture             texture( 256 );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+    planner.SetTexture( 1, texture.Desc, texture.MipArray( ) );
+    planner.RemoveTexture( 0 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetNumBytes( ), planner.GetNumBytesFromMip( 1, planner.GetTailMip( 1 ) ) );
+}
+
+TEST( TextureResidencyPlannerTest, BlockCompressedTailIsBlockAligned )
+{
+    // 96x96 halves to 12x12 at mip 3 and to 6x6 at mip 4, which is not a multiple of the 4x4 blocks
+    TextureResidencyPlannerDesc desc = PlannerDesc( UINT64_MAX );
+    desc.MaxTailSize                 = 4;
+    TextureResidencyPlanner planner( desc );
+    TestTexture             texture( 96, Format::BC1Unorm );
+    planner.SetTexture( 0, texture.Desc, texture.MipArray( ) );
+
+    ASSERT_EQ( planner.GetTailMip( 0 ), 3u );
+    planner.RequestMip( 0, 6 );
+    planner.Plan( );
+    ASSERT_EQ( planner.GetTargetMip( 0 ), 3u );
+}
@@ -0,0 +1,67 @@
+/*
+Den Of Iz - Game/Game Engine
+Copyright (c) 2020-2024 Muhammed Murat Cengiz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+/**
+ * Tool to precompile the shaders used by the engine renderers, so applications can create them without invoking DXC
+ * Usage: EngineShaderBuilder <output directory> [output.dzbundle]
+ * Point EngineDesc::Shaders at the directory or the bundle at runtime.
+ */
+
+#include <iostream>
+#include <memory>
+#include "DenOfIzGraphics/Assets/Bundle/Bundle.h"
+#include "DenOfIzGraphics/Assets/Shaders/EngineShaders.h"
+#include "DenOfIzGraphics/Utilities/Engine.h"
+
+using namespace DenOfIz;
+
+int main( int argc, char *argv[] )
+{
+    if ( argc < 2 )
+    {
+        std::cerr << "Usage: " << argv[ 0 ] << " <output directory> [output.dzbundle]\n";
+        std::cerr << "Example: " << argv[ 0 ] << " Assets/EngineShaders Assets/EngineShaders.dzbundle\n";
+        return 1;
+    }
+
+    Engine::Init( );
+
+    std::unique_ptr<Bundle> bundle;
+    if ( argc > 2 )
+    {
+        BundleDesc bundleDesc{ };
+        bundleDesc.Path              = argv[ 2 ];
+        bundleDesc.CreateIfNotExists = true;
+        bundle                       = std::make_unique<Bundle>( bundleDesc );
+    }
+
+    EngineShaderBuildDesc buildDesc{ };
+    buildDesc.TargetDirectory = argv[ 1 ];
+    buildDesc.TargetBundle    = bundle.get( );
+    const bool built          = EngineShaders::Build( buildDesc );
+
+    bundle.reset( );
+    Engine::Shutdown( );
+    if ( !built )
+    {
+        std::cerr << "Failed to build engine shaders" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -60,8 +60,13 @@ using namespace DirectX;
 
 %ignore DenOfIz::CompiledShaders;
 %ignore DenOfIz::ShaderProgram::GetCompiledShaders;
+%ignore DenOfIz::ShaderCache::Load;
+%ignore DenOfIz::ShaderCache::Store;
 %ignore DenOfIz::ReflectionState;
 %ignore DenOfIz::BatchResourceCopy::SyncOp;
+%ignore DenOfIz::GpuResourceLoader::QueueStagedCopy;
+%ignore DenOfIz::RecordStagedCopy;
+%ignore DenOfIz::StagedCopyDesc;
 %ignore DenOfIz::GraphicsWindowHandle::CreateFromSDLWindow;
 %ignore DenOfIz::GraphicsWindowHandle::CreateViaSDLWindowID;
 %ignore TWindowHandle;
@@ -116,6 +121,10 @@ using namespace DirectX;
 %ignore DenOfIz::BinaryWriter::BinaryWriter(std::ostream *, const BinaryWriterDesc &);
 %ignore DenOfIz::BinaryReader::BinaryReader(std::istream *);
 %ignore DenOfIz::BinaryReader::BinaryReader(std::istream *, const BinaryReaderDesc &);
+%ignore DenOfIz::BinaryReader::BinaryReader(std::unique_ptr<std::istream>);
+%ignore DenOfIz::BinaryReader::BinaryReader(std::unique_ptr<std::istream>, const BinaryReaderDesc &);
+%ignore DenOfIz::BinaryReader::BinaryReader(const ByteArray &);
+%ignore DenOfIz::BinaryReader::BinaryReader(const ByteArray &, const BinaryReaderDesc &);
 
 // Fix InteropString/InteropArray:
 %ignore DenOfIz::InteropString::InteropString(const char *, const size_t);
@@ -128,6 +137,16 @@ using namespace DirectX;
 %ignore DenOfIz::InteropArray::EmplaceElement;
 %ignore DenOfIz::InteropArray::MemCpy;
 
+// Jobs take std::function, only the desc is exposed:
+%ignore DenOfIz::JobCounter;
+%ignore DenOfIz::JobGraph;
+%ignore DenOfIz::JobSystem;
+
+// Called by the importers with std types, only creating, saving and loading the cache is exposed:
+%ignore DenOfIz::ImportCacheRecord;
+%ignore DenOfIz::ImportCache::Find;
+%ignore DenOfIz::ImportCache::Store;
+
 // Asset serde ignores:
 %ignore DenOfIz::AssetHeader::operator=;
 %ignore DenOfIz::AssetUri::operator=;
@@ -157,10 +176,13 @@ using namespace DirectX;
 
 // First include the math and interop utilities
 %include <DenOfIzGraphics/Utilities/Interop.h>
+%include <DenOfIzGraphics/Utilities/InternedString.h>
 %include <DenOfIzGraphics/Utilities/InteropMath.h>
 %include <DenOfIzGraphics/Utilities/InteropUtilities.h>
 %include <DenOfIzGraphics/Utilities/Common_Macro.h>
 %include <DenOfIzGraphics/Assets/FileSystem/FSConfig.h>
+%include <DenOfIzGraphics/Utilities/JobSystem.h>
+%include <DenOfIzGraphics/Assets/Shaders/EngineShaders.h>
 %include <DenOfIzGraphics/Utilities/Engine.h>
 %include <DenOfIzGraphics/Assets/Serde/Asset.h>
 %include <DenOfIzGraphics/Assets/FileSystem/FileIO.h>
@@ -186,6 +208,7 @@ using namespace DirectX;
 
 // Required in the middle here since ShaderProgram depends on ShaderAsset
 %include <DenOfIzGraphics/Assets/Shaders/ShaderReflectDesc.h>
+%include <DenOfIzGraphics/Assets/Shaders/ShaderCache.h>
 %include <DenOfIzGraphics/Assets/Serde/Shader/ShaderAsset.h>
 %include <DenOfIzGraphics/Backends/Common/ShaderProgram.h>
 
@@ -283,12 +306,18 @@ using namespace DirectX;
 
 %include <DenOfIzGraphics/Data/Geometry.h>
 %include <DenOfIzGraphics/Data/AlignedDataWriter.h>
+%include <DenOfIzGraphics/Data/StagingRing.h>
+%include <DenOfIzGraphics/Assets/GpuResource/GpuResourceLoader.h>
 %include <DenOfIzGraphics/Data/BatchResourceCopy.h>
+%include <DenOfIzGraphics/Data/TextureResidencyPlanner.h>
+%include <DenOfIzGraphics/Data/TextureStreamer.h>
 %include <DenOfIzGraphics/Data/Texture.h>
 
 // Bundle system
 %include <DenOfIzGraphics/Assets/Bundle/Bundle.h>
 %include <DenOfIzGraphics/Assets/Bundle/BundleManager.h>
+%include <DenOfIzGraphics/Assets/Bundle/AssetRequestQueue.h>
+%include <DenOfIzGraphics/Assets/Bundle/AssetAccessTrace.h>
 
 %include <DenOfIzGraphics/Utilities/Time.h>
 %include <DenOfIzGraphics/Utilities/StepTimer.h>
@@ -298,12 +327,14 @@ using namespace DirectX;
 %include <DenOfIzGraphics/Assets/Vector2d/ThorVGWrapper.h>
 
 %include <DenOfIzGraphics/Assets/Import/ImporterCommon.h>
+%include <DenOfIzGraphics/Assets/Import/ImportCache.h>
 %include <DenOfIzGraphics/Assets/Import/AssetScanner.h>
 %include <DenOfIzGraphics/Assets/Import/AssimpImporter.h>
 %include <DenOfIzGraphics/Assets/Import/FontImporter.h>
 %include <DenOfIzGraphics/Assets/Import/ShaderImporter.h>
 %include <DenOfIzGraphics/Assets/Import/TextureImporter.h>
 %include <DenOfIzGraphics/Assets/Import/VGImporter.h>
+%include <DenOfIzGraphics/Assets/Import/BatchImporter.h>
 
 %include "DenOfIzGraphics_Input.i"
 